@@ -1,8 +1,241 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2018 FIRST. All Rights Reserved.                             */
+/* Copyright (c) 2018-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
 /*----------------------------------------------------------------------------*/
 
-int main() {}
+// Benchmarks RetroreflectiveTargetPipeline against the equivalent OpenCV
+// pipeline and checks that both find the same targets.  Pass recorded frames
+// as image files on the command line, or run without arguments to use
+// synthetic frames.  Exits with 1 if the BGR targets differ.
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <opencv2/core/core.hpp>
+#include <opencv2/imgcodecs/imgcodecs.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+#include <wpi/Format.h>
+#include <wpi/Twine.h>
+#include <wpi/raw_ostream.h>
+#include <wpi/timestamp.h>
+
+#include "vision/RetroreflectiveTargetPipeline.h"
+
+namespace {
+
+constexpr int kIterations = 200;
+
+// The cvtColor, inRange, findContours and filter chain that
+// RetroreflectiveTargetPipeline replaces, using the same thresholds
+class OpenCVPipeline {
+ public:
+  OpenCVPipeline(const frc::RetroreflectiveTargetPipeline::Threshold& t,
+                 double minArea)
+      : m_min(t.minY, t.minCr, t.minCb),
+        m_max(t.maxY, t.maxCr, t.maxCb),
+        m_minArea(minArea) {}
+
+  size_t Process(const cv::Mat& image) {
+    cv::cvtColor(image, m_ycrcb, cv::COLOR_BGR2YCrCb);
+    cv::inRange(m_ycrcb, m_min, m_max, m_mask);
+    m_contours.clear();
+    cv::findContours(m_mask, m_contours, cv::RETR_EXTERNAL,
+                     cv::CHAIN_APPROX_SIMPLE);
+    m_targets.clear();
+    for (const auto& contour : m_contours) {
+      if (cv::contourArea(contour) < m_minArea) continue;
+      m_targets.push_back(cv::boundingRect(contour));
+    }
+    std::sort(m_targets.begin(), m_targets.end(),
+              [](const cv::Rect& a, const cv::Rect& b) {
+                return a.area() > b.area();
+              });
+    return m_targets.size();
+  }
+
+  const std::vector<cv::Rect>& GetTargets() const { return m_targets; }
+
+ private:
+  cv::Scalar m_min;
+  cv::Scalar m_max;
+  double m_minArea;
+  cv::Mat m_ycrcb;
+  cv::Mat m_mask;
+  std::vector<std::vector<cv::Point>> m_contours;
+  std::vector<cv::Rect> m_targets;
+};
+
+// A dark, noisy 320x240 frame with two lit targets
+cv::Mat MakeFrame(std::mt19937& rng) {
+  cv::Mat frame(240, 320, CV_8UC3);
+  cv::randu(frame, cv::Scalar::all(0), cv::Scalar::all(60));
+  std::uniform_int_distribution<int> offset(-20, 20);
+  for (int i = 0; i < 2; ++i) {
+    cv::Point center(110 + i * 100 + offset(rng), 120 + offset(rng));
+    cv::RotatedRect rect(center, cv::Size2f(20, 50), i == 0 ? 14 : -14);
+    cv::Point2f corners[4];
+    rect.points(corners);
+    std::vector<cv::Point> polygon(corners, corners + 4);
+    cv::fillConvexPoly(frame, polygon, cv::Scalar(40, 230, 60));
+  }
+  return frame;
+}
+
+// Packs a BGR image as YUYV, averaging the chroma of each pixel pair
+std::vector<char> ToYUYV(const cv::Mat& bgr) {
+  cv::Mat ycrcb;
+  cv::cvtColor(bgr, ycrcb, cv::COLOR_BGR2YCrCb);
+  std::vector<char> yuyv(ycrcb.rows * (ycrcb.cols & ~1) * 2);
+  char* out = yuyv.data();
+  for (int y = 0; y < ycrcb.rows; ++y) {
+    const uint8_t* row = ycrcb.ptr<uint8_t>(y);
+    for (int x = 0; x + 1 < ycrcb.cols; x += 2) {
+      const uint8_t* p = row + x * 3;
+      *out++ = p[0];
+      *out++ = (p[2] + p[5] + 1) / 2;
+      *out++ = p[3];
+      *out++ = (p[1] + p[4] + 1) / 2;
+    }
+  }
+  return yuyv;
+}
+
+template <typename F>
+void Run(const wpi::Twine& name, int frames, F&& func) {
+  size_t targets = 0;
+  uint64_t start = wpi::Now();
+  for (int i = 0; i < kIterations; ++i) targets += func(i % frames);
+  uint64_t elapsed = wpi::Now() - start;
+  wpi::outs() << name << ": "
+              << wpi::format("%.1f", elapsed / static_cast<double>(kIterations))
+              << " us/frame, "
+              << wpi::format("%.2f",
+                             targets / static_cast<double>(kIterations))
+              << " targets/frame\n";
+  wpi::outs().flush();
+}
+
+// Bounding boxes as (y, x, width, height), sorted
+using Box = std::tuple<int, int, int, int>;
+
+std::vector<Box> Boxes(const std::vector<cv::Rect>& rects) {
+  std::vector<Box> boxes;
+  for (auto&& rect : rects)
+    boxes.emplace_back(rect.y, rect.x, rect.width, rect.height);
+  std::sort(boxes.begin(), boxes.end());
+  return boxes;
+}
+
+std::vector<Box> Boxes(
+    const std::vector<frc::RetroreflectiveTargetPipeline::Target>& targets) {
+  std::vector<Box> boxes;
+  for (auto&& target : targets)
+    boxes.emplace_back(target.y, target.x, target.width, target.height);
+  std::sort(boxes.begin(), boxes.end());
+  return boxes;
+}
+
+void PrintBoxes(const wpi::Twine& name, const std::vector<Box>& boxes) {
+  wpi::outs() << "  " << name << ':';
+  for (auto&& box : boxes) {
+    wpi::outs() << ' ' << std::get<2>(box) << 'x' << std::get<3>(box) << '+'
+                << std::get<1>(box) << '+' << std::get<0>(box);
+  }
+  wpi::outs() << '\n';
+}
+
+// Compares the bounding boxes of the targets found by the OpenCV pipeline and
+// by func on every frame, printing the frames that differ.  Returns the number
+// of frames that differ.
+template <typename F>
+int Compare(const wpi::Twine& name, const std::vector<cv::Mat>& frames,
+            OpenCVPipeline& opencv, F&& func) {
+  int differ = 0;
+  for (size_t i = 0; i < frames.size(); ++i) {
+    opencv.Process(frames[i]);
+    auto expected = Boxes(opencv.GetTargets());
+    auto actual = Boxes(func(i));
+    if (actual == expected) continue;
+    if (++differ <= 3) {
+      wpi::outs() << name << " frame " << i << " differs\n";
+      PrintBoxes("OpenCV", expected);
+      PrintBoxes(name, actual);
+    }
+  }
+  wpi::outs() << name << ": targets match OpenCV on "
+              << (frames.size() - differ) << " of " << frames.size()
+              << " frames\n";
+  wpi::outs().flush();
+  return differ;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::vector<cv::Mat> frames;
+  for (int i = 1; i < argc; ++i) {
+    cv::Mat frame = cv::imread(argv[i], cv::IMREAD_COLOR);
+    if (frame.empty()) {
+      wpi::errs() << "could not read " << argv[i] << '\n';
+      return 1;
+    }
+    frames.emplace_back(std::move(frame));
+  }
+  if (frames.empty()) {
+    std::mt19937 rng(1234);
+    for (int i = 0; i < 16; ++i) frames.emplace_back(MakeFrame(rng));
+  }
+
+  std::vector<std::vector<char>> yuyvFrames;
+  std::vector<CS_RawFrame> rawFrames;
+  for (const auto& frame : frames) yuyvFrames.emplace_back(ToYUYV(frame));
+  for (size_t i = 0; i < frames.size(); ++i) {
+    auto& data = yuyvFrames[i];
+    int size = static_cast<int>(data.size());
+    rawFrames.push_back({data.data(), size, CS_PIXFMT_YUYV,
+                         frames[i].cols & ~1, frames[i].rows, size});
+  }
+
+  int count = static_cast<int>(frames.size());
+  wpi::outs() << count << " frames of " << frames[0].cols << 'x'
+              << frames[0].rows << '\n';
+
+  frc::RetroreflectiveTargetPipeline pipeline;
+  OpenCVPipeline opencv{pipeline.GetThreshold(), 20};
+
+  Run("OpenCV BGR", count, [&](int i) { return opencv.Process(frames[i]); });
+  Run("Fused BGR", count, [&](int i) {
+    pipeline.Process(frames[i]);
+    return pipeline.GetTargets().size();
+  });
+  Run("Fused YUYV", count, [&](int i) {
+    pipeline.Process(rawFrames[i]);
+    return pipeline.GetTargets().size();
+  });
+
+  // contourArea() and the fused pipeline's pixel count measure area
+  // differently, so compare with every blob kept
+  frc::RetroreflectiveTargetPipeline::Filter all;
+  all.minArea = 0;
+  all.maxTargets = 1 << 30;
+  pipeline.SetFilter(all);
+  OpenCVPipeline unfiltered{pipeline.GetThreshold(), 0};
+
+  int differ = Compare("Fused BGR", frames, unfiltered, [&](size_t i) {
+    pipeline.Process(frames[i]);
+    return pipeline.GetTargets();
+  });
+  // YUYV chroma is shared by pixel pairs, so boxes may differ at the edges
+  Compare("Fused YUYV", frames, unfiltered, [&](size_t i) {
+    pipeline.Process(rawFrames[i]);
+    return pipeline.GetTargets();
+  });
+  return differ == 0 ? 0 : 1;
+}
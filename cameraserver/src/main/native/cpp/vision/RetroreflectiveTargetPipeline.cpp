@@ -0,0 +1,329 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include "vision/RetroreflectiveTargetPipeline.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
+
+#include <opencv2/core/mat.hpp>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+using namespace frc;
+
+namespace {
+
+// Written without branches so the scalar loops can be auto-vectorized
+inline uint8_t InRange(int value, int minimum, int maximum) {
+  return static_cast<uint8_t>(-((value >= minimum) & (value <= maximum)));
+}
+
+// BT.601, as for cv::COLOR_BGR2YCrCb but with 8 bit fixed point coefficients
+// so the SIMD version can work in 16 bits
+inline void ToYCbCr(int b, int g, int r, int* y, int* cb, int* cr) {
+  *y = (r * 77 + g * 150 + b * 29 + 128) >> 8;
+  *cr = std::min(std::max(((r - *y) * 365 >> 9) + 128, 0), 255);
+  *cb = std::min(std::max(((b - *y) * 289 >> 9) + 128, 0), 255);
+}
+
+#ifdef __SSE2__
+// The bytes of one YUYV pixel pair with both Y equal
+inline int PackYUYV(uint32_t y, uint32_t u, uint32_t v) {
+  return static_cast<int>(y | (u << 8) | (y << 16) | (v << 24));
+}
+
+// 0xFF in each byte of value that is within [minimum, maximum]
+inline __m128i InRange(__m128i value, __m128i minimum, __m128i maximum) {
+  return _mm_and_si128(
+      _mm_cmpeq_epi8(_mm_max_epu8(value, minimum), value),
+      _mm_cmpeq_epi8(_mm_min_epu8(value, maximum), value));
+}
+#endif
+
+}  // namespace
+
+RetroreflectiveTargetPipeline::RetroreflectiveTargetPipeline(
+    const Threshold& threshold, const Filter& filter)
+    : m_threshold(threshold), m_filter(filter) {}
+
+void RetroreflectiveTargetPipeline::Process(cv::Mat& mat) {
+  if (mat.empty() || mat.type() != CV_8UC3) {
+    m_targets.clear();
+    return;
+  }
+  Detect(mat.ptr<uint8_t>(0), mat.cols, mat.rows,
+         static_cast<int>(mat.step[0]), Format::kBGR);
+}
+
+void RetroreflectiveTargetPipeline::Process(const CS_RawFrame& frame) {
+  Format format;
+  int stride;
+  switch (frame.pixelFormat) {
+    case CS_PIXFMT_YUYV:
+      format = Format::kYUYV;
+      stride = frame.width * 2;
+      break;
+    case CS_PIXFMT_BGR:
+      format = Format::kBGR;
+      stride = frame.width * 3;
+      break;
+    case CS_PIXFMT_GRAY:
+      format = Format::kGray;
+      stride = frame.width;
+      break;
+    default:
+      m_targets.clear();
+      return;
+  }
+  if (!frame.data || frame.width <= 0 || frame.height <= 0 ||
+      frame.totalData < stride * frame.height) {
+    m_targets.clear();
+    return;
+  }
+  Detect(reinterpret_cast<const uint8_t*>(frame.data), frame.width,
+         frame.height, stride, format);
+}
+
+void RetroreflectiveTargetPipeline::Detect(const uint8_t* data, int width,
+                                           int height, int stride,
+                                           Format format) {
+  m_mask.resize(width);
+  m_blobs.clear();
+  m_prevRuns.clear();
+  for (int y = 0; y < height; ++y) {
+    ThresholdRow(data + static_cast<ptrdiff_t>(y) * stride, width, format);
+    LabelRow(y);
+    std::swap(m_runs, m_prevRuns);
+  }
+  CollectTargets();
+}
+
+void RetroreflectiveTargetPipeline::ThresholdRow(const uint8_t* row,
+                                                 int width, Format format) {
+  const Threshold& t = m_threshold;
+  uint8_t* mask = m_mask.data();
+  int x = 0;
+#ifdef __SSE2__
+  int simdWidth = m_simd ? width : 0;
+#endif
+
+  switch (format) {
+    case Format::kYUYV: {
+#ifdef __SSE2__
+      // Each 16 bytes hold 8 pixels as Y0 U Y1 V groups
+      const __m128i minimum =
+          _mm_set1_epi32(PackYUYV(t.minY, t.minCb, t.minCr));
+      const __m128i maximum =
+          _mm_set1_epi32(PackYUYV(t.maxY, t.maxCb, t.maxCr));
+      const __m128i uvMask = _mm_set1_epi32(0x0000FF00);
+      const __m128i yMask = _mm_set1_epi32(0x00FF00FF);
+      for (; x + 8 <= simdWidth; x += 8) {
+        __m128i pass = InRange(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + x * 2)),
+            minimum, maximum);
+        // Combine U and V into byte 1 of each group, then copy it to bytes 0
+        // and 2 so it can be applied to both Y
+        __m128i uv = _mm_and_si128(
+            _mm_and_si128(pass, _mm_srli_epi32(pass, 16)), uvMask);
+        uv = _mm_or_si128(
+            uv, _mm_or_si128(_mm_srli_epi32(uv, 8), _mm_slli_epi32(uv, 8)));
+        // Bytes 0 and 2 of each group are now the pixel results; pack them
+        __m128i pixels = _mm_and_si128(_mm_and_si128(pass, uv), yMask);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(mask + x),
+                         _mm_packus_epi16(pixels, pixels));
+      }
+#endif
+      for (; x + 2 <= width; x += 2) {
+        const uint8_t* p = row + x * 2;
+        uint8_t uv = InRange(p[1], t.minCb, t.maxCb) &
+                     InRange(p[3], t.minCr, t.maxCr);
+        mask[x] = uv & InRange(p[0], t.minY, t.maxY);
+        mask[x + 1] = uv & InRange(p[2], t.minY, t.maxY);
+      }
+      if (x < width) mask[x] = 0;  // YUYV frames should be even width
+      break;
+    }
+    case Format::kBGR: {
+#ifdef __SSE2__
+      const __m128i minY = _mm_set1_epi8(static_cast<char>(t.minY));
+      const __m128i maxY = _mm_set1_epi8(static_cast<char>(t.maxY));
+      const __m128i minCb = _mm_set1_epi8(static_cast<char>(t.minCb));
+      const __m128i maxCb = _mm_set1_epi8(static_cast<char>(t.maxCb));
+      const __m128i minCr = _mm_set1_epi8(static_cast<char>(t.minCr));
+      const __m128i maxCr = _mm_set1_epi8(static_cast<char>(t.maxCr));
+      const __m128i half = _mm_set1_epi16(128);
+      for (; x + 8 <= simdWidth; x += 8) {
+        const uint8_t* p = row + x * 3;
+        __m128i b = _mm_set_epi16(p[21], p[18], p[15], p[12], p[9], p[6],
+                                  p[3], p[0]);
+        __m128i g = _mm_set_epi16(p[22], p[19], p[16], p[13], p[10], p[7],
+                                  p[4], p[1]);
+        __m128i r = _mm_set_epi16(p[23], p[20], p[17], p[14], p[11], p[8],
+                                  p[5], p[2]);
+        // The sum fits in 16 bits unsigned
+        __m128i yv = _mm_srli_epi16(
+            _mm_add_epi16(
+                _mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(77)),
+                              _mm_mullo_epi16(g, _mm_set1_epi16(150))),
+                _mm_add_epi16(_mm_mullo_epi16(b, _mm_set1_epi16(29)), half)),
+            8);
+        // (difference << 7) * coefficient >> 16 is difference * coefficient
+        // >> 9 without overflowing
+        __m128i cr = _mm_add_epi16(
+            _mm_mulhi_epi16(_mm_slli_epi16(_mm_sub_epi16(r, yv), 7),
+                            _mm_set1_epi16(365)),
+            half);
+        __m128i cb = _mm_add_epi16(
+            _mm_mulhi_epi16(_mm_slli_epi16(_mm_sub_epi16(b, yv), 7),
+                            _mm_set1_epi16(289)),
+            half);
+        // Packing saturates to 0-255; only the low 8 bytes are used
+        __m128i pass = _mm_and_si128(
+            InRange(_mm_packus_epi16(yv, yv), minY, maxY),
+            _mm_and_si128(InRange(_mm_packus_epi16(cb, cb), minCb, maxCb),
+                          InRange(_mm_packus_epi16(cr, cr), minCr, maxCr)));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(mask + x), pass);
+      }
+#endif
+      for (; x < width; ++x) {
+        const uint8_t* p = row + x * 3;
+        int yv, cb, cr;
+        ToYCbCr(p[0], p[1], p[2], &yv, &cb, &cr);
+        mask[x] = InRange(yv, t.minY, t.maxY) & InRange(cb, t.minCb, t.maxCb) &
+                  InRange(cr, t.minCr, t.maxCr);
+      }
+      break;
+    }
+    case Format::kGray: {
+#ifdef __SSE2__
+      const __m128i minimum = _mm_set1_epi8(static_cast<char>(t.minY));
+      const __m128i maximum = _mm_set1_epi8(static_cast<char>(t.maxY));
+      for (; x + 16 <= simdWidth; x += 16) {
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(mask + x),
+            InRange(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row + x)),
+                    minimum, maximum));
+      }
+#endif
+      for (; x < width; ++x) mask[x] = InRange(row[x], t.minY, t.maxY);
+      break;
+    }
+  }
+}
+
+void RetroreflectiveTargetPipeline::LabelRow(int y) {
+  // Split the row into runs of passing pixels, skipping 8 pixels at a time
+  // through stretches that are all one way
+  const uint8_t* mask = m_mask.data();
+  int width = static_cast<int>(m_mask.size());
+  m_runs.clear();
+  int x = 0;
+  while (x < width) {
+    uint64_t word;
+    for (; x + 8 <= width; x += 8) {
+      memcpy(&word, mask + x, 8);
+      if (word != 0) break;
+    }
+    while (x < width && !mask[x]) ++x;
+    if (x >= width) break;
+    int start = x;
+    for (; x + 8 <= width; x += 8) {
+      memcpy(&word, mask + x, 8);
+      if (word != ~uint64_t{0}) break;
+    }
+    while (x < width && mask[x]) ++x;
+    m_runs.push_back({start, x, -1});
+  }
+
+  // Join each run to the blobs of the runs it touches (including diagonally)
+  // in the previous row
+  size_t first = 0;
+  for (auto& run : m_runs) {
+    while (first < m_prevRuns.size() && m_prevRuns[first].end < run.start)
+      ++first;
+    for (size_t i = first;
+         i < m_prevRuns.size() && m_prevRuns[i].start <= run.end; ++i) {
+      int blob = FindBlob(m_prevRuns[i].blob);
+      if (run.blob == -1) {
+        run.blob = blob;
+      } else if (blob != run.blob) {
+        MergeBlobs(run.blob, blob);
+      }
+    }
+
+    int length = run.end - run.start;
+    if (run.blob == -1) {
+      run.blob = static_cast<int>(m_blobs.size());
+      m_blobs.push_back(
+          {run.blob, 0, run.start, run.end - 1, y, y, 0, 0});
+    }
+    Blob& blob = m_blobs[run.blob];
+    blob.area += length;
+    blob.minX = std::min(blob.minX, run.start);
+    blob.maxX = std::max(blob.maxX, run.end - 1);
+    blob.maxY = y;
+    blob.sumX += static_cast<int64_t>(run.start + run.end - 1) * length / 2;
+    blob.sumY += static_cast<int64_t>(y) * length;
+  }
+}
+
+int RetroreflectiveTargetPipeline::FindBlob(int blob) {
+  while (m_blobs[blob].parent != blob) {
+    m_blobs[blob].parent = m_blobs[m_blobs[blob].parent].parent;
+    blob = m_blobs[blob].parent;
+  }
+  return blob;
+}
+
+void RetroreflectiveTargetPipeline::MergeBlobs(int a, int b) {
+  // a and b are roots; b is folded into a
+  Blob& into = m_blobs[a];
+  Blob& from = m_blobs[b];
+  from.parent = a;
+  into.area += from.area;
+  into.minX = std::min(into.minX, from.minX);
+  into.maxX = std::max(into.maxX, from.maxX);
+  into.minY = std::min(into.minY, from.minY);
+  into.maxY = std::max(into.maxY, from.maxY);
+  into.sumX += from.sumX;
+  into.sumY += from.sumY;
+}
+
+void RetroreflectiveTargetPipeline::CollectTargets() {
+  m_targets.clear();
+  for (size_t i = 0; i < m_blobs.size(); ++i) {
+    const Blob& blob = m_blobs[i];
+    if (blob.parent != static_cast<int>(i)) continue;
+    if (blob.area < m_filter.minArea || blob.area > m_filter.maxArea) continue;
+    int width = blob.maxX - blob.minX + 1;
+    int height = blob.maxY - blob.minY + 1;
+    double aspectRatio = static_cast<double>(width) / height;
+    if (aspectRatio < m_filter.minAspectRatio ||
+        aspectRatio > m_filter.maxAspectRatio)
+      continue;
+    if (blob.area < m_filter.minFill * width * height) continue;
+    m_targets.push_back({blob.minX, blob.minY, width, height,
+                         static_cast<double>(blob.sumX) / blob.area,
+                         static_cast<double>(blob.sumY) / blob.area,
+                         blob.area});
+  }
+
+  std::sort(m_targets.begin(), m_targets.end(),
+            [](const Target& a, const Target& b) {
+              if (a.area != b.area) return a.area > b.area;
+              if (a.y != b.y) return a.y < b.y;
+              return a.x < b.x;
+            });
+  if (m_targets.size() > static_cast<size_t>(std::max(m_filter.maxTargets, 0)))
+    m_targets.resize(std::max(m_filter.maxTargets, 0));
+}
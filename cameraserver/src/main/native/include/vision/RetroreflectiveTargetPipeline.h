@@ -0,0 +1,156 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "cscore_raw.h"
+#include "vision/VisionPipeline.h"
+
+namespace frc {
+
+/**
+ * A ready-made pipeline that finds lit retroreflective targets.
+ *
+ * Each frame goes through a single pass that thresholds pixels on their
+ * YCbCr value, groups the pixels that pass into 8-connected blobs and
+ * accumulates each blob's area, bounding box and centroid.  Blobs are then
+ * filtered on their size and shape.  This does the same job as the common
+ * cvtColor, inRange, findContours and filter chain, but without any full frame
+ * intermediate images.
+ *
+ * Thresholding uses SIMD instructions where available.  YUYV frames are
+ * thresholded without any color conversion, so with a camera set to a YUYV
+ * video mode the fastest way to run this is from a RawSink callback, leaving
+ * the frame's pixel format unknown so frames arrive in the camera's format.
+ *
+ * @see VisionRunner
+ */
+class RetroreflectiveTargetPipeline : public VisionPipeline {
+ public:
+  /**
+   * Inclusive ranges of YCbCr values that pass the threshold.  The defaults
+   * pass the bright green of a typical LED ring.
+   */
+  struct Threshold {
+    uint8_t minY = 64;
+    uint8_t maxY = 255;
+    uint8_t minCb = 0;
+    uint8_t maxCb = 112;
+    uint8_t minCr = 0;
+    uint8_t maxCr = 112;
+  };
+
+  /**
+   * Limits on the blobs reported as targets.
+   */
+  struct Filter {
+    /// Minimum number of pixels in a target.
+    int minArea = 20;
+    /// Maximum number of pixels in a target.
+    int maxArea = 1 << 30;
+    /// Minimum bounding box width divided by height.
+    double minAspectRatio = 0;
+    /// Maximum bounding box width divided by height.
+    double maxAspectRatio = 1000;
+    /// Minimum fraction of the bounding box the target covers.
+    double minFill = 0;
+    /// Maximum number of targets reported; the largest are kept.
+    int maxTargets = 16;
+  };
+
+  /**
+   * A blob that passed the filter.  Coordinates are in pixels from the top
+   * left corner of the image.
+   */
+  struct Target {
+    int x;
+    int y;
+    int width;
+    int height;
+    double centerX;
+    double centerY;
+    int area;
+  };
+
+  RetroreflectiveTargetPipeline() = default;
+  RetroreflectiveTargetPipeline(const Threshold& threshold,
+                                const Filter& filter);
+
+  void SetThreshold(const Threshold& threshold) { m_threshold = threshold; }
+  const Threshold& GetThreshold() const { return m_threshold; }
+
+  void SetFilter(const Filter& filter) { m_filter = filter; }
+  const Filter& GetFilter() const { return m_filter; }
+
+  /**
+   * Finds the targets in a BGR image.  Images of any other type produce no
+   * targets.
+   */
+  void Process(cv::Mat& mat) override;
+
+  /**
+   * Finds the targets in a YUYV, BGR or grayscale frame.  A grayscale frame
+   * is only thresholded on Y.  Frames of any other format produce no
+   * targets.
+   */
+  void Process(const CS_RawFrame& frame);
+
+  /**
+   * Gets the targets found by the last call to Process(), largest first.
+   */
+  const std::vector<Target>& GetTargets() const { return m_targets; }
+
+ private:
+  friend class RetroreflectiveTargetPipelineTest;
+
+  enum class Format { kYUYV, kBGR, kGray };
+
+  // A horizontal run of passing pixels [start, end) in one row
+  struct Run {
+    int start;
+    int end;
+    int blob;
+  };
+
+  struct Blob {
+    int parent;
+    int area;
+    int minX;
+    int maxX;
+    int minY;
+    int maxY;
+    int64_t sumX;
+    int64_t sumY;
+  };
+
+  void Detect(const uint8_t* data, int width, int height, int stride,
+              Format format);
+  void ThresholdRow(const uint8_t* row, int width, Format format);
+  void LabelRow(int y);
+  int FindBlob(int blob);
+  void MergeBlobs(int a, int b);
+  void CollectTargets();
+
+  Threshold m_threshold;
+  Filter m_filter;
+  std::vector<Target> m_targets;
+
+  // Working storage, kept between frames to avoid reallocation
+  std::vector<uint8_t> m_mask;
+  std::vector<Run> m_runs;
+  std::vector<Run> m_prevRuns;
+  std::vector<Blob> m_blobs;
+
+  // Cleared by tests to check the SIMD thresholds against the scalar ones
+  bool m_simd = true;
+};
+
+}  // namespace frc
@@ -0,0 +1,310 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include "vision/RetroreflectiveTargetPipeline.h"  // NOLINT(build/include_order)
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <opencv2/core/core.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+
+#include "gtest/gtest.h"
+
+namespace frc {
+
+namespace {
+
+// A synthetic frame.  Lit pixels are the bright green of an LED ring target
+// and pass the default threshold; the rest are dark and don't.
+class Frame {
+ public:
+  Frame(int width, int height)
+      : m_width(width), m_height(height), m_lit(width * height) {}
+
+  void Set(int x, int y) { m_lit[y * m_width + x] = 1; }
+
+  void Fill(int x, int y, int width, int height) {
+    for (int j = y; j < y + height; ++j) {
+      for (int i = x; i < x + width; ++i) Set(i, j);
+    }
+  }
+
+  // Converts to the given pixel format.  The frame refers to data owned by
+  // this object.
+  CS_RawFrame Raw(int pixelFormat) {
+    int bytesPerPixel = 2;
+    if (pixelFormat == CS_PIXFMT_BGR) bytesPerPixel = 3;
+    if (pixelFormat == CS_PIXFMT_GRAY) bytesPerPixel = 1;
+    m_data.resize(m_width * m_height * bytesPerPixel);
+    uint8_t* out = reinterpret_cast<uint8_t*>(m_data.data());
+    for (int i = 0; i < m_width * m_height; ++i) {
+      bool lit = m_lit[i] != 0;
+      switch (pixelFormat) {
+        case CS_PIXFMT_BGR:
+          *out++ = lit ? 40 : 20;
+          *out++ = lit ? 230 : 20;
+          *out++ = lit ? 60 : 20;
+          break;
+        case CS_PIXFMT_GRAY:
+          *out++ = lit ? 230 : 20;
+          break;
+        default:
+          // Chroma is shared by each pixel pair, so only Y tells them apart
+          *out++ = lit ? 180 : 16;
+          *out++ = 60;
+          break;
+      }
+    }
+    int size = static_cast<int>(m_data.size());
+    return {m_data.data(), size, pixelFormat, m_width, m_height, size};
+  }
+
+  cv::Mat ToMat() {
+    CS_RawFrame frame = Raw(CS_PIXFMT_BGR);
+    return cv::Mat(m_height, m_width, CV_8UC3, frame.data).clone();
+  }
+
+ private:
+  int m_width;
+  int m_height;
+  std::vector<uint8_t> m_lit;
+  std::vector<char> m_data;
+};
+
+using Box = std::tuple<int, int, int, int>;
+
+std::vector<Box> Boxes(
+    const std::vector<RetroreflectiveTargetPipeline::Target>& targets) {
+  std::vector<Box> boxes;
+  for (auto&& target : targets)
+    boxes.emplace_back(target.y, target.x, target.width, target.height);
+  std::sort(boxes.begin(), boxes.end());
+  return boxes;
+}
+
+}  // namespace
+
+class RetroreflectiveTargetPipelineTest : public ::testing::Test {
+ protected:
+  using Format = RetroreflectiveTargetPipeline::Format;
+  using Threshold = RetroreflectiveTargetPipeline::Threshold;
+  using Filter = RetroreflectiveTargetPipeline::Filter;
+
+  // Thresholds one row with either the SIMD or the scalar code
+  std::vector<uint8_t> ThresholdRow(const std::vector<uint8_t>& row,
+                                    int width, Format format, bool simd) {
+    m_pipeline.m_simd = simd;
+    m_pipeline.m_mask.assign(width, 0x55);
+    m_pipeline.ThresholdRow(row.data(), width, format);
+    m_pipeline.m_simd = true;
+    return m_pipeline.m_mask;
+  }
+
+  // Finds the targets, accepting blobs of any size and shape
+  std::vector<Box> Process(Frame& frame, int pixelFormat) {
+    Filter filter;
+    filter.minArea = 1;
+    filter.maxTargets = 1000;
+    m_pipeline.SetFilter(filter);
+    m_pipeline.Process(frame.Raw(pixelFormat));
+    return Boxes(m_pipeline.GetTargets());
+  }
+
+  RetroreflectiveTargetPipeline m_pipeline;
+};
+
+TEST_F(RetroreflectiveTargetPipelineTest, SimdMatchesScalar) {
+  struct {
+    Format format;
+    int bytesPerPixel;
+  } formats[] = {{Format::kYUYV, 2}, {Format::kBGR, 3}, {Format::kGray, 1}};
+
+  // The defaults, and a threshold with both ends of every range inside 0-255
+  Threshold thresholds[2];
+  thresholds[1] = {100, 200, 60, 180, 60, 180};
+
+  std::mt19937 rng(1234);
+  std::uniform_int_distribution<int> byte(0, 255);
+  for (auto&& threshold : thresholds) {
+    m_pipeline.SetThreshold(threshold);
+    for (auto&& f : formats) {
+      // Widths that aren't multiples of 8 or 16 go through the scalar tails
+      for (int width = 1; width <= 40; ++width) {
+        for (int i = 0; i < 20; ++i) {
+          std::vector<uint8_t> row(width * f.bytesPerPixel);
+          for (auto&& value : row) value = byte(rng);
+          auto scalar = ThresholdRow(row, width, f.format, false);
+          ASSERT_EQ(scalar, ThresholdRow(row, width, f.format, true))
+              << "format " << static_cast<int>(f.format) << " width "
+              << width;
+          for (auto value : scalar) ASSERT_TRUE(value == 0 || value == 0xFF);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(RetroreflectiveTargetPipelineTest, Formats) {
+  // An odd width, so the SIMD loops leave a tail
+  Frame frame(61, 48);
+  frame.Fill(10, 8, 12, 20);
+  frame.Fill(40, 30, 9, 5);
+
+  for (int pixelFormat : {CS_PIXFMT_YUYV, CS_PIXFMT_BGR, CS_PIXFMT_GRAY}) {
+    SCOPED_TRACE(pixelFormat);
+    m_pipeline.Process(frame.Raw(pixelFormat));
+    auto& targets = m_pipeline.GetTargets();
+    ASSERT_EQ(2u, targets.size());
+    EXPECT_EQ(10, targets[0].x);
+    EXPECT_EQ(8, targets[0].y);
+    EXPECT_EQ(12, targets[0].width);
+    EXPECT_EQ(20, targets[0].height);
+    EXPECT_EQ(240, targets[0].area);
+    EXPECT_DOUBLE_EQ(15.5, targets[0].centerX);
+    EXPECT_DOUBLE_EQ(17.5, targets[0].centerY);
+    EXPECT_EQ(40, targets[1].x);
+    EXPECT_EQ(30, targets[1].y);
+    EXPECT_EQ(45, targets[1].area);
+  }
+
+  cv::Mat mat = frame.ToMat();
+  m_pipeline.Process(mat);
+  EXPECT_EQ(2u, m_pipeline.GetTargets().size());
+
+  // Other formats produce no targets
+  m_pipeline.Process(frame.Raw(CS_PIXFMT_MJPEG));
+  EXPECT_TRUE(m_pipeline.GetTargets().empty());
+}
+
+TEST_F(RetroreflectiveTargetPipelineTest, DiagonalBlobsMerge) {
+  // Squares touching only at a corner, both ways round
+  Frame down(32, 32);
+  down.Fill(2, 2, 4, 4);
+  down.Fill(6, 6, 4, 4);
+  EXPECT_EQ(std::vector<Box>{Box(2, 2, 8, 8)},
+            Process(down, CS_PIXFMT_GRAY));
+
+  Frame up(32, 32);
+  up.Fill(6, 2, 4, 4);
+  up.Fill(2, 6, 4, 4);
+  EXPECT_EQ(std::vector<Box>{Box(2, 2, 8, 8)}, Process(up, CS_PIXFMT_GRAY));
+
+  // A V shape whose arms are only joined at the bottom, after each arm has
+  // become a blob of its own
+  Frame v(32, 32);
+  for (int i = 0; i < 10; ++i) {
+    v.Set(5 + i, 5 + i);
+    v.Set(25 - i, 5 + i);
+  }
+  v.Set(15, 15);
+  EXPECT_EQ(std::vector<Box>{Box(5, 5, 21, 11)}, Process(v, CS_PIXFMT_GRAY));
+  EXPECT_EQ(21, m_pipeline.GetTargets()[0].area);
+
+  // Pixels one apart aren't connected
+  Frame apart(32, 32);
+  apart.Set(4, 4);
+  apart.Set(6, 6);
+  EXPECT_EQ(2u, Process(apart, CS_PIXFMT_GRAY).size());
+}
+
+TEST_F(RetroreflectiveTargetPipelineTest, Filters) {
+  Frame frame(120, 40);
+  frame.Fill(2, 2, 3, 3);     // small: area 9
+  frame.Fill(10, 2, 20, 4);   // wide: aspect 5
+  frame.Fill(40, 2, 8, 8);    // square: area 64
+  frame.Fill(60, 2, 12, 1);   // hollow: fill 44 / 144
+  frame.Fill(60, 13, 12, 1);
+  frame.Fill(60, 3, 1, 10);
+  frame.Fill(71, 3, 1, 10);
+  CS_RawFrame raw = frame.Raw(CS_PIXFMT_GRAY);
+
+  auto xs = [&](const Filter& filter) {
+    m_pipeline.SetFilter(filter);
+    m_pipeline.Process(raw);
+    std::vector<int> x;
+    for (auto&& target : m_pipeline.GetTargets()) x.push_back(target.x);
+    std::sort(x.begin(), x.end());
+    return x;
+  };
+
+  Filter filter;
+  filter.minArea = 1;
+  EXPECT_EQ((std::vector<int>{2, 10, 40, 60}), xs(filter));
+
+  Filter area = filter;
+  area.minArea = 10;
+  area.maxArea = 64;
+  EXPECT_EQ((std::vector<int>{40, 60}), xs(area));
+
+  Filter aspect = filter;
+  aspect.minAspectRatio = 0.5;
+  aspect.maxAspectRatio = 2;
+  EXPECT_EQ((std::vector<int>{2, 40, 60}), xs(aspect));
+
+  Filter fill = filter;
+  fill.minFill = 0.5;
+  EXPECT_EQ((std::vector<int>{2, 10, 40}), xs(fill));
+
+  // The largest are kept
+  Filter count = filter;
+  count.maxTargets = 2;
+  EXPECT_EQ((std::vector<int>{10, 40}), xs(count));
+}
+
+TEST_F(RetroreflectiveTargetPipelineTest, MatchesOpenCV) {
+  std::mt19937 rng(5678);
+  std::uniform_int_distribution<int> width(1, 8);
+  std::uniform_int_distribution<int> height(1, 14);
+  std::uniform_int_distribution<int> slant(-2, 2);
+
+  for (int n = 0; n < 10; ++n) {
+    // Slanted bars and specks, one to each 24x20 cell so they don't touch or
+    // nest (nested blobs would be dropped by RETR_EXTERNAL)
+    Frame frame(195, 121);
+    for (int cellY = 0; cellY < 6; ++cellY) {
+      for (int cellX = 0; cellX < 8; ++cellX) {
+        int w = width(rng);
+        int h = height(rng);
+        int dx = slant(rng);
+        // Each row moves at most one pixel, so the bar stays connected
+        for (int j = 0; j < h; ++j) {
+          frame.Fill(cellX * 24 + 7 + dx * j / 4, cellY * 20 + 3 + j, w, 1);
+        }
+      }
+    }
+    cv::Mat bgr = frame.ToMat();
+
+    cv::Mat ycrcb;
+    cv::Mat mask;
+    std::vector<std::vector<cv::Point>> contours;
+    const Threshold& t = m_pipeline.GetThreshold();
+    cv::cvtColor(bgr, ycrcb, cv::COLOR_BGR2YCrCb);
+    cv::inRange(ycrcb, cv::Scalar(t.minY, t.minCr, t.minCb),
+                cv::Scalar(t.maxY, t.maxCr, t.maxCb), mask);
+    cv::findContours(mask, contours, cv::RETR_EXTERNAL,
+                     cv::CHAIN_APPROX_SIMPLE);
+    std::vector<Box> expected;
+    for (auto&& contour : contours) {
+      cv::Rect rect = cv::boundingRect(contour);
+      expected.emplace_back(rect.y, rect.x, rect.width, rect.height);
+    }
+    std::sort(expected.begin(), expected.end());
+    ASSERT_EQ(48u, expected.size());
+
+    EXPECT_EQ(expected, Process(frame, CS_PIXFMT_BGR));
+    EXPECT_EQ(expected, Process(frame, CS_PIXFMT_YUYV));
+    m_pipeline.Process(bgr);
+    EXPECT_EQ(expected, Boxes(m_pipeline.GetTargets()));
+  }
+}
+
+}  // namespace frc
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -203,7 +203,14 @@ public class CameraServerJNI {
   //
   public enum TelemetryKind {
     kSourceBytesReceived(1),
-    kSourceFramesReceived(2);
+    kSourceFramesReceived(2),
+    kSinkBytesSent(3),
+    kSinkFramesSent(4),
+    kSinkStreamQuality(5),
+    kSinkStreamWidth(6),
+    kSinkStreamHeight(7),
+    kSinkStreamFps(8),
+    kSinkStreamBandwidth(9);
 
     @SuppressWarnings("MemberName")
     private final int value;
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -101,4 +101,26 @@ public class MjpegServer extends VideoSink {
     CameraServerJNI.setProperty(CameraServerJNI.getSinkProperty(m_handle, "default_compression"),
                                 quality);
   }
+
+  /**
+   * Set whether clients that don't specify it get an adaptive stream.
+   *
+   * <p>An adaptive stream estimates each client's throughput from how long
+   * frame writes block, and lowers the JPEG quality, then the resolution,
+   * then the frame rate while frames take longer than maxLatency to send or
+   * the stream exceeds the bandwidth available.  The chosen settings are
+   * reported through telemetry (TelemetryKind.kSinkStream*).
+   *
+   * @param enabled True to enable adaptive streaming
+   * @param maxLatency Maximum time to send a frame, in milliseconds
+   * @param maxBandwidth Maximum bandwidth, in kbit/s, 0 for unlimited
+   */
+  public void setAdaptive(boolean enabled, int maxLatency, int maxBandwidth) {
+    CameraServerJNI.setProperty(CameraServerJNI.getSinkProperty(m_handle, "adaptive"),
+                                enabled ? 1 : 0);
+    CameraServerJNI.setProperty(CameraServerJNI.getSinkProperty(m_handle, "adaptive_latency"),
+                                maxLatency);
+    CameraServerJNI.setProperty(CameraServerJNI.getSinkProperty(m_handle, "adaptive_bandwidth"),
+                                maxBandwidth);
+  }
 }
@@ -0,0 +1,75 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include "AdaptiveRate.h"
+
+#include <algorithm>
+
+using namespace cs;
+
+constexpr AdaptiveRate::Level AdaptiveRate::kLevels[];
+
+AdaptiveRate::AdaptiveRate(int maxLatency, int maxBandwidth)
+    : m_maxLatency(std::max(maxLatency, 1) * 1000),
+      m_maxBandwidth(std::max(maxBandwidth, 0) * 125.0) {}
+
+double AdaptiveRate::GetSendRate() const {
+  if (m_averagePeriod == 0) return 0;
+  return m_averageSize * 1.0e6 / m_averagePeriod;
+}
+
+bool AdaptiveRate::Update(size_t size, uint64_t writeTime, uint64_t period) {
+  if (m_averagePeriod == 0) {
+    m_averageSize = size;
+    m_averagePeriod = period;
+  } else {
+    m_averageSize = 0.75 * m_averageSize + 0.25 * size;
+    m_averagePeriod = 0.75 * m_averagePeriod + 0.25 * period;
+  }
+  double rate = GetSendRate();
+
+  if (writeTime >= kBlockedTime) {
+    double sample = size * 1.0e6 / writeTime;
+    m_bandwidth =
+        m_bandwidth == 0 ? sample : 0.75 * m_bandwidth + 0.25 * sample;
+  } else if (m_bandwidth < rate * kMaxHeadroom) {
+    // The link kept up, so it may have more throughput than last measured;
+    // but only what has actually been sent is known to fit
+    m_bandwidth = std::min(m_bandwidth * 1.02, rate * kMaxHeadroom);
+  }
+
+  if (m_settleFrames > 0) {
+    --m_settleFrames;
+    return false;
+  }
+
+  // Leave some headroom below the estimated throughput so the socket buffer
+  // can drain
+  double budget = m_bandwidth * 0.9;
+  if (m_maxBandwidth != 0 && (budget == 0 || m_maxBandwidth < budget))
+    budget = m_maxBandwidth;
+
+  if (writeTime > m_maxLatency || (budget != 0 && rate > budget)) {
+    m_goodFrames = 0;
+    if (m_level == kNumLevels - 1) return false;
+    ++m_level;
+    m_settleFrames = kSettleFrames;
+    return true;
+  }
+
+  // Only step up if the previous level's larger frames should also fit
+  if (writeTime < m_maxLatency / 4 && (budget == 0 || rate * 1.5 < budget)) {
+    if (++m_goodFrames < kStepUpFrames || m_level == 0) return false;
+    --m_level;
+    m_goodFrames = 0;
+    m_settleFrames = kSettleFrames;
+    return true;
+  }
+
+  m_goodFrames = 0;
+  return false;
+}
@@ -0,0 +1,78 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#ifndef CSCORE_ADAPTIVERATE_H_
+#define CSCORE_ADAPTIVERATE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace cs {
+
+// Steps a stream client's JPEG quality, resolution and frame rate down when
+// its connection can't keep up, and back up once it has recovered.  The
+// connection's throughput is estimated from how long frame writes block on
+// the socket: a write only blocks once the socket buffer is full, at which
+// point it completes at the rate the link drains the buffer.
+class AdaptiveRate {
+ public:
+  struct Level {
+    int quality;     // percentage of the client's JPEG quality
+    int scale;       // resolution divisor
+    int fpsDivisor;  // frame rate divisor
+  };
+
+  // Ordered from best to worst; resolution is only dropped once quality is
+  // already low, and frame rate last of all.
+  static constexpr Level kLevels[] = {{100, 1, 1}, {75, 1, 1}, {50, 1, 1},
+                                      {75, 2, 1},  {50, 2, 1}, {50, 2, 2},
+                                      {50, 4, 2},  {30, 4, 4}};
+  static constexpr int kNumLevels = sizeof(kLevels) / sizeof(kLevels[0]);
+
+  // While writes don't block, the throughput estimate grows towards this
+  // multiple of the rate actually being sent
+  static constexpr double kMaxHeadroom = 2.0;
+
+  // maxLatency is in milliseconds, maxBandwidth in kbit/s (0 for unlimited)
+  AdaptiveRate(int maxLatency, int maxBandwidth);
+
+  // Called after each frame is written, with the time taken to write it and
+  // the time since the previous frame was written (both in microseconds).
+  // Returns true if the level changed.
+  bool Update(size_t size, uint64_t writeTime, uint64_t period);
+
+  const Level& GetLevel() const { return kLevels[m_level]; }
+  int GetLevelIndex() const { return m_level; }
+
+  // Estimated throughput in bytes per second, or 0 if the connection has
+  // not yet limited the stream
+  double GetBandwidth() const { return m_bandwidth; }
+
+  // Average rate being sent in bytes per second
+  double GetSendRate() const;
+
+ private:
+  // Writes that take longer than this have blocked on a full socket buffer
+  static constexpr uint64_t kBlockedTime = 2000;
+  // Frames to wait after a change before judging its effect
+  static constexpr int kSettleFrames = 5;
+  // Consecutive good frames before stepping back up
+  static constexpr int kStepUpFrames = 30;
+
+  uint64_t m_maxLatency;
+  double m_maxBandwidth;
+  double m_bandwidth = 0;
+  double m_averageSize = 0;
+  double m_averagePeriod = 0;
+  int m_level = 0;
+  int m_settleFrames = 0;
+  int m_goodFrames = 0;
+};
+
+}  // namespace cs
+
+#endif  // CSCORE_ADAPTIVERATE_H_
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -11,7 +11,9 @@
 #include <opencv2/highgui/highgui.hpp>
 #include <opencv2/imgproc/imgproc.hpp>
 #include <wpi/SmallString.h>
+#include <wpi/Trace.h>
 
+#include "FrameCallbackPool.h"
 #include "Handle.h"
 #include "Instance.h"
 #include "Log.h"
@@ -23,26 +25,41 @@ using namespace cs;
 
 CvSinkImpl::CvSinkImpl(const wpi::Twine& name, wpi::Logger& logger,
                        Notifier& notifier, Telemetry& telemetry)
-    : SinkImpl{name, logger, notifier, telemetry} {
-  m_active = true;
-  // m_thread = std::thread(&CvSinkImpl::ThreadMain, this);
-}
+    : SinkImpl{name, logger, notifier, telemetry} {}
 
 CvSinkImpl::CvSinkImpl(const wpi::Twine& name, wpi::Logger& logger,
                        Notifier& notifier, Telemetry& telemetry,
+                       FrameCallbackPool& pool,
                        std::function<void(uint64_t time)> processFrame)
-    : SinkImpl{name, logger, notifier, telemetry} {}
+    : SinkImpl{name, logger, notifier, telemetry} {
+  StartCallbacks(pool, [=](Frame& frame) {
+    processFrame(frame ? frame.GetTime() : 0);
+  });
+}
+
+CvSinkImpl::CvSinkImpl(
+    const wpi::Twine& name, wpi::Logger& logger, Notifier& notifier,
+    Telemetry& telemetry, FrameCallbackPool& pool,
+    std::function<void(cv::Mat& image, uint64_t time)> processFrame)
+    : SinkImpl{name, logger, notifier, telemetry} {
+  StartCallbacks(pool, [this, processFrame](Frame& frame) {
+    wpi::TraceScope trace{"CvSink::ProcessFrame"};
+    if (!frame || !frame.GetCv(m_callbackImage)) {
+      processFrame(m_callbackImage, 0);
+      return;
+    }
+    processFrame(m_callbackImage, frame.GetTime());
+  });
+}
 
 CvSinkImpl::~CvSinkImpl() { Stop(); }
 
 void CvSinkImpl::Stop() {
-  m_active = false;
+  // wait for any running callback
+  StopCallbacks();
 
   // wake up any waiters by forcing an empty frame to be sent
   if (auto source = GetSource()) source->Wakeup();
-
-  // join thread
-  if (m_thread.joinable()) m_thread.join();
 }
 
 uint64_t CvSinkImpl::GrabFrame(cv::Mat& image) {
@@ -62,6 +79,7 @@ uint64_t CvSinkImpl::GrabFrame(cv::Mat& image) {
     return 0;  // signal error
   }
 
+  wpi::TraceScope trace{"CvSink::GrabFrame"};
   if (!frame.GetCv(image)) {
     // Shouldn't happen, but just in case...
     std::this_thread::sleep_for(std::chrono::milliseconds(20));
@@ -88,6 +106,7 @@ uint64_t CvSinkImpl::GrabFrame(cv::Mat& image, double timeout) {
     return 0;  // signal error
   }
 
+  wpi::TraceScope trace{"CvSink::GrabFrame"};
   if (!frame.GetCv(image)) {
     // Shouldn't happen, but just in case...
     std::this_thread::sleep_for(std::chrono::milliseconds(20));
@@ -97,29 +116,6 @@ uint64_t CvSinkImpl::GrabFrame(cv::Mat& image, double timeout) {
   return frame.GetTime();
 }
 
-// Send HTTP response and a stream of JPG-frames
-void CvSinkImpl::ThreadMain() {
-  Enable();
-  while (m_active) {
-    auto source = GetSource();
-    if (!source) {
-      // Source disconnected; sleep for one second
-      std::this_thread::sleep_for(std::chrono::seconds(1));
-      continue;
-    }
-    SDEBUG4("waiting for frame");
-    Frame frame = source->GetNextFrame();  // blocks
-    if (!m_active) break;
-    if (!frame) {
-      // Bad frame; sleep for 10 ms so we don't consume all processor time.
-      std::this_thread::sleep_for(std::chrono::milliseconds(10));
-      continue;
-    }
-    // TODO m_processFrame();
-  }
-  Disable();
-}
-
 namespace cs {
 
 CS_Sink CreateCvSink(const wpi::Twine& name, CS_Status* status) {
@@ -134,8 +130,22 @@ CS_Sink CreateCvSinkCallback(const wpi::Twine& name,
                              CS_Status* status) {
   auto& inst = Instance::GetInstance();
   return inst.CreateSink(
-      CS_SINK_CV, std::make_shared<CvSinkImpl>(name, inst.logger, inst.notifier,
-                                               inst.telemetry, processFrame));
+      CS_SINK_CV,
+      std::make_shared<CvSinkImpl>(name, inst.logger, inst.notifier,
+                                   inst.telemetry, inst.frameCallbackPool,
+                                   processFrame));
+}
+
+CS_Sink CreateCvSinkCallback(
+    const wpi::Twine& name,
+    std::function<void(cv::Mat& image, uint64_t time)> processFrame,
+    CS_Status* status) {
+  auto& inst = Instance::GetInstance();
+  return inst.CreateSink(
+      CS_SINK_CV,
+      std::make_shared<CvSinkImpl>(name, inst.logger, inst.notifier,
+                                   inst.telemetry, inst.frameCallbackPool,
+                                   processFrame));
 }
 
 static constexpr unsigned SinkMask = CS_SINK_CV | CS_SINK_RAW;
@@ -197,6 +207,19 @@ void SetSinkEnabled(CS_Sink sink, bool enabled, CS_Status* status) {
   static_cast<CvSinkImpl&>(*data->sink).SetEnabled(enabled);
 }
 
+uint64_t GetSinkDroppedFrameCount(CS_Sink sink, CS_Status* status) {
+  auto data = Instance::GetInstance().GetSink(sink);
+  if (!data || (data->kind & SinkMask) == 0) {
+    *status = CS_INVALID_HANDLE;
+    return 0;
+  }
+  return data->sink->GetDroppedFrameCount();
+}
+
+void SetSinkCallbackThreadCount(int count) {
+  Instance::GetInstance().frameCallbackPool.SetNumThreads(count);
+}
+
 }  // namespace cs
 
 extern "C" {
@@ -251,4 +274,12 @@ void CS_SetSinkEnabled(CS_Sink sink, CS_Bool enabled, CS_Status* status) {
   return cs::SetSinkEnabled(sink, enabled, status);
 }
 
+uint64_t CS_GetSinkDroppedFrameCount(CS_Sink sink, CS_Status* status) {
+  return cs::GetSinkDroppedFrameCount(sink, status);
+}
+
+void CS_SetSinkCallbackThreadCount(int count) {
+  cs::SetSinkCallbackThreadCount(count);
+}
+
 }  // extern "C"
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -23,6 +23,7 @@
 
 namespace cs {
 
+class FrameCallbackPool;
 class SourceImpl;
 
 class CvSinkImpl : public SinkImpl {
@@ -30,8 +31,11 @@ class CvSinkImpl : public SinkImpl {
   CvSinkImpl(const wpi::Twine& name, wpi::Logger& logger, Notifier& notifier,
              Telemetry& telemetry);
   CvSinkImpl(const wpi::Twine& name, wpi::Logger& logger, Notifier& notifier,
-             Telemetry& telemetry,
+             Telemetry& telemetry, FrameCallbackPool& pool,
              std::function<void(uint64_t time)> processFrame);
+  CvSinkImpl(const wpi::Twine& name, wpi::Logger& logger, Notifier& notifier,
+             Telemetry& telemetry, FrameCallbackPool& pool,
+             std::function<void(cv::Mat& image, uint64_t time)> processFrame);
   ~CvSinkImpl() override;
 
   void Stop();
@@ -40,11 +44,8 @@ class CvSinkImpl : public SinkImpl {
   uint64_t GrabFrame(cv::Mat& image, double timeout);
 
  private:
-  void ThreadMain();
-
-  std::atomic_bool m_active;  // set to false to terminate threads
-  std::thread m_thread;
-  std::function<void(uint64_t time)> m_processFrame;
+  // Only used by the pool thread running the callback
+  cv::Mat m_callbackImage;
 };
 
 }  // namespace cs
@@ -0,0 +1,125 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include "FrameCallbackPool.h"
+
+#include <algorithm>
+
+#include <wpi/ThreadHooks.h>
+
+#include "SourceImpl.h"
+
+using namespace cs;
+
+void FrameListener::SetSource(std::shared_ptr<SourceImpl> source) {
+  std::scoped_lock lock(m_sourceMutex);
+  if (m_source == source) return;
+  if (m_source) {
+    m_source->RemoveFrameListener(*this);
+    // Finish with the old source's frames while it's still referenced
+    Cancel();
+  }
+  m_source = std::move(source);
+  if (m_source) m_source->AddFrameListener(shared_from_this());
+}
+
+void FrameListener::FrameReady(const Frame& frame) {
+  Frame replaced;  // released after the lock
+  std::scoped_lock lock(m_pool.m_mutex);
+  if (m_hasPending) {
+    replaced = std::move(m_pending);
+    ++m_dropped;
+  }
+  m_pending = frame;
+  m_hasPending = true;
+  // A running callback queues its next frame when it finishes
+  if (!m_queued && !m_running) {
+    m_queued = true;
+    m_pool.Enqueue(shared_from_this());
+  }
+}
+
+void FrameListener::Cancel() {
+  Frame pending;  // released after the lock
+  std::unique_lock lock(m_pool.m_mutex);
+  pending = std::move(m_pending);
+  m_hasPending = false;
+  // Don't wait if called from the callback itself
+  if (m_running && m_runningThread != std::this_thread::get_id())
+    m_pool.m_doneCv.wait(lock, [&] { return !m_running; });
+}
+
+FrameCallbackPool::~FrameCallbackPool() { Stop(); }
+
+void FrameCallbackPool::Stop() {
+  std::deque<std::shared_ptr<FrameListener>> queue;
+  std::vector<std::thread> threads;
+  {
+    std::scoped_lock lock(m_mutex);
+    m_active = false;
+    queue.swap(m_queue);
+    threads.swap(m_threads);
+  }
+  m_workCv.notify_all();
+  for (auto& thread : threads) {
+    if (thread.get_id() == std::this_thread::get_id())
+      thread.detach();
+    else if (thread.joinable())
+      thread.join();
+  }
+}
+
+void FrameCallbackPool::SetNumThreads(int count) {
+  std::scoped_lock lock(m_mutex);
+  m_numThreads = std::max(count, 1);
+  if (m_threads.empty() || !m_active) return;  // started on first use
+  // Excess threads exit when they next look for work
+  for (; m_running < m_numThreads; ++m_running)
+    m_threads.emplace_back(&FrameCallbackPool::ThreadMain, this);
+  m_workCv.notify_all();
+}
+
+void FrameCallbackPool::Enqueue(std::shared_ptr<FrameListener> listener) {
+  if (!m_active) return;
+  if (m_threads.empty()) {
+    for (; m_running < m_numThreads; ++m_running)
+      m_threads.emplace_back(&FrameCallbackPool::ThreadMain, this);
+  }
+  m_queue.emplace_back(std::move(listener));
+  m_workCv.notify_one();
+}
+
+void FrameCallbackPool::ThreadMain() {
+  wpi::SetCurrentThreadName("CSFrameCallback");
+  std::unique_lock lock(m_mutex);
+  while (m_active && m_running <= m_numThreads) {
+    if (m_queue.empty()) {
+      m_workCv.wait(lock);
+      continue;
+    }
+    auto listener = std::move(m_queue.front());
+    m_queue.pop_front();
+    listener->m_queued = false;
+    if (!listener->m_hasPending) continue;  // cancelled
+
+    Frame frame = std::move(listener->m_pending);
+    listener->m_hasPending = false;
+    listener->m_running = true;
+    listener->m_runningThread = std::this_thread::get_id();
+    lock.unlock();
+    listener->m_callback(frame);
+    frame = Frame{};
+    lock.lock();
+    listener->m_running = false;
+    if (listener->m_hasPending) {
+      listener->m_queued = true;
+      Enqueue(listener);
+    }
+    m_doneCv.notify_all();
+  }
+  --m_running;
+}
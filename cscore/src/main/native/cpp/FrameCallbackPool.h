@@ -0,0 +1,103 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#ifndef CSCORE_FRAMECALLBACKPOOL_H_
+#define CSCORE_FRAMECALLBACKPOOL_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <wpi/condition_variable.h>
+#include <wpi/mutex.h>
+
+#include "Frame.h"
+
+namespace cs {
+
+class FrameCallbackPool;
+class SourceImpl;
+
+// Hands a callback-based sink's frames to its callback on a shared
+// FrameCallbackPool.  The callback is never run concurrently with itself, and
+// only the latest frame is kept: a frame that arrives while the previous one
+// is still waiting for the callback replaces it and is counted as dropped.
+class FrameListener : public std::enable_shared_from_this<FrameListener> {
+  friend class FrameCallbackPool;
+
+ public:
+  FrameListener(FrameCallbackPool& pool, std::function<void(Frame&)> callback)
+      : m_pool(pool), m_callback(std::move(callback)) {}
+
+  // Starts listening to source (nullptr to stop).  Waits for any running
+  // callback for the previous source to finish.
+  void SetSource(std::shared_ptr<SourceImpl> source);
+
+  // Called by the source with each new frame
+  void FrameReady(const Frame& frame);
+
+  uint64_t GetDroppedCount() const { return m_dropped; }
+
+ private:
+  // Discards any pending frame and waits for a running callback to finish
+  void Cancel();
+
+  FrameCallbackPool& m_pool;
+  std::function<void(Frame&)> m_callback;
+
+  wpi::mutex m_sourceMutex;
+  std::shared_ptr<SourceImpl> m_source;
+
+  // Protected by the pool mutex
+  Frame m_pending;
+  bool m_hasPending = false;
+  bool m_queued = false;
+  bool m_running = false;
+  std::thread::id m_runningThread;
+
+  std::atomic<uint64_t> m_dropped{0};
+};
+
+// A fixed size pool of threads that run frame callbacks.  The threads are
+// started when the first frame is queued.
+class FrameCallbackPool {
+  friend class FrameListener;
+
+ public:
+  FrameCallbackPool() = default;
+  ~FrameCallbackPool();
+  FrameCallbackPool(const FrameCallbackPool&) = delete;
+  FrameCallbackPool& operator=(const FrameCallbackPool&) = delete;
+
+  void Stop();
+
+  void SetNumThreads(int count);
+
+ private:
+  void ThreadMain();
+
+  // Called with m_mutex held
+  void Enqueue(std::shared_ptr<FrameListener> listener);
+
+  wpi::mutex m_mutex;
+  wpi::condition_variable m_workCv;
+  wpi::condition_variable m_doneCv;
+  std::deque<std::shared_ptr<FrameListener>> m_queue;
+  std::vector<std::thread> m_threads;
+  int m_numThreads = 2;
+  int m_running = 0;
+  bool m_active = true;
+};
+
+}  // namespace cs
+
+#endif  // CSCORE_FRAMECALLBACKPOOL_H_
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -9,6 +9,7 @@
 
 #include <wpi/MemAlloc.h>
 #include <wpi/TCPConnector.h>
+#include <wpi/ThreadHooks.h>
 #include <wpi/timestamp.h>
 
 #include "Handle.h"
@@ -63,6 +64,7 @@ void HttpCameraImpl::Start() {
 }
 
 void HttpCameraImpl::MonitorThreadMain() {
+  wpi::SetCurrentThreadName("CSHttpMonitor " + GetName());
   while (m_active) {
     std::unique_lock lock(m_mutex);
     // sleep for 1 second between checks
@@ -87,6 +89,7 @@ void HttpCameraImpl::MonitorThreadMain() {
 }
 
 void HttpCameraImpl::StreamThreadMain() {
+  wpi::SetCurrentThreadName("CSHttpStream " + GetName());
   while (m_active) {
     SetConnected(false);
 
@@ -295,6 +298,7 @@ bool HttpCameraImpl::DeviceStreamFrame(wpi::raw_istream& is,
 }
 
 void HttpCameraImpl::SettingsThreadMain() {
+  wpi::SetCurrentThreadName("CSHttpSettings " + GetName());
   for (;;) {
     wpi::HttpRequest req;
     {
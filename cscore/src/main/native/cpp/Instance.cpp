@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -52,6 +52,7 @@ Instance& Instance::GetInstance() {
 void Instance::Shutdown() {
   eventLoop.Stop();
   m_sinks.FreeAll();
+  frameCallbackPool.Stop();
   m_sources.FreeAll();
   networkListener.Stop();
   telemetry.Stop();
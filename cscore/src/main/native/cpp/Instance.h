@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2018 FIRST. All Rights Reserved.                             */
+/* Copyright (c) 2018-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -14,6 +14,7 @@
 #include <wpi/EventLoopRunner.h>
 #include <wpi/Logger.h>
 
+#include "FrameCallbackPool.h"
 #include "Log.h"
 #include "NetworkListener.h"
 #include "Notifier.h"
@@ -57,6 +58,7 @@ class Instance {
   Notifier notifier;
   Telemetry telemetry;
   NetworkListener networkListener;
+  FrameCallbackPool frameCallbackPool;
 
  private:
   UnlimitedHandleResource<Handle, SourceData, Handle::kSource> m_sources;
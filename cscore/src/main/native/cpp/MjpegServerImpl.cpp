@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -7,20 +7,26 @@
 
 #include "MjpegServerImpl.h"
 
+#include <algorithm>
 #include <chrono>
 
 #include <wpi/HttpUtil.h>
 #include <wpi/SmallString.h>
 #include <wpi/TCPAcceptor.h>
+#include <wpi/ThreadHooks.h>
+#include <wpi/Trace.h>
 #include <wpi/raw_socket_istream.h>
 #include <wpi/raw_socket_ostream.h>
+#include <wpi/timestamp.h>
 
+#include "AdaptiveRate.h"
 #include "Handle.h"
 #include "Instance.h"
 #include "JpegUtil.h"
 #include "Log.h"
 #include "Notifier.h"
 #include "SourceImpl.h"
+#include "Telemetry.h"
 #include "c_util.h"
 #include "cscore_cpp.h"
 
@@ -75,8 +81,12 @@ static const char* endRootPage = "</div></body></html>";
 
 class MjpegServerImpl::ConnThread : public wpi::SafeThread {
  public:
-  explicit ConnThread(const wpi::Twine& name, wpi::Logger& logger)
-      : m_name(name.str()), m_logger(logger) {}
+  ConnThread(const wpi::Twine& name, wpi::Logger& logger, Telemetry& telemetry,
+             const SinkImpl& sink)
+      : m_name(name.str()),
+        m_logger(logger),
+        m_telemetry(telemetry),
+        m_sink(sink) {}
 
   void Main();
 
@@ -97,10 +107,15 @@ class MjpegServerImpl::ConnThread : public wpi::SafeThread {
   int m_compression = -1;
   int m_defaultCompression = 80;
   int m_fps = 0;
+  bool m_adaptive = false;
+  int m_maxLatency = 100;
+  int m_maxBandwidth = 0;
 
  private:
   std::string m_name;
   wpi::Logger& m_logger;
+  Telemetry& m_telemetry;
+  const SinkImpl& m_sink;
 
   wpi::StringRef GetName() { return m_name; }
 
@@ -232,8 +247,8 @@ bool MjpegServerImpl::ConnThread::ProcessCommand(wpi::raw_ostream& os,
       return false;
     }
 
-    // Handle resolution, compression, and FPS.  These are handled locally
-    // rather than passed to the source.
+    // Handle resolution, compression, FPS, and adaptive rate settings.
+    // These are handled locally rather than passed to the source.
     if (param == "resolution") {
       wpi::StringRef widthStr, heightStr;
       std::tie(widthStr, heightStr) = value.split('x');
@@ -284,6 +299,24 @@ bool MjpegServerImpl::ConnThread::ProcessCommand(wpi::raw_ostream& os,
       continue;
     }
 
+    if (param == "adaptive" || param == "latency" || param == "bandwidth") {
+      int val;
+      if (value.getAsInteger(10, val)) {
+        response << param << ": \"invalid integer\"\r\n";
+        SWARNING("HTTP parameter \"" << param << "\" value \"" << value
+                                     << "\" is not an integer");
+        continue;
+      }
+      if (param == "adaptive")
+        m_adaptive = val != 0;
+      else if (param == "latency")
+        m_maxLatency = val;
+      else
+        m_maxBandwidth = val;
+      response << param << ": \"ok\"\r\n";
+      continue;
+    }
+
     // ignore name parameter
     if (param == "name") continue;
 
@@ -595,6 +628,18 @@ MjpegServerImpl::MjpegServerImpl(const wpi::Twine& name, wpi::Logger& logger,
   m_fpsProp = CreateProperty("fps", [] {
     return std::make_unique<PropertyImpl>("fps", CS_PROP_INTEGER, 1, 0, 0);
   });
+  m_adaptiveProp = CreateProperty("adaptive", [] {
+    return std::make_unique<PropertyImpl>("adaptive", CS_PROP_BOOLEAN, 0, 1, 1,
+                                          0, 0);
+  });
+  m_adaptiveLatencyProp = CreateProperty("adaptive_latency", [] {
+    return std::make_unique<PropertyImpl>("adaptive_latency", CS_PROP_INTEGER,
+                                          1, 100, 100);
+  });
+  m_adaptiveBandwidthProp = CreateProperty("adaptive_bandwidth", [] {
+    return std::make_unique<PropertyImpl>("adaptive_bandwidth",
+                                          CS_PROP_INTEGER, 1, 0, 0);
+  });
 
   m_serverThread = std::thread(&MjpegServerImpl::ServerThreadMain, this);
 }
@@ -647,6 +692,12 @@ void MjpegServerImpl::ConnThread::SendStream(wpi::raw_socket_ostream& os) {
   Frame::Time averagePeriod = 1000000;  // 1 second window
   if (averagePeriod < timePerFrame) averagePeriod = timePerFrame * 10;
 
+  std::unique_ptr<AdaptiveRate> adaptive;
+  if (m_adaptive)
+    adaptive = std::make_unique<AdaptiveRate>(m_maxLatency, m_maxBandwidth);
+  uint64_t lastWriteTime = 0;
+  int streamFps = 0;
+
   StartStream();
   while (m_active && !os.has_error()) {
     auto source = GetSource();
@@ -688,11 +739,22 @@ void MjpegServerImpl::ConnThread::SendStream(wpi::raw_socket_ostream& os) {
       }
     }
 
+    wpi::TraceScope trace{"MjpegServer::SendFrame"};
     int width = m_width != 0 ? m_width : frame.GetOriginalWidth();
     int height = m_height != 0 ? m_height : frame.GetOriginalHeight();
-    Image* image = frame.GetImageMJPEG(
-        width, height, m_compression,
-        m_compression == -1 ? m_defaultCompression : m_compression);
+    int requiredQuality = m_compression;
+    int defaultQuality =
+        m_compression == -1 ? m_defaultCompression : m_compression;
+    if (adaptive) {
+      auto& level = adaptive->GetLevel();
+      if (level.quality != 100)
+        requiredQuality = defaultQuality =
+            std::max(defaultQuality * level.quality / 100, 1);
+      width /= level.scale;
+      height /= level.scale;
+    }
+    Image* image =
+        frame.GetImageMJPEG(width, height, requiredQuality, defaultQuality);
     if (!image) {
       // Shouldn't happen, but just in case...
       std::this_thread::sleep_for(std::chrono::milliseconds(20));
@@ -730,6 +792,7 @@ void MjpegServerImpl::ConnThread::SendStream(wpi::raw_socket_ostream& os) {
         << "Content-Length: " << size << "\r\n"
         << "X-Timestamp: " << timestamp << "\r\n"
         << "\r\n";
+    uint64_t writeStart = wpi::Now();
     os << oss.str();
     if (addDHT) {
       // Insert DHT data immediately before SOF
@@ -740,6 +803,52 @@ void MjpegServerImpl::ConnThread::SendStream(wpi::raw_socket_ostream& os) {
       os << wpi::StringRef(data, size);
     }
     // os.flush();
+    if (os.has_error()) break;
+    uint64_t writeEnd = wpi::Now();
+
+    m_telemetry.RecordSinkBytes(m_sink, static_cast<int>(size));
+    m_telemetry.RecordSinkFrames(m_sink, 1);
+    if (!adaptive) continue;
+
+    bool changed = lastWriteTime != 0 &&
+                   adaptive->Update(size, writeEnd - writeStart,
+                                    writeEnd - lastWriteTime);
+    if (lastWriteTime == 0 || changed) {
+      auto& level = adaptive->GetLevel();
+      SDEBUG("adaptive stream: quality " << level.quality << "%, scale 1/"
+                                         << level.scale << ", fps 1/"
+                                         << level.fpsDivisor);
+      // The frame rate is limited by the same frame dropping as the fps
+      // parameter, so fall back to the source frame rate if not set
+      int fps = m_fps;
+      if (fps == 0) {
+        CS_Status status = 0;
+        fps = source->GetVideoMode(&status).fps;
+      }
+      streamFps = fps / level.fpsDivisor;
+      if (fps > 0 && (m_fps != 0 || level.fpsDivisor != 1))
+        timePerFrame = 1000000.0 * level.fpsDivisor / fps;
+      else
+        timePerFrame = 0;
+      averageFrameTime = 0;
+      averagePeriod = 1000000;
+      if (averagePeriod < timePerFrame) averagePeriod = timePerFrame * 10;
+    }
+    lastWriteTime = writeEnd;
+
+    m_telemetry.RecordSinkSetting(m_sink, CS_SINK_STREAM_QUALITY,
+                                  requiredQuality == -1 ? defaultQuality
+                                                        : requiredQuality);
+    m_telemetry.RecordSinkSetting(m_sink, CS_SINK_STREAM_WIDTH,
+                                  image->width);
+    m_telemetry.RecordSinkSetting(m_sink, CS_SINK_STREAM_HEIGHT,
+                                  image->height);
+    if (streamFps > 0)
+      m_telemetry.RecordSinkSetting(m_sink, CS_SINK_STREAM_FPS, streamFps);
+    if (adaptive->GetBandwidth() != 0)
+      m_telemetry.RecordSinkSetting(
+          m_sink, CS_SINK_STREAM_BANDWIDTH,
+          static_cast<int64_t>(adaptive->GetBandwidth()));
   }
   StopStream();
 }
@@ -865,6 +974,7 @@ void MjpegServerImpl::ConnThread::ProcessRequest() {
 
 // worker thread for clients that connected to this server
 void MjpegServerImpl::ConnThread::Main() {
+  wpi::SetCurrentThreadName("CSMjpegConn " + m_name);
   std::unique_lock lock(m_mutex);
   while (m_active) {
     while (!m_stream) {
@@ -880,6 +990,7 @@ void MjpegServerImpl::ConnThread::Main() {
 
 // Main server thread
 void MjpegServerImpl::ServerThreadMain() {
+  wpi::SetCurrentThreadName("CSMjpegServer " + GetName());
   if (m_acceptor->start() != 0) {
     m_active = false;
     return;
@@ -911,7 +1022,7 @@ void MjpegServerImpl::ServerThreadMain() {
     }
 
     // Start it if not already started
-    it->Start(GetName(), m_logger);
+    it->Start(GetName(), m_logger, m_telemetry, *this);
 
     auto nstreams =
         std::count_if(m_connThreads.begin(), m_connThreads.end(),
@@ -930,6 +1041,9 @@ void MjpegServerImpl::ServerThreadMain() {
     thr->m_compression = GetProperty(m_compressionProp)->value;
     thr->m_defaultCompression = GetProperty(m_defaultCompressionProp)->value;
     thr->m_fps = GetProperty(m_fpsProp)->value;
+    thr->m_adaptive = GetProperty(m_adaptiveProp)->value != 0;
+    thr->m_maxLatency = GetProperty(m_adaptiveLatencyProp)->value;
+    thr->m_maxBandwidth = GetProperty(m_adaptiveBandwidthProp)->value;
     thr->m_cond.notify_one();
   }
 
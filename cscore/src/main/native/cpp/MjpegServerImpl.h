@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -64,6 +64,9 @@ class MjpegServerImpl : public SinkImpl {
   int m_compressionProp;
   int m_defaultCompressionProp;
   int m_fpsProp;
+  int m_adaptiveProp;
+  int m_adaptiveLatencyProp;
+  int m_adaptiveBandwidthProp;
 };
 
 }  // namespace cs
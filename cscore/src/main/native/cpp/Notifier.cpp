@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -10,6 +10,8 @@
 #include <queue>
 #include <vector>
 
+#include <wpi/ThreadHooks.h>
+
 #include "Handle.h"
 #include "Instance.h"
 #include "SinkImpl.h"
@@ -100,6 +102,7 @@ void Notifier::Start() { m_owner.Start(m_on_start, m_on_exit); }
 void Notifier::Stop() { m_owner.Stop(); }
 
 void Notifier::Thread::Main() {
+  wpi::SetCurrentThreadName("CSNotifier");
   if (m_on_start) m_on_start();
 
   std::unique_lock lock(m_mutex);
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -99,6 +99,22 @@ void PropertyContainer::SetProperty(int property, int value,
   UpdatePropertyValue(property, false, value, wpi::Twine{});
 }
 
+void PropertyContainer::SetProperties(wpi::ArrayRef<int> properties,
+                                      wpi::ArrayRef<int> values,
+                                      CS_Status* status) {
+  for (size_t i = 0; i < properties.size() && i < values.size(); ++i) {
+    CS_Status propStatus = 0;
+    SetProperty(properties[i], values[i], &propStatus);
+    if (propStatus != 0 && *status == 0) *status = propStatus;
+  }
+}
+
+void PropertyContainer::SetPropertiesAsync(wpi::ArrayRef<int> properties,
+                                           wpi::ArrayRef<int> values) {
+  CS_Status status = 0;
+  SetProperties(properties, values, &status);
+}
+
 int PropertyContainer::GetPropertyMin(int property, CS_Status* status) const {
   if (!m_properties_cached && !CacheProperties(status)) return 0;
   std::scoped_lock lock(m_mutex);
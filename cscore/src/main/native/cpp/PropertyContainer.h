@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -43,6 +43,13 @@ class PropertyContainer {
                                  CS_Status* status) const;
   int GetProperty(int property, CS_Status* status) const;
   virtual void SetProperty(int property, int value, CS_Status* status);
+  // Sets several integer properties in order; status is set to the first
+  // error.  The default implementation calls SetProperty() for each.
+  virtual void SetProperties(wpi::ArrayRef<int> properties,
+                             wpi::ArrayRef<int> values, CS_Status* status);
+  // As SetProperties(), but may return before the values have been applied.
+  virtual void SetPropertiesAsync(wpi::ArrayRef<int> properties,
+                                  wpi::ArrayRef<int> values);
   int GetPropertyMin(int property, CS_Status* status) const;
   int GetPropertyMax(int property, CS_Status* status) const;
   int GetPropertyStep(int property, CS_Status* status) const;
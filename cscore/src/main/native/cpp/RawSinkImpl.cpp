@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2018-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2018-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -7,6 +7,9 @@
 
 #include "RawSinkImpl.h"
 
+#include <wpi/Trace.h>
+
+#include "FrameCallbackPool.h"
 #include "Instance.h"
 #include "cscore.h"
 #include "cscore_raw.h"
@@ -15,26 +18,39 @@ using namespace cs;
 
 RawSinkImpl::RawSinkImpl(const wpi::Twine& name, wpi::Logger& logger,
                          Notifier& notifier, Telemetry& telemetry)
-    : SinkImpl{name, logger, notifier, telemetry} {
-  m_active = true;
-  // m_thread = std::thread(&RawSinkImpl::ThreadMain, this);
-}
+    : SinkImpl{name, logger, notifier, telemetry} {}
 
 RawSinkImpl::RawSinkImpl(const wpi::Twine& name, wpi::Logger& logger,
                          Notifier& notifier, Telemetry& telemetry,
+                         FrameCallbackPool& pool,
                          std::function<void(uint64_t time)> processFrame)
-    : SinkImpl{name, logger, notifier, telemetry} {}
+    : SinkImpl{name, logger, notifier, telemetry} {
+  StartCallbacks(pool, [=](Frame& frame) {
+    processFrame(frame ? frame.GetTime() : 0);
+  });
+}
+
+RawSinkImpl::RawSinkImpl(
+    const wpi::Twine& name, wpi::Logger& logger, Notifier& notifier,
+    Telemetry& telemetry, FrameCallbackPool& pool,
+    std::function<void(CS_RawFrame& frame, uint64_t time)> processFrame)
+    : SinkImpl{name, logger, notifier, telemetry} {
+  // The frame is reused, so the callback can set its pixel format and size
+  // to have later frames converted
+  StartCallbacks(pool, [this, processFrame](Frame& frame) {
+    uint64_t time = frame ? GrabFrameImpl(m_callbackFrame, frame) : 0;
+    processFrame(m_callbackFrame, time);
+  });
+}
 
 RawSinkImpl::~RawSinkImpl() { Stop(); }
 
 void RawSinkImpl::Stop() {
-  m_active = false;
+  // wait for any running callback
+  StopCallbacks();
 
   // wake up any waiters by forcing an empty frame to be sent
   if (auto source = GetSource()) source->Wakeup();
-
-  // join thread
-  if (m_thread.joinable()) m_thread.join();
 }
 
 uint64_t RawSinkImpl::GrabFrame(CS_RawFrame& image) {
@@ -79,6 +95,7 @@ uint64_t RawSinkImpl::GrabFrame(CS_RawFrame& image, double timeout) {
 
 uint64_t RawSinkImpl::GrabFrameImpl(CS_RawFrame& rawFrame,
                                     Frame& incomingFrame) {
+  wpi::TraceScope trace{"RawSink::GrabFrame"};
   Image* newImage = nullptr;
 
   if (rawFrame.pixelFormat == CS_PixelFormat::CS_PIXFMT_UNKNOWN) {
@@ -114,29 +131,6 @@ uint64_t RawSinkImpl::GrabFrameImpl(CS_RawFrame& rawFrame,
   return incomingFrame.GetTime();
 }
 
-// Send HTTP response and a stream of JPG-frames
-void RawSinkImpl::ThreadMain() {
-  Enable();
-  while (m_active) {
-    auto source = GetSource();
-    if (!source) {
-      // Source disconnected; sleep for one second
-      std::this_thread::sleep_for(std::chrono::seconds(1));
-      continue;
-    }
-    SDEBUG4("waiting for frame");
-    Frame frame = source->GetNextFrame();  // blocks
-    if (!m_active) break;
-    if (!frame) {
-      // Bad frame; sleep for 10 ms so we don't consume all processor time.
-      std::this_thread::sleep_for(std::chrono::milliseconds(10));
-      continue;
-    }
-    // TODO m_processFrame();
-  }
-  Disable();
-}
-
 namespace cs {
 CS_Sink CreateRawSink(const wpi::Twine& name, CS_Status* status) {
   auto& inst = Instance::GetInstance();
@@ -149,9 +143,23 @@ CS_Sink CreateRawSinkCallback(const wpi::Twine& name,
                               std::function<void(uint64_t time)> processFrame,
                               CS_Status* status) {
   auto& inst = Instance::GetInstance();
-  return inst.CreateSink(CS_SINK_RAW, std::make_shared<RawSinkImpl>(
-                                          name, inst.logger, inst.notifier,
-                                          inst.telemetry, processFrame));
+  return inst.CreateSink(
+      CS_SINK_RAW,
+      std::make_shared<RawSinkImpl>(name, inst.logger, inst.notifier,
+                                    inst.telemetry, inst.frameCallbackPool,
+                                    processFrame));
+}
+
+CS_Sink CreateRawSinkCallback(
+    const wpi::Twine& name,
+    std::function<void(CS_RawFrame& frame, uint64_t time)> processFrame,
+    CS_Status* status) {
+  auto& inst = Instance::GetInstance();
+  return inst.CreateSink(
+      CS_SINK_RAW,
+      std::make_shared<RawSinkImpl>(name, inst.logger, inst.notifier,
+                                    inst.telemetry, inst.frameCallbackPool,
+                                    processFrame));
 }
 
 uint64_t GrabSinkFrame(CS_Sink sink, CS_RawFrame& image, CS_Status* status) {
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -22,6 +22,7 @@
 #include "cscore_raw.h"
 
 namespace cs {
+class FrameCallbackPool;
 class SourceImpl;
 
 class RawSinkImpl : public SinkImpl {
@@ -29,8 +30,12 @@ class RawSinkImpl : public SinkImpl {
   RawSinkImpl(const wpi::Twine& name, wpi::Logger& logger, Notifier& notifier,
               Telemetry& telemetry);
   RawSinkImpl(const wpi::Twine& name, wpi::Logger& logger, Notifier& notifier,
-              Telemetry& telemetry,
+              Telemetry& telemetry, FrameCallbackPool& pool,
               std::function<void(uint64_t time)> processFrame);
+  RawSinkImpl(
+      const wpi::Twine& name, wpi::Logger& logger, Notifier& notifier,
+      Telemetry& telemetry, FrameCallbackPool& pool,
+      std::function<void(CS_RawFrame& frame, uint64_t time)> processFrame);
   ~RawSinkImpl() override;
 
   void Stop();
@@ -39,13 +44,10 @@ class RawSinkImpl : public SinkImpl {
   uint64_t GrabFrame(CS_RawFrame& frame, double timeout);
 
  private:
-  void ThreadMain();
-
   uint64_t GrabFrameImpl(CS_RawFrame& rawFrame, Frame& incomingFrame);
 
-  std::atomic_bool m_active;  // set to false to terminate threads
-  std::thread m_thread;
-  std::function<void(uint64_t time)> m_processFrame;
+  // Only used by the pool thread running the callback
+  RawFrame m_callbackFrame;
 };
 }  // namespace cs
 
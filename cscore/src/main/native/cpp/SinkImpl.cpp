@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -9,6 +9,7 @@
 
 #include <wpi/json.h>
 
+#include "FrameCallbackPool.h"
 #include "Instance.h"
 #include "Notifier.h"
 #include "SourceImpl.h"
@@ -86,6 +87,7 @@ void SinkImpl::SetSource(std::shared_ptr<SourceImpl> source) {
     }
   }
   SetSourceImpl(source);
+  if (m_listener) m_listener->SetSource(source);
 }
 
 std::string SinkImpl::GetError() const {
@@ -171,3 +173,20 @@ void SinkImpl::UpdatePropertyValue(int property, bool setString, int value,
 }
 
 void SinkImpl::SetSourceImpl(std::shared_ptr<SourceImpl> source) {}
+
+void SinkImpl::StartCallbacks(FrameCallbackPool& pool,
+                              std::function<void(Frame& frame)> callback) {
+  m_listener = std::make_shared<FrameListener>(
+      pool, [this, callback = std::move(callback)](Frame& frame) {
+        if (IsEnabled()) callback(frame);
+      });
+  Enable();
+}
+
+void SinkImpl::StopCallbacks() {
+  if (m_listener) m_listener->SetSource(nullptr);
+}
+
+uint64_t SinkImpl::GetDroppedFrameCount() const {
+  return m_listener ? m_listener->GetDroppedCount() : 0;
+}
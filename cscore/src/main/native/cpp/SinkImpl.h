@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -8,6 +8,9 @@
 #ifndef CSCORE_SINKIMPL_H_
 #define CSCORE_SINKIMPL_H_
 
+#include <stdint.h>
+
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -25,6 +28,8 @@ class json;
 namespace cs {
 
 class Frame;
+class FrameCallbackPool;
+class FrameListener;
 class Notifier;
 class Telemetry;
 
@@ -44,6 +49,13 @@ class SinkImpl : public PropertyContainer {
   void Enable();
   void Disable();
   void SetEnabled(bool enabled);
+  bool IsEnabled() const {
+    std::scoped_lock lock(m_mutex);
+    return m_enabledCount > 0;
+  }
+
+  // Number of frames replaced before the callback got to them
+  uint64_t GetDroppedFrameCount() const;
 
   void SetSource(std::shared_ptr<SourceImpl> source);
 
@@ -68,6 +80,14 @@ class SinkImpl : public PropertyContainer {
 
   virtual void SetSourceImpl(std::shared_ptr<SourceImpl> source);
 
+  // Delivers each new frame to callback on the shared pool instead of
+  // waiting for the sink to grab it.  Frames aren't delivered while the sink
+  // is disabled.  StopCallbacks() must be called before anything the
+  // callback uses is destroyed.
+  void StartCallbacks(FrameCallbackPool& pool,
+                      std::function<void(Frame& frame)> callback);
+  void StopCallbacks();
+
  protected:
   wpi::Logger& m_logger;
   Notifier& m_notifier;
@@ -77,6 +97,7 @@ class SinkImpl : public PropertyContainer {
   std::string m_name;
   std::string m_description;
   std::shared_ptr<SourceImpl> m_source;
+  std::shared_ptr<FrameListener> m_listener;
   int m_enabledCount{0};
 };
 
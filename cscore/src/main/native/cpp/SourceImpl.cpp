@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -13,6 +13,7 @@
 #include <wpi/json.h>
 #include <wpi/timestamp.h>
 
+#include "FrameCallbackPool.h"
 #include "Log.h"
 #include "Notifier.h"
 #include "Telemetry.h"
@@ -99,6 +100,19 @@ void SourceImpl::Wakeup() {
   m_frameCv.notify_all();
 }
 
+void SourceImpl::AddFrameListener(std::shared_ptr<FrameListener> listener) {
+  std::scoped_lock lock{m_frameMutex};
+  m_frameListeners.emplace_back(std::move(listener));
+}
+
+void SourceImpl::RemoveFrameListener(const FrameListener& listener) {
+  std::scoped_lock lock{m_frameMutex};
+  m_frameListeners.erase(
+      std::remove_if(m_frameListeners.begin(), m_frameListeners.end(),
+                     [&](const auto& l) { return l.get() == &listener; }),
+      m_frameListeners.end());
+}
+
 void SourceImpl::SetBrightness(int brightness, CS_Status* status) {
   *status = CS_INVALID_HANDLE;
 }
@@ -442,6 +456,7 @@ void SourceImpl::PutFrame(std::unique_ptr<Image> image, Frame::Time time) {
   {
     std::scoped_lock lock{m_frameMutex};
     m_frame = Frame{*this, std::move(image), time};
+    for (auto&& listener : m_frameListeners) listener->FrameReady(m_frame);
   }
 
   // Signal listeners
@@ -453,6 +468,7 @@ void SourceImpl::PutError(const wpi::Twine& msg, Frame::Time time) {
   {
     std::scoped_lock lock{m_frameMutex};
     m_frame = Frame{*this, msg, time};
+    for (auto&& listener : m_frameListeners) listener->FrameReady(m_frame);
   }
 
   // Signal listeners
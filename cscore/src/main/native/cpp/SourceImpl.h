@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -33,6 +33,7 @@ class json;
 
 namespace cs {
 
+class FrameListener;
 class Notifier;
 class Telemetry;
 
@@ -110,6 +111,10 @@ class SourceImpl : public PropertyContainer {
   // Force a wakeup of all GetNextFrame() callers by sending an empty frame.
   void Wakeup();
 
+  // Callback-based sinks are handed each new frame instead of waiting for it.
+  void AddFrameListener(std::shared_ptr<FrameListener> listener);
+  void RemoveFrameListener(const FrameListener& listener);
+
   // Standard common camera properties
   virtual void SetBrightness(int brightness, CS_Status* status);
   virtual int GetBrightness(CS_Status* status) const;
@@ -181,6 +186,9 @@ class SourceImpl : public PropertyContainer {
   wpi::mutex m_frameMutex;
   wpi::condition_variable m_frameCv;
 
+  // Access protected by m_frameMutex.
+  std::vector<std::shared_ptr<FrameListener>> m_frameListeners;
+
   bool m_destroyFrames{false};
 
   // Pool of frames/images to reduce malloc traffic.
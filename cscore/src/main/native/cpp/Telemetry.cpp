@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -11,11 +11,13 @@
 #include <limits>
 
 #include <wpi/DenseMap.h>
+#include <wpi/ThreadHooks.h>
 #include <wpi/timestamp.h>
 
 #include "Handle.h"
 #include "Instance.h"
 #include "Notifier.h"
+#include "SinkImpl.h"
 #include "SourceImpl.h"
 #include "cscore_cpp.h"
 
@@ -53,6 +55,7 @@ void Telemetry::Start() { m_owner.Start(m_notifier); }
 void Telemetry::Stop() { m_owner.Stop(); }
 
 void Telemetry::Thread::Main() {
+  wpi::SetCurrentThreadName("CSTelemetry");
   std::unique_lock lock(m_mutex);
   auto prevTime = std::chrono::steady_clock::now();
   while (m_active) {
@@ -134,3 +137,33 @@ void Telemetry::RecordSourceFrames(const SourceImpl& source, int quantity) {
                                 static_cast<int>(CS_SOURCE_FRAMES_RECEIVED))] +=
       quantity;
 }
+
+void Telemetry::RecordSinkBytes(const SinkImpl& sink, int quantity) {
+  auto thr = m_owner.GetThread();
+  if (!thr) return;
+  auto handleData = Instance::GetInstance().FindSink(sink);
+  thr->m_current[std::make_pair(Handle{handleData.first, Handle::kSink},
+                                static_cast<int>(CS_SINK_BYTES_SENT))] +=
+      quantity;
+}
+
+void Telemetry::RecordSinkFrames(const SinkImpl& sink, int quantity) {
+  auto thr = m_owner.GetThread();
+  if (!thr) return;
+  auto handleData = Instance::GetInstance().FindSink(sink);
+  thr->m_current[std::make_pair(Handle{handleData.first, Handle::kSink},
+                                static_cast<int>(CS_SINK_FRAMES_SENT))] +=
+      quantity;
+}
+
+void Telemetry::RecordSinkSetting(const SinkImpl& sink, CS_TelemetryKind kind,
+                                  int64_t value) {
+  auto thr = m_owner.GetThread();
+  if (!thr) return;
+  auto handleData = Instance::GetInstance().FindSink(sink);
+  auto [it, inserted] = thr->m_current.try_emplace(
+      std::make_pair(Handle{handleData.first, Handle::kSink},
+                     static_cast<int>(kind)),
+      value);
+  if (!inserted && value < it->getSecond()) it->getSecond() = value;
+}
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -15,6 +15,7 @@
 namespace cs {
 
 class Notifier;
+class SinkImpl;
 class SourceImpl;
 
 class Telemetry {
@@ -37,6 +38,11 @@ class Telemetry {
   // Telemetry events
   void RecordSourceBytes(const SourceImpl& source, int quantity);
   void RecordSourceFrames(const SourceImpl& source, int quantity);
+  void RecordSinkBytes(const SinkImpl& sink, int quantity);
+  void RecordSinkFrames(const SinkImpl& sink, int quantity);
+  // Keeps the lowest value recorded during the period
+  void RecordSinkSetting(const SinkImpl& sink, CS_TelemetryKind kind,
+                         int64_t value);
 
  private:
   Notifier& m_notifier;
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -39,6 +39,18 @@ void CS_SetProperty(CS_Property property, int value, CS_Status* status) {
   return cs::SetProperty(property, value, status);
 }
 
+void CS_SetProperties(const CS_Property* properties, const int* values,
+                      int count, CS_Status* status) {
+  return cs::SetProperties(wpi::ArrayRef<CS_Property>(properties, count),
+                           wpi::ArrayRef<int>(values, count), status);
+}
+
+void CS_SetPropertiesAsync(const CS_Property* properties, const int* values,
+                           int count, CS_Status* status) {
+  return cs::SetPropertiesAsync(wpi::ArrayRef<CS_Property>(properties, count),
+                                wpi::ArrayRef<int>(values, count), status);
+}
+
 int CS_GetPropertyMin(CS_Property property, CS_Status* status) {
   return cs::GetPropertyMin(property, status);
 }
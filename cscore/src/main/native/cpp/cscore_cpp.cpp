@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -7,7 +7,10 @@
 
 #include "cscore_cpp.h"
 
+#include <algorithm>
+
 #include <wpi/SmallString.h>
+#include <wpi/SmallVector.h>
 #include <wpi/hostname.h>
 #include <wpi/json.h>
 
@@ -95,6 +98,66 @@ void SetProperty(CS_Property property, int value, CS_Status* status) {
   container->SetProperty(propertyIndex, value, status);
 }
 
+// Splits properties by the source or sink they belong to, keeping their
+// order, and calls func for each.
+template <typename F>
+static void ForEachPropertyContainer(wpi::ArrayRef<CS_Property> properties,
+                                     wpi::ArrayRef<int> values,
+                                     CS_Status* status, F&& func) {
+  if (properties.size() != values.size()) {
+    *status = CS_INVALID_PROPERTY;
+    return;
+  }
+
+  struct Group {
+    std::shared_ptr<PropertyContainer> container;
+    wpi::SmallVector<int, 16> indices;
+    wpi::SmallVector<int, 16> values;
+  };
+  wpi::SmallVector<Group, 1> groups;
+  for (size_t i = 0; i < properties.size(); ++i) {
+    int propertyIndex;
+    auto container =
+        GetPropertyContainer(properties[i], &propertyIndex, status);
+    if (!container) return;
+    auto it = std::find_if(groups.begin(), groups.end(), [&](const Group& g) {
+      return g.container == container;
+    });
+    if (it == groups.end()) {
+      groups.emplace_back();
+      it = groups.end() - 1;
+      it->container = std::move(container);
+    }
+    it->indices.push_back(propertyIndex);
+    it->values.push_back(values[i]);
+  }
+
+  for (auto&& group : groups)
+    func(*group.container, group.indices, group.values);
+}
+
+void SetProperties(wpi::ArrayRef<CS_Property> properties,
+                   wpi::ArrayRef<int> values, CS_Status* status) {
+  ForEachPropertyContainer(
+      properties, values, status,
+      [&](PropertyContainer& container, wpi::ArrayRef<int> indices,
+          wpi::ArrayRef<int> groupValues) {
+        CS_Status groupStatus = 0;
+        container.SetProperties(indices, groupValues, &groupStatus);
+        if (groupStatus != 0 && *status == 0) *status = groupStatus;
+      });
+}
+
+void SetPropertiesAsync(wpi::ArrayRef<CS_Property> properties,
+                        wpi::ArrayRef<int> values, CS_Status* status) {
+  ForEachPropertyContainer(
+      properties, values, status,
+      [](PropertyContainer& container, wpi::ArrayRef<int> indices,
+         wpi::ArrayRef<int> groupValues) {
+        container.SetPropertiesAsync(indices, groupValues);
+      });
+}
+
 int GetPropertyMin(CS_Property property, CS_Status* status) {
   int propertyIndex;
   auto container = GetPropertyContainer(property, &propertyIndex, status);
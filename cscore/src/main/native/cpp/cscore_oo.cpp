@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -33,6 +33,30 @@ std::vector<VideoProperty> VideoSource::EnumerateProperties() const {
   return properties;
 }
 
+void VideoSource::SetProperties(
+    std::initializer_list<std::pair<VideoProperty, int>> values) {
+  wpi::SmallVector<CS_Property, 16> handles;
+  wpi::SmallVector<int, 16> ints;
+  for (auto&& value : values) {
+    handles.push_back(value.first.m_handle);
+    ints.push_back(value.second);
+  }
+  m_status = 0;
+  cs::SetProperties(handles, ints, &m_status);
+}
+
+void VideoSource::SetPropertiesAsync(
+    std::initializer_list<std::pair<VideoProperty, int>> values) {
+  wpi::SmallVector<CS_Property, 16> handles;
+  wpi::SmallVector<int, 16> ints;
+  for (auto&& value : values) {
+    handles.push_back(value.first.m_handle);
+    ints.push_back(value.second);
+  }
+  m_status = 0;
+  cs::SetPropertiesAsync(handles, ints, &m_status);
+}
+
 std::vector<VideoSink> VideoSource::EnumerateSinks() {
   wpi::SmallVector<CS_Sink, 16> handles_buf;
   CS_Status status = 0;
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -176,11 +176,20 @@ enum CS_EventKind {
 };
 
 /**
- * Telemetry kinds
+ * Telemetry kinds.  The CS_SINK_STREAM_* kinds are the lowest settings an
+ * adaptive MJPEG server chose for any of its clients during the telemetry
+ * period; CS_SINK_STREAM_BANDWIDTH is in bytes per second.
  */
 enum CS_TelemetryKind {
   CS_SOURCE_BYTES_RECEIVED = 1,
-  CS_SOURCE_FRAMES_RECEIVED = 2
+  CS_SOURCE_FRAMES_RECEIVED = 2,
+  CS_SINK_BYTES_SENT = 3,
+  CS_SINK_FRAMES_SENT = 4,
+  CS_SINK_STREAM_QUALITY = 5,
+  CS_SINK_STREAM_WIDTH = 6,
+  CS_SINK_STREAM_HEIGHT = 7,
+  CS_SINK_STREAM_FPS = 8,
+  CS_SINK_STREAM_BANDWIDTH = 9
 };
 
 /** Connection strategy */
@@ -249,6 +258,10 @@ enum CS_PropertyKind CS_GetPropertyKind(CS_Property property,
 char* CS_GetPropertyName(CS_Property property, CS_Status* status);
 int CS_GetProperty(CS_Property property, CS_Status* status);
 void CS_SetProperty(CS_Property property, int value, CS_Status* status);
+void CS_SetProperties(const CS_Property* properties, const int* values,
+                      int count, CS_Status* status);
+void CS_SetPropertiesAsync(const CS_Property* properties, const int* values,
+                           int count, CS_Status* status);
 int CS_GetPropertyMin(CS_Property property, CS_Status* status);
 int CS_GetPropertyMax(CS_Property property, CS_Status* status);
 int CS_GetPropertyStep(CS_Property property, CS_Status* status);
@@ -421,6 +434,8 @@ void CS_SetSinkDescription(CS_Sink sink, const char* description,
                            CS_Status* status);
 char* CS_GetSinkError(CS_Sink sink, CS_Status* status);
 void CS_SetSinkEnabled(CS_Sink sink, CS_Bool enabled, CS_Status* status);
+uint64_t CS_GetSinkDroppedFrameCount(CS_Sink sink, CS_Status* status);
+void CS_SetSinkCallbackThreadCount(int count);
 /** @} */
 
 /**
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -178,6 +178,10 @@ wpi::StringRef GetPropertyName(CS_Property property,
                                CS_Status* status);
 int GetProperty(CS_Property property, CS_Status* status);
 void SetProperty(CS_Property property, int value, CS_Status* status);
+void SetProperties(wpi::ArrayRef<CS_Property> properties,
+                   wpi::ArrayRef<int> values, CS_Status* status);
+void SetPropertiesAsync(wpi::ArrayRef<CS_Property> properties,
+                        wpi::ArrayRef<int> values, CS_Status* status);
 int GetPropertyMin(CS_Property property, CS_Status* status);
 int GetPropertyMax(CS_Property property, CS_Status* status);
 int GetPropertyStep(CS_Property property, CS_Status* status);
@@ -366,6 +370,8 @@ std::string GetSinkError(CS_Sink sink, CS_Status* status);
 wpi::StringRef GetSinkError(CS_Sink sink, wpi::SmallVectorImpl<char>& buf,
                             CS_Status* status);
 void SetSinkEnabled(CS_Sink sink, bool enabled, CS_Status* status);
+uint64_t GetSinkDroppedFrameCount(CS_Sink sink, CS_Status* status);
+void SetSinkCallbackThreadCount(int count);
 /** @} */
 
 /**
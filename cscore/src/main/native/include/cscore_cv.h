@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -68,6 +68,10 @@ void PutSourceFrame(CS_Source source, cv::Mat& image, CS_Status* status);
 uint64_t GrabSinkFrame(CS_Sink sink, cv::Mat& image, CS_Status* status);
 uint64_t GrabSinkFrameTimeout(CS_Sink sink, cv::Mat& image, double timeout,
                               CS_Status* status);
+CS_Sink CreateCvSinkCallback(
+    const wpi::Twine& name,
+    std::function<void(cv::Mat& image, uint64_t time)> processFrame,
+    CS_Status* status);
 
 /**
  * A source for user code to provide OpenCV images as video frames.
@@ -134,8 +138,8 @@ class CvSink : public ImageSink {
   /**
    * Create a sink for accepting OpenCV images in a separate thread.
    *
-   * <p>A thread will be created that calls WaitForFrame() and calls the
-   * processFrame() callback each time a new frame arrives.
+   * <p>The processFrame() callback is called on a shared worker thread each
+   * time a new frame arrives.
    *
    * @param name Source name (arbitrary unique identifier)
    * @param processFrame Frame processing function; will be called with a
@@ -146,6 +150,25 @@ class CvSink : public ImageSink {
   CvSink(const wpi::Twine& name,
          std::function<void(uint64_t time)> processFrame);
 
+  /**
+   * Create a sink that is handed each new OpenCV image.
+   *
+   * <p>processFrame is called on a shared pool of worker threads (see
+   * SetCallbackThreadCount()), rather than needing a thread per sink blocked
+   * waiting for frames.  It is never called concurrently with itself.  If a
+   * frame arrives while processFrame is still busy with an earlier one, only
+   * the latest frame is kept; skipped frames are counted by
+   * GetDroppedFrameCount().
+   *
+   * @param name Sink name (arbitrary unique identifier)
+   * @param processFrame Frame processing function; called with the image
+   *        (three 8-bit channels in BGR order) and the frame time, or with
+   *        time=0 if an error occurred (call GetError() to obtain the error
+   *        message).  The image is reused for the next frame.
+   */
+  CvSink(const wpi::Twine& name,
+         std::function<void(cv::Mat& image, uint64_t time)> processFrame);
+
   /**
    * Wait for the next frame and get the image.
    * Times out (returning 0) after timeout seconds.
@@ -192,6 +215,12 @@ inline CvSink::CvSink(const wpi::Twine& name,
   m_handle = CreateCvSinkCallback(name, processFrame, &m_status);
 }
 
+inline CvSink::CvSink(
+    const wpi::Twine& name,
+    std::function<void(cv::Mat& image, uint64_t time)> processFrame) {
+  m_handle = CreateCvSinkCallback(name, processFrame, &m_status);
+}
+
 inline uint64_t CvSink::GrabFrame(cv::Mat& image, double timeout) const {
   m_status = 0;
   return GrabSinkFrameTimeout(m_handle, image, timeout, &m_status);
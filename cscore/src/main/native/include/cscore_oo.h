@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -204,6 +204,28 @@ class VideoSource {
    */
   std::vector<VideoProperty> EnumerateProperties() const;
 
+  /**
+   * Set several integer properties of this source at once.
+   *
+   * <p>USB cameras apply all of the values in a single request to the camera
+   * thread, rather than waiting for it once per property.  The values are
+   * applied in order, so e.g. an auto exposure property should come before
+   * the exposure value.
+   *
+   * @param values Properties and the values to set them to
+   */
+  void SetProperties(
+      std::initializer_list<std::pair<VideoProperty, int>> values);
+
+  /**
+   * Set several integer properties of this source without waiting for the
+   * values to be applied.  Errors are logged rather than returned.
+   *
+   * @param values Properties and the values to set them to
+   */
+  void SetPropertiesAsync(
+      std::initializer_list<std::pair<VideoProperty, int>> values);
+
   /**
    * Get the current video mode.
    */
@@ -946,6 +968,25 @@ class MjpegServer : public VideoSink {
    * @param quality JPEG compression quality (0-100)
    */
   void SetDefaultCompression(int quality);
+
+  /**
+   * Set whether clients that don't specify it get an adaptive stream.
+   *
+   * <p>An adaptive stream estimates each client's throughput from how long
+   * frame writes block, and lowers the JPEG quality, then the resolution,
+   * then the frame rate while frames take longer than maxLatency to send or
+   * the stream exceeds the bandwidth available.  The chosen settings are
+   * reported through telemetry (CS_SINK_STREAM_*).  Clients can also select
+   * this with the adaptive, latency, and bandwidth stream URL parameters.
+   *
+   * <p>Stepping quality or resolution down increases CPU usage for MJPEG
+   * source cameras, as images must be recompressed.
+   *
+   * @param enabled True to enable adaptive streaming
+   * @param maxLatency Maximum time to send a frame, in milliseconds
+   * @param maxBandwidth Maximum bandwidth, in kbit/s, 0 for unlimited
+   */
+  void SetAdaptive(bool enabled, int maxLatency = 100, int maxBandwidth = 0);
 };
 
 /**
@@ -977,6 +1018,20 @@ class ImageSink : public VideoSink {
    * processor resources when frames are not needed.
    */
   void SetEnabled(bool enabled);
+
+  /**
+   * Get the number of frames skipped because processFrame (for
+   * callback-based sinks) was still busy with an earlier frame.
+   */
+  uint64_t GetDroppedFrameCount() const;
+
+  /**
+   * Set the number of worker threads shared by all callback-based sinks.
+   * Defaults to 2.
+   *
+   * @param count number of threads
+   */
+  static void SetCallbackThreadCount(int count);
 };
 
 /**
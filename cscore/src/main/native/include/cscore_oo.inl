@@ -560,6 +560,17 @@ inline void MjpegServer::SetDefaultCompression(int quality) {
               quality, &m_status);
 }
 
+inline void MjpegServer::SetAdaptive(bool enabled, int maxLatency,
+                                     int maxBandwidth) {
+  m_status = 0;
+  SetProperty(GetSinkProperty(m_handle, "adaptive", &m_status), enabled,
+              &m_status);
+  SetProperty(GetSinkProperty(m_handle, "adaptive_latency", &m_status),
+              maxLatency, &m_status);
+  SetProperty(GetSinkProperty(m_handle, "adaptive_bandwidth", &m_status),
+              maxBandwidth, &m_status);
+}
+
 inline void ImageSink::SetDescription(const wpi::Twine& description) {
   m_status = 0;
   SetSinkDescription(m_handle, description, &m_status);
@@ -575,6 +586,15 @@ inline void ImageSink::SetEnabled(bool enabled) {
   SetSinkEnabled(m_handle, enabled, &m_status);
 }
 
+inline uint64_t ImageSink::GetDroppedFrameCount() const {
+  m_status = 0;
+  return GetSinkDroppedFrameCount(m_handle, &m_status);
+}
+
+inline void ImageSink::SetCallbackThreadCount(int count) {
+  SetSinkCallbackThreadCount(count);
+}
+
 inline VideoSource VideoEvent::GetSource() const {
   CS_Status status = 0;
   return VideoSource{sourceHandle == 0 ? 0 : CopySource(sourceHandle, &status)};
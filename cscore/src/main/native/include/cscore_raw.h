@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -88,6 +88,10 @@ CS_Sink CreateRawSink(const wpi::Twine& name, CS_Status* status);
 CS_Sink CreateRawSinkCallback(const wpi::Twine& name,
                               std::function<void(uint64_t time)> processFrame,
                               CS_Status* status);
+CS_Sink CreateRawSinkCallback(
+    const wpi::Twine& name,
+    std::function<void(CS_RawFrame& frame, uint64_t time)> processFrame,
+    CS_Status* status);
 
 void PutSourceFrame(CS_Source source, const CS_RawFrame& image,
                     CS_Status* status);
@@ -155,8 +159,8 @@ class RawSink : public ImageSink {
   /**
    * Create a sink for accepting raws images in a separate thread.
    *
-   * <p>A thread will be created that calls WaitForFrame() and calls the
-   * processFrame() callback each time a new frame arrives.
+   * <p>The processFrame() callback is called on a shared worker thread each
+   * time a new frame arrives.
    *
    * @param name Source name (arbitrary unique identifier)
    * @param processFrame Frame processing function; will be called with a
@@ -167,6 +171,25 @@ class RawSink : public ImageSink {
   RawSink(const wpi::Twine& name,
           std::function<void(uint64_t time)> processFrame);
 
+  /**
+   * Create a sink that is handed each new raw image.
+   *
+   * <p>processFrame is called on a shared pool of worker threads (see
+   * SetCallbackThreadCount()), rather than needing a thread per sink blocked
+   * waiting for frames.  It is never called concurrently with itself.  If a
+   * frame arrives while processFrame is still busy with an earlier one, only
+   * the latest frame is kept; skipped frames are counted by
+   * GetDroppedFrameCount().
+   *
+   * @param name Sink name (arbitrary unique identifier)
+   * @param processFrame Frame processing function; called with the image and
+   *        the frame time, or with time=0 if an error occurred.  The frame
+   *        is reused for the next image, so setting its pixel format, width
+   *        and height requests that later images be converted to match.
+   */
+  RawSink(const wpi::Twine& name,
+          std::function<void(CS_RawFrame& frame, uint64_t time)> processFrame);
+
  protected:
   /**
    * Wait for the next frame and get the image.
@@ -215,6 +238,12 @@ inline RawSink::RawSink(const wpi::Twine& name,
   m_handle = CreateRawSinkCallback(name, processFrame, &m_status);
 }
 
+inline RawSink::RawSink(
+    const wpi::Twine& name,
+    std::function<void(CS_RawFrame& frame, uint64_t time)> processFrame) {
+  m_handle = CreateRawSinkCallback(name, processFrame, &m_status);
+}
+
 inline uint64_t RawSink::GrabFrame(RawFrame& image, double timeout) const {
   m_status = 0;
   return GrabSinkFrameTimeout(m_handle, image, timeout, &m_status);
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -19,6 +19,7 @@
 #include <cerrno>
 
 #include <wpi/SafeThread.h>
+#include <wpi/ThreadHooks.h>
 
 #include "Log.h"
 #include "Notifier.h"
@@ -66,6 +67,7 @@ void NetworkListener::Stop() {
 }
 
 void NetworkListener::Impl::Thread::Main() {
+  wpi::SetCurrentThreadName("CSNetworkListener");
   // Create event socket so we can be shut down
   m_command_fd = ::eventfd(0, 0);
   if (m_command_fd < 0) {
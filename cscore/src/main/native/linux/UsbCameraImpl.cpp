@@ -28,6 +28,7 @@
 #include <wpi/MemAlloc.h>
 #include <wpi/Path.h>
 #include <wpi/SmallString.h>
+#include <wpi/ThreadHooks.h>
 #include <wpi/raw_ostream.h>
 #include <wpi/timestamp.h>
 
@@ -309,6 +310,8 @@ void UsbCameraImpl::Start() {
 }
 
 void UsbCameraImpl::CameraThreadMain() {
+  wpi::SetCurrentThreadName("CSUsbCamera " + GetName());
+
   // We want to be notified on file creation and deletion events in the device
   // path.  This is used to detect disconnects and reconnects.
   std::unique_ptr<wpi::raw_fd_istream> notify_is;
@@ -710,13 +713,9 @@ CS_StatusValue UsbCameraImpl::DeviceCmdSetMode(
   return CS_OK;
 }
 
-CS_StatusValue UsbCameraImpl::DeviceCmdSetProperty(
-    std::unique_lock<wpi::mutex>& lock, const Message& msg) {
-  bool setString = (msg.kind == Message::kCmdSetPropertyStr);
-  int property = msg.data[0];
-  int value = msg.data[1];
-  wpi::StringRef valueStr = msg.dataStr;
-
+CS_StatusValue UsbCameraImpl::DeviceResolvePropertySet(bool setString,
+                                                       int property, int value,
+                                                       PropertySet* set) {
   // Look up
   auto prop = static_cast<UsbCameraProperty*>(GetProperty(property));
   if (!prop) return CS_INVALID_PROPERTY;
@@ -748,23 +747,85 @@ CS_StatusValue UsbCameraImpl::DeviceCmdSetProperty(
     }
   }
 
+  *set = {prop, property, value, percentageProperty, percentageValue};
+  return CS_OK;
+}
+
+CS_StatusValue UsbCameraImpl::DeviceCmdSetProperty(
+    std::unique_lock<wpi::mutex>& lock, const Message& msg) {
+  bool setString = (msg.kind == Message::kCmdSetPropertyStr);
+  wpi::StringRef valueStr = msg.dataStr;
+
+  PropertySet set;
+  CS_StatusValue status =
+      DeviceResolvePropertySet(setString, msg.data[0], msg.data[1], &set);
+  if (status != CS_OK) return status;
+
   // Actually set the new value on the device (if possible)
-  if (!prop->device) {
-    if (prop->id == kPropConnectVerboseId) m_connectVerbose = value;
+  if (!set.prop->device) {
+    if (set.prop->id == kPropConnectVerboseId) m_connectVerbose = set.value;
   } else {
-    if (!prop->DeviceSet(lock, m_fd, value, valueStr))
+    if (!set.prop->DeviceSet(lock, m_fd, set.value, valueStr))
       return CS_PROPERTY_WRITE_FAILED;
   }
 
   // Cache the set values
-  UpdatePropertyValue(property, setString, value, valueStr);
-  if (percentageProperty != 0)
-    UpdatePropertyValue(percentageProperty, setString, percentageValue,
+  UpdatePropertyValue(set.property, setString, set.value, valueStr);
+  if (set.percentageProperty != 0)
+    UpdatePropertyValue(set.percentageProperty, setString, set.percentageValue,
                         valueStr);
 
   return CS_OK;
 }
 
+CS_StatusValue UsbCameraImpl::DeviceCmdSetProperties(
+    std::unique_lock<wpi::mutex>& lock, const Message& msg) {
+  CS_StatusValue rv = CS_OK;
+
+  // Resolve everything first, so the device controls can be set together
+  wpi::SmallVector<PropertySet, 16> sets;
+  wpi::SmallVector<const UsbCameraProperty*, 16> deviceProps;
+  wpi::SmallVector<int, 16> deviceValues;
+  for (auto&& prop : msg.dataProps) {
+    PropertySet set;
+    CS_StatusValue status =
+        DeviceResolvePropertySet(false, prop.first, prop.second, &set);
+    if (status != CS_OK) {
+      if (rv == CS_OK) rv = status;
+      continue;
+    }
+    if (set.prop->device) {
+      deviceProps.push_back(set.prop);
+      deviceValues.push_back(set.value);
+    } else if (set.prop->id == kPropConnectVerboseId) {
+      m_connectVerbose = set.value;
+    }
+    sets.push_back(set);
+  }
+
+  wpi::SmallVector<bool, 16> ok;
+  ok.resize(deviceProps.size());
+  UsbCameraProperty::DeviceSetInts(lock, m_fd, deviceProps, deviceValues,
+                                   ok.data());
+
+  // Cache the values that were set
+  size_t deviceIndex = 0;
+  for (auto&& set : sets) {
+    if (set.prop->device && !ok[deviceIndex++]) {
+      if (rv == CS_OK) rv = CS_PROPERTY_WRITE_FAILED;
+      continue;
+    }
+    UpdatePropertyValue(set.property, false, set.value, wpi::Twine{});
+    if (set.percentageProperty != 0)
+      UpdatePropertyValue(set.percentageProperty, false, set.percentageValue,
+                          wpi::Twine{});
+  }
+
+  if (rv != CS_OK && msg.kind == Message::kCmdSetPropertiesAsync)
+    SWARNING("could not set all properties: status " << rv);
+  return rv;
+}
+
 CS_StatusValue UsbCameraImpl::DeviceProcessCommand(
     std::unique_lock<wpi::mutex>& lock, const Message& msg) {
   if (msg.kind == Message::kCmdSetMode ||
@@ -775,6 +836,9 @@ CS_StatusValue UsbCameraImpl::DeviceProcessCommand(
   } else if (msg.kind == Message::kCmdSetProperty ||
              msg.kind == Message::kCmdSetPropertyStr) {
     return DeviceCmdSetProperty(lock, msg);
+  } else if (msg.kind == Message::kCmdSetProperties ||
+             msg.kind == Message::kCmdSetPropertiesAsync) {
+    return DeviceCmdSetProperties(lock, msg);
   } else if (msg.kind == Message::kNumSinksChanged ||
              msg.kind == Message::kNumSinksEnabledChanged) {
     return CS_OK;
@@ -787,12 +851,14 @@ void UsbCameraImpl::DeviceProcessCommands() {
   std::unique_lock lock(m_mutex);
   if (m_commands.empty()) return;
   while (!m_commands.empty()) {
-    auto msg = std::move(m_commands.back());
-    m_commands.pop_back();
+    // Process in the order sent, so later async property sets win
+    auto msg = std::move(m_commands.front());
+    m_commands.erase(m_commands.begin());
 
     CS_StatusValue status = DeviceProcessCommand(lock, msg);
     if (msg.kind != Message::kNumSinksChanged &&
-        msg.kind != Message::kNumSinksEnabledChanged)
+        msg.kind != Message::kNumSinksEnabledChanged &&
+        msg.kind != Message::kCmdSetPropertiesAsync)
       m_responses.emplace_back(msg.from, status);
   }
   lock.unlock();
@@ -1242,6 +1308,23 @@ void UsbCameraImpl::SetStringProperty(int property, const wpi::Twine& value,
   *status = SendAndWait(std::move(msg));
 }
 
+void UsbCameraImpl::SetProperties(wpi::ArrayRef<int> properties,
+                                  wpi::ArrayRef<int> values,
+                                  CS_Status* status) {
+  Message msg{Message::kCmdSetProperties};
+  for (size_t i = 0; i < properties.size() && i < values.size(); ++i)
+    msg.dataProps.emplace_back(properties[i], values[i]);
+  *status = SendAndWait(std::move(msg));
+}
+
+void UsbCameraImpl::SetPropertiesAsync(wpi::ArrayRef<int> properties,
+                                       wpi::ArrayRef<int> values) {
+  Message msg{Message::kCmdSetPropertiesAsync};
+  for (size_t i = 0; i < properties.size() && i < values.size(); ++i)
+    msg.dataProps.emplace_back(properties[i], values[i]);
+  Send(std::move(msg));
+}
+
 void UsbCameraImpl::SetBrightness(int brightness, CS_Status* status) {
   if (brightness > 100) {
     brightness = 100;
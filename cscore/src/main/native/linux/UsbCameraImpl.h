@@ -46,6 +46,10 @@ class UsbCameraImpl : public SourceImpl {
   void SetProperty(int property, int value, CS_Status* status) override;
   void SetStringProperty(int property, const wpi::Twine& value,
                          CS_Status* status) override;
+  void SetProperties(wpi::ArrayRef<int> properties, wpi::ArrayRef<int> values,
+                     CS_Status* status) override;
+  void SetPropertiesAsync(wpi::ArrayRef<int> properties,
+                          wpi::ArrayRef<int> values) override;
 
   // Standard common camera properties
   void SetBrightness(int brightness, CS_Status* status) override;
@@ -78,6 +82,8 @@ class UsbCameraImpl : public SourceImpl {
       kCmdSetFPS,
       kCmdSetProperty,
       kCmdSetPropertyStr,
+      kCmdSetProperties,
+      kCmdSetPropertiesAsync,   // no response
       kNumSinksChanged,         // no response
       kNumSinksEnabledChanged,  // no response
       // Responses
@@ -91,6 +97,7 @@ class UsbCameraImpl : public SourceImpl {
     Kind kind;
     int data[4];
     std::string dataStr;
+    std::vector<std::pair<int, int>> dataProps;  // property, value
     std::thread::id from;
   };
 
@@ -132,6 +139,20 @@ class UsbCameraImpl : public SourceImpl {
                                   const Message& msg);
   CS_StatusValue DeviceCmdSetProperty(std::unique_lock<wpi::mutex>& lock,
                                       const Message& msg);
+  CS_StatusValue DeviceCmdSetProperties(std::unique_lock<wpi::mutex>& lock,
+                                        const Message& msg);
+
+  // A property set, resolved to the raw property to set on the device
+  struct PropertySet {
+    UsbCameraProperty* prop;
+    int property;
+    int value;
+    // If not 0, the percentage property to update along with the raw one
+    int percentageProperty;
+    int percentageValue;
+  };
+  CS_StatusValue DeviceResolvePropertySet(bool setString, int property,
+                                          int value, PropertySet* set);
 
   // Property helper functions
   int RawToPercentage(const UsbCameraProperty& rawProp, int rawValue);
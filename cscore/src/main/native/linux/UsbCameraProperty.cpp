@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -8,6 +8,7 @@
 #include "UsbCameraProperty.h"
 
 #include <wpi/SmallString.h>
+#include <wpi/SmallVector.h>
 #include <wpi/raw_ostream.h>
 
 #include "UsbUtil.h"
@@ -328,3 +329,52 @@ bool UsbCameraProperty::DeviceSet(std::unique_lock<wpi::mutex>& lock, int fd,
 
   return rv >= 0;
 }
+
+void UsbCameraProperty::DeviceSetInts(
+    std::unique_lock<wpi::mutex>& lock, int fd,
+    wpi::ArrayRef<const UsbCameraProperty*> props, wpi::ArrayRef<int> values,
+    bool* ok) {
+  // Copy what's needed while holding the lock
+  wpi::SmallVector<struct v4l2_ext_control, 16> ctrls;
+  wpi::SmallVector<int, 16> types;
+  for (size_t i = 0; i < props.size(); ++i) {
+    ok[i] = true;
+    struct v4l2_ext_control ctrl;
+    std::memset(&ctrl, 0, sizeof(ctrl));
+    ctrl.id = props[i]->id;
+    if (props[i]->type == V4L2_CTRL_TYPE_INTEGER64)
+      ctrl.value64 = values[i];
+    else
+      ctrl.value = values[i];
+    ctrls.push_back(ctrl);
+    types.push_back(props[i]->type);
+  }
+  if (fd < 0 || ctrls.empty()) return;
+
+  lock.unlock();
+  size_t start = 0;
+  while (start < ctrls.size()) {
+    // All controls in one VIDIOC_S_EXT_CTRLS must be in the same class
+    unsigned ctrlClass = V4L2_CTRL_ID2CLASS(ctrls[start].id);
+    size_t end = start + 1;
+    while (end < ctrls.size() && V4L2_CTRL_ID2CLASS(ctrls[end].id) == ctrlClass)
+      ++end;
+
+    struct v4l2_ext_controls extCtrls;
+    std::memset(&extCtrls, 0, sizeof(extCtrls));
+    extCtrls.ctrl_class = ctrlClass;
+    extCtrls.count = end - start;
+    extCtrls.controls = &ctrls[start];
+    if (end - start == 1 || TryIoctl(fd, VIDIOC_S_EXT_CTRLS, &extCtrls) < 0) {
+      // Fall back to what a single set does, e.g. for drivers that only
+      // support VIDIOC_S_CTRL for user class controls
+      for (size_t i = start; i < end; ++i) {
+        int64_t value = types[i] == V4L2_CTRL_TYPE_INTEGER64 ? ctrls[i].value64
+                                                             : ctrls[i].value;
+        ok[i] = SetIntCtrlIoctl(fd, ctrls[i].id, types[i], value) >= 0;
+      }
+    }
+    start = end;
+  }
+  lock.lock();
+}
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -12,6 +12,7 @@
 
 #include <memory>
 
+#include <wpi/ArrayRef.h>
 #include <wpi/mutex.h>
 
 #include "PropertyImpl.h"
@@ -60,6 +61,14 @@ class UsbCameraProperty : public PropertyImpl {
   bool DeviceSet(std::unique_lock<wpi::mutex>& lock, int fd, int newValue,
                  const wpi::Twine& newValueStr) const;
 
+  // Sets integer values on several device properties, in order.  Each run of
+  // controls in the same control class is set with a single
+  // VIDIOC_S_EXT_CTRLS; if the driver rejects a run, its controls are set one
+  // at a time instead.  ok[i] is set to whether values[i] was set.
+  static void DeviceSetInts(std::unique_lock<wpi::mutex>& lock, int fd,
+                            wpi::ArrayRef<const UsbCameraProperty*> props,
+                            wpi::ArrayRef<int> values, bool* ok);
+
   // If this is a device (rather than software) property
   bool device{true};
 
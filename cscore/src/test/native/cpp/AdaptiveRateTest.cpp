@@ -0,0 +1,86 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include "AdaptiveRate.h"  // NOLINT(build/include_order)
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+namespace cs {
+
+// 30 fps, 100 ms maximum latency, no bandwidth limit
+class AdaptiveRateTest : public ::testing::Test {
+ protected:
+  static constexpr uint64_t kPeriod = 33333;
+
+  // Writes count frames that don't block; returns the number of level changes
+  int WriteGood(int count, size_t size = 10000) {
+    int changes = 0;
+    for (int i = 0; i < count; ++i)
+      changes += m_rate.Update(size, 100, kPeriod);
+    return changes;
+  }
+
+  AdaptiveRate m_rate{100, 0};
+};
+
+TEST_F(AdaptiveRateTest, StartsAtBest) {
+  EXPECT_EQ(0, m_rate.GetLevelIndex());
+  EXPECT_EQ(0, WriteGood(100));
+  EXPECT_EQ(0, m_rate.GetLevelIndex());
+  EXPECT_EQ(0, m_rate.GetBandwidth());
+}
+
+TEST_F(AdaptiveRateTest, StepDownOnBlockedWrite) {
+  EXPECT_TRUE(m_rate.Update(10000, 200000, kPeriod));
+  EXPECT_EQ(1, m_rate.GetLevelIndex());
+  EXPECT_EQ(50000, m_rate.GetBandwidth());
+
+  // Changes are given time to take effect
+  EXPECT_FALSE(m_rate.Update(10000, 200000, kPeriod));
+  EXPECT_EQ(1, m_rate.GetLevelIndex());
+}
+
+TEST_F(AdaptiveRateTest, StepDownStopsAtWorst) {
+  for (int i = 0; i < 100; ++i) m_rate.Update(10000, 200000, kPeriod);
+  EXPECT_EQ(AdaptiveRate::kNumLevels - 1, m_rate.GetLevelIndex());
+  EXPECT_FALSE(m_rate.Update(10000, 200000, kPeriod));
+}
+
+TEST_F(AdaptiveRateTest, StepUpAfterHeadroom) {
+  // A write that blocked for 200 ms measures the link at 50000 bytes/s
+  ASSERT_TRUE(m_rate.Update(10000, 200000, 1000000));
+  ASSERT_EQ(1, m_rate.GetLevelIndex());
+
+  // Smaller frames fit, but it doesn't go straight back up
+  EXPECT_EQ(0, WriteGood(30, 1000));
+  EXPECT_EQ(1, m_rate.GetLevelIndex());
+
+  EXPECT_EQ(1, WriteGood(100, 1000));
+  EXPECT_EQ(0, m_rate.GetLevelIndex());
+}
+
+TEST_F(AdaptiveRateTest, HoldSteadyAtCap) {
+  m_rate.Update(10000, 200000, 1000000);
+  WriteGood(100, 1000);
+  ASSERT_EQ(0, m_rate.GetLevelIndex());
+
+  // An hour at 30 fps
+  EXPECT_EQ(0, WriteGood(30 * 3600, 1000));
+  EXPECT_EQ(0, m_rate.GetLevelIndex());
+  double bandwidth = m_rate.GetBandwidth();
+  EXPECT_TRUE(std::isfinite(bandwidth));
+  EXPECT_NEAR(m_rate.GetSendRate() * AdaptiveRate::kMaxHeadroom, bandwidth,
+              1.0);
+
+  // A blocked write still brings the estimate down
+  m_rate.Update(1000, 100000, kPeriod);
+  EXPECT_LT(m_rate.GetBandwidth(), bandwidth);
+}
+
+}  // namespace cs
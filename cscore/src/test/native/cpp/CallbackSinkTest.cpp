@@ -0,0 +1,92 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <wpi/mutex.h>
+
+#include "cscore.h"
+#include "cscore_raw.h"
+#include "gtest/gtest.h"
+
+namespace cs {
+
+class CallbackSinkTest : public ::testing::Test {
+ protected:
+  CallbackSinkTest() {
+    CS_AllocateRawFrameData(&m_frame, 16);
+    m_frame.width = 4;
+    m_frame.height = 4;
+    m_frame.pixelFormat = CS_PIXFMT_GRAY;
+    m_frame.totalData = 16;
+  }
+
+  ~CallbackSinkTest() override { CS_FreeRawFrameData(&m_frame); }
+
+  void PutFrame() {
+    CS_Status status = 0;
+    PutSourceFrame(m_source.GetHandle(), m_frame, &status);
+  }
+
+  // Waits for count to reach at least value
+  static void WaitFor(const std::atomic<int>& count, int value) {
+    for (int i = 0; i < 100 && count < value; ++i)
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  RawSource m_source{"source", VideoMode::kGray, 4, 4, 30};
+  RawFrame m_frame;
+};
+
+TEST_F(CallbackSinkTest, DeliversFrames) {
+  std::atomic<int> count{0};
+  std::atomic<int> width{0};
+  std::atomic<uint64_t> time{0};
+  RawSink sink{"sink", [&](CS_RawFrame& frame, uint64_t t) {
+                 width = frame.width;
+                 time = t;
+                 ++count;
+               }};
+  sink.SetSource(m_source);
+
+  PutFrame();
+  WaitFor(count, 1);
+  ASSERT_EQ(1, count);
+  EXPECT_EQ(4, width);
+  EXPECT_NE(0u, time);
+  EXPECT_EQ(0u, sink.GetDroppedFrameCount());
+}
+
+TEST_F(CallbackSinkTest, SlowCallbackDropsFrames) {
+  wpi::mutex gate;
+  std::atomic<int> entered{0};
+  std::atomic<int> count{0};
+  std::unique_lock lock(gate);
+  RawSink sink{"sink", [&](CS_RawFrame&, uint64_t) {
+                 ++entered;
+                 std::scoped_lock callbackLock(gate);
+                 ++count;
+               }};
+  sink.SetSource(m_source);
+
+  // Block the callback on the first frame; of the next three, only the latest
+  // is kept
+  PutFrame();
+  WaitFor(entered, 1);
+  ASSERT_EQ(1, entered);
+  for (int i = 0; i < 3; ++i) PutFrame();
+  lock.unlock();
+
+  WaitFor(count, 2);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(2, count);
+  EXPECT_EQ(2u, sink.GetDroppedFrameCount());
+}
+
+}  // namespace cs
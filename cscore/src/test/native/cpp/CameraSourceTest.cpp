@@ -1,11 +1,12 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
 /*----------------------------------------------------------------------------*/
 
 #include "cscore.h"
+#include "cscore_raw.h"
 #include "gtest/gtest.h"
 
 namespace cs {
@@ -19,4 +20,25 @@ TEST_F(CameraSourceTest, HTTPCamera) {
   auto source = HttpCamera("axis", "http://localhost:8000");
 }
 
+TEST_F(CameraSourceTest, SetProperties) {
+  RawSource source{"raw", VideoMode{VideoMode::kMJPEG, 320, 240, 30}};
+  auto a = source.CreateIntegerProperty("a", 0, 100, 1, 0, 0);
+  auto b = source.CreateBooleanProperty("b", false, false);
+  auto str = source.CreateStringProperty("str", "");
+
+  source.SetProperties({{a, 42}, {b, 1}});
+  EXPECT_EQ(0, source.GetLastStatus());
+  EXPECT_EQ(42, a.Get());
+  EXPECT_EQ(1, b.Get());
+
+  // The rest are still set when one of them fails
+  source.SetProperties({{str, 1}, {a, 43}});
+  EXPECT_EQ(CS_WRONG_PROPERTY_TYPE, source.GetLastStatus());
+  EXPECT_EQ(43, a.Get());
+
+  source.SetPropertiesAsync({{a, 44}});
+  EXPECT_EQ(0, source.GetLastStatus());
+  EXPECT_EQ(44, a.Get());
+}
+
 }  // namespace cs
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -13,4 +13,8 @@ public class ThreadsJNI extends JNIWrapper {
   public static native boolean getCurrentThreadIsRealTime();
 
   public static native boolean setCurrentThreadPriority(boolean realTime, int priority);
+
+  public static native boolean setCurrentThreadAffinity(int[] cpus);
+
+  public static native boolean lockMemory(int stackSize);
 }
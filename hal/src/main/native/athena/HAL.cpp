@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -205,6 +205,10 @@ const char* HAL_GetErrorMessage(int32_t code) {
       return HAL_THREAD_PRIORITY_ERROR_MESSAGE;
     case HAL_THREAD_PRIORITY_RANGE_ERROR:
       return HAL_THREAD_PRIORITY_RANGE_ERROR_MESSAGE;
+    case HAL_THREAD_AFFINITY_ERROR:
+      return HAL_THREAD_AFFINITY_ERROR_MESSAGE;
+    case HAL_MEMORY_LOCK_ERROR:
+      return HAL_MEMORY_LOCK_ERROR_MESSAGE;
     case HAL_SERIAL_PORT_OPEN_ERROR:
       return HAL_SERIAL_PORT_OPEN_ERROR_MESSAGE;
     case HAL_SERIAL_PORT_ERROR:
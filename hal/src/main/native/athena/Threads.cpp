@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -7,8 +7,16 @@
 
 #include "hal/Threads.h"
 
+#include <alloca.h>
+#include <malloc.h>
 #include <pthread.h>
 #include <sched.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
 
 #include "hal/Errors.h"
 
@@ -90,4 +98,79 @@ HAL_Bool HAL_SetCurrentThreadPriority(HAL_Bool realTime, int32_t priority,
   return HAL_SetThreadPriority(&thread, realTime, priority, status);
 }
 
+HAL_Bool HAL_SetThreadAffinity(NativeThreadHandle handle, const int32_t* cpus,
+                               int32_t count, int32_t* status) {
+  if (handle == nullptr || (cpus == nullptr && count > 0)) {
+    *status = NULL_PARAMETER;
+    return false;
+  }
+
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (count <= 0) {
+    for (int i = 0; i < CPU_SETSIZE; ++i) CPU_SET(i, &set);
+  } else {
+    for (int32_t i = 0; i < count; ++i) {
+      if (cpus[i] < 0 || cpus[i] >= CPU_SETSIZE) {
+        *status = PARAMETER_OUT_OF_RANGE;
+        return false;
+      }
+      CPU_SET(cpus[i], &set);
+    }
+  }
+
+  if (pthread_setaffinity_np(*reinterpret_cast<const pthread_t*>(handle),
+                             sizeof(set), &set)) {
+    *status = HAL_THREAD_AFFINITY_ERROR;
+    return false;
+  } else {
+    *status = 0;
+    return true;
+  }
+}
+
+HAL_Bool HAL_SetCurrentThreadAffinity(const int32_t* cpus, int32_t count,
+                                      int32_t* status) {
+  auto thread = pthread_self();
+  return HAL_SetThreadAffinity(&thread, cpus, count, status);
+}
+
+HAL_Bool HAL_LockMemory(int32_t stackSize, int32_t* status) {
+  if (mlockall(MCL_CURRENT | MCL_FUTURE)) {
+    *status = HAL_MEMORY_LOCK_ERROR;
+    return false;
+  }
+
+  // Keep freed heap memory mapped, and don't satisfy large allocations with
+  // fresh mappings that would fault on first use
+  mallopt(M_TRIM_THRESHOLD, -1);
+  mallopt(M_MMAP_MAX, 0);
+
+  // Touch each page of the stack now, so it doesn't fault later.  Leave room
+  // for the frames already in use so this can't overflow the stack.
+  constexpr size_t kStackMargin = 64 * 1024;
+  size_t available = SIZE_MAX;
+  rlimit limit;
+  if (getrlimit(RLIMIT_STACK, &limit) == 0 && limit.rlim_cur != RLIM_INFINITY)
+    available = limit.rlim_cur;
+  pthread_attr_t attr;
+  if (pthread_getattr_np(pthread_self(), &attr) == 0) {
+    size_t size;
+    if (pthread_attr_getstacksize(&attr, &size) == 0)
+      available = std::min(available, size);
+    pthread_attr_destroy(&attr);
+  }
+  available = available > kStackMargin ? available - kStackMargin : 0;
+  if (stackSize > 0 && static_cast<size_t>(stackSize) > available)
+    stackSize = static_cast<int32_t>(available);
+  if (stackSize > 0) {
+    volatile char* stack = static_cast<char*>(alloca(stackSize));
+    long pageSize = sysconf(_SC_PAGESIZE);  // NOLINT(runtime/int)
+    for (int32_t i = 0; i < stackSize; i += pageSize) stack[i] = 0;
+  }
+
+  *status = 0;
+  return true;
+}
+
 }  // extern "C"
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -8,12 +8,16 @@
 #include <jni.h>
 
 #include <cassert>
+#include <vector>
+
+#include <wpi/jni_util.h>
 
 #include "HALUtil.h"
 #include "edu_wpi_first_hal_ThreadsJNI.h"
 #include "hal/Threads.h"
 
 using namespace frc;
+using namespace wpi::java;
 
 extern "C" {
 /*
@@ -64,4 +68,37 @@ Java_edu_wpi_first_hal_ThreadsJNI_setCurrentThreadPriority
   return (jboolean)ret;
 }
 
+/*
+ * Class:     edu_wpi_first_hal_ThreadsJNI
+ * Method:    setCurrentThreadAffinity
+ * Signature: ([I)Z
+ */
+JNIEXPORT jboolean JNICALL
+Java_edu_wpi_first_hal_ThreadsJNI_setCurrentThreadAffinity
+  (JNIEnv* env, jclass, jintArray cpus)
+{
+  JIntArrayRef ref(env, cpus);
+  std::vector<int32_t> cpusVec(ref.array().begin(), ref.array().end());
+  int32_t status = 0;
+  auto ret = HAL_SetCurrentThreadAffinity(
+      cpusVec.data(), static_cast<int32_t>(cpusVec.size()), &status);
+  CheckStatus(env, status);
+  return (jboolean)ret;
+}
+
+/*
+ * Class:     edu_wpi_first_hal_ThreadsJNI
+ * Method:    lockMemory
+ * Signature: (I)Z
+ */
+JNIEXPORT jboolean JNICALL
+Java_edu_wpi_first_hal_ThreadsJNI_lockMemory
+  (JNIEnv* env, jclass, jint stackSize)
+{
+  int32_t status = 0;
+  auto ret = HAL_LockMemory(static_cast<int32_t>(stackSize), &status);
+  CheckStatus(env, status);
+  return (jboolean)ret;
+}
+
 }  // extern "C"
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -128,6 +128,13 @@
 #define HAL_SIM_NOT_SUPPORTED -1155
 #define HAL_SIM_NOT_SUPPORTED_MESSAGE "HAL: Method not supported in sim"
 
+#define HAL_THREAD_AFFINITY_ERROR -1156
+#define HAL_THREAD_AFFINITY_ERROR_MESSAGE \
+  "HAL: Setting the CPU affinity of a thread has failed"
+
+#define HAL_MEMORY_LOCK_ERROR -1157
+#define HAL_MEMORY_LOCK_ERROR_MESSAGE "HAL: Locking process memory has failed"
+
 #define HAL_CAN_BUFFER_OVERRUN -35007
 #define HAL_CAN_BUFFER_OVERRUN_MESSAGE \
   "HAL: CAN Output Buffer Full. Ensure a device is attached"
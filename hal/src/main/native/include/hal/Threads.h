@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -72,6 +72,48 @@ HAL_Bool HAL_SetThreadPriority(NativeThreadHandle handle, HAL_Bool realTime,
 HAL_Bool HAL_SetCurrentThreadPriority(HAL_Bool realTime, int32_t priority,
                                       int32_t* status);
 
+/**
+ * Sets the CPUs the specified thread may run on.
+ *
+ * Ignored in simulation.
+ *
+ * @param handle Native handle pointer to the thread to set the affinity of
+ * @param cpus   The CPU numbers, starting from 0
+ * @param count  The number of CPUs, or 0 to allow all CPUs
+ * @param status Error status variable. 0 on success
+ * @return       The success state of setting the affinity
+ */
+HAL_Bool HAL_SetThreadAffinity(NativeThreadHandle handle, const int32_t* cpus,
+                               int32_t count, int32_t* status);
+
+/**
+ * Sets the CPUs the current thread may run on.
+ *
+ * Ignored in simulation.
+ *
+ * @param cpus   The CPU numbers, starting from 0
+ * @param count  The number of CPUs, or 0 to allow all CPUs
+ * @param status Error status variable. 0 on success
+ * @return       The success state of setting the affinity
+ */
+HAL_Bool HAL_SetCurrentThreadAffinity(const int32_t* cpus, int32_t count,
+                                      int32_t* status);
+
+/**
+ * Locks all current and future process memory into RAM, so real-time threads
+ * never wait on a page fault, and prefaults the current thread's stack.
+ *
+ * Heap memory is also kept from being returned to the operating system, since
+ * it would fault again when reused.
+ *
+ * Ignored in simulation.
+ *
+ * @param stackSize Bytes of the current thread's stack to prefault
+ * @param status    Error status variable. 0 on success
+ * @return          The success state of locking memory
+ */
+HAL_Bool HAL_LockMemory(int32_t stackSize, int32_t* status);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
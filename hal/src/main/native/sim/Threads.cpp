@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2017-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2017-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -28,3 +28,12 @@ HAL_Bool HAL_SetCurrentThreadPriority(HAL_Bool realTime, int32_t priority,
                                       int32_t* status) {
   return true;
 }
+HAL_Bool HAL_SetThreadAffinity(NativeThreadHandle handle, const int32_t* cpus,
+                               int32_t count, int32_t* status) {
+  return true;
+}
+HAL_Bool HAL_SetCurrentThreadAffinity(const int32_t* cpus, int32_t count,
+                                      int32_t* status) {
+  return true;
+}
+HAL_Bool HAL_LockMemory(int32_t stackSize, int32_t* status) { return true; }
@@ -0,0 +1,75 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include <wpi/Format.h>
+#include <wpi/SmallString.h>
+#include <wpi/raw_ostream.h>
+
+#include "ntcore.h"
+
+// Returns the number of heap bytes currently in use, including allocator
+// overhead, or -1 if the platform doesn't expose it.
+static int64_t GetHeapInUse() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+  return mallinfo2().uordblks;
+#elif defined(__GLIBC__)
+  return static_cast<unsigned int>(mallinfo().uordblks);
+#else
+  return -1;
+#endif
+}
+
+// Creates count entries with dashboard-style names and a mix of value types,
+// and reports the heap growth per entry.
+static void RunEntries(int count) {
+  static const char* const kModules[] = {"LeftFront", "RightFront", "LeftRear",
+                                         "RightRear"};
+  static const char* const kFields[] = {"Velocity", "Angle",   "Current",
+                                        "Voltage",  "Enabled", "Mode",
+                                        "Setpoint", "Position"};
+
+  auto inst = nt::CreateInstance();
+  int64_t start = GetHeapInUse();
+
+  wpi::SmallString<128> name;
+  for (int i = 0; i < count; ++i) {
+    name.clear();
+    wpi::raw_svector_ostream os{name};
+    os << "/SmartDashboard/Subsystem" << (i / 32) << '/' << kModules[i / 8 % 4]
+       << "Module/" << kFields[i % 8];
+    auto entry = nt::GetEntry(inst, name);
+    if (i % 8 == 4) {
+      nt::SetEntryValue(entry, nt::Value::MakeBoolean(true));
+    } else if (i % 8 == 5) {
+      nt::SetEntryValue(entry, nt::Value::MakeString("Auto"));
+    } else {
+      nt::SetEntryValue(entry, nt::Value::MakeDouble(i * 0.5));
+    }
+  }
+
+  int64_t bytes = GetHeapInUse() - start;
+  wpi::outs() << count << " entries: "
+              << wpi::format("%.1f", static_cast<double>(bytes) / count)
+              << " heap bytes/entry\n";
+  wpi::outs().flush();
+  nt::DestroyInstance(inst);
+}
+
+void RunMemoryBenchmark() {
+  if (GetHeapInUse() < 0) {
+    wpi::outs() << "heap usage not available on this platform\n";
+    return;
+  }
+  RunEntries(10000);
+  RunEntries(100000);
+}
@@ -0,0 +1,124 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <wpi/Format.h>
+#include <wpi/Twine.h>
+#include <wpi/raw_ostream.h>
+
+#include "ntcore.h"
+
+static constexpr int kEntries = 16;
+static constexpr int kReads = 20000;
+
+#ifdef __GLIBC__
+// Count every malloc() (operator new uses it too) by interposing on glibc's.
+extern "C" void* __libc_malloc(size_t size);
+
+static std::atomic<uint64_t> gMallocs{0};
+
+extern "C" void* malloc(size_t size) {
+  gMallocs.fetch_add(1, std::memory_order_relaxed);
+  return __libc_malloc(size);
+}
+
+static int64_t GetMallocCount() { return gMallocs.load(); }
+#else
+static int64_t GetMallocCount() { return -1; }
+#endif
+
+// Runs kReads passes of read over all of the entries, and reports the
+// allocations and time per entry read.
+template <typename F>
+static void Run(const char* name, F&& read) {
+  int64_t startMallocs = GetMallocCount();
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kReads; ++i) read();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  int64_t mallocs = GetMallocCount() - startMallocs;
+
+  double reads = static_cast<double>(kReads) * kEntries;
+  wpi::outs() << name << ": "
+              << wpi::format("%.1f", elapsed.count() * 1e9 / reads)
+              << " ns/read";
+  if (startMallocs >= 0)
+    wpi::outs() << ", " << wpi::format("%.2f", mallocs / reads)
+                << " mallocs/read";
+  wpi::outs() << '\n';
+  wpi::outs().flush();
+}
+
+// Polls array entries the way a LabVIEW dashboard does, through the
+// allocating C getters and through the caller-buffer variants.
+void RunReadBenchmark() {
+  auto inst = NT_CreateInstance();
+
+  std::vector<NT_Entry> doubleEntries;
+  std::vector<NT_Entry> stringEntries;
+  std::vector<double> doubles(64, 1.5);
+  std::vector<NT_String> strings(8);
+  for (auto& str : strings) {
+    str.str = const_cast<char*>("Telemetry");
+    str.len = 9;
+  }
+  for (int i = 0; i < kEntries; ++i) {
+    std::string name = ("/Arrays/Double" + wpi::Twine(i)).str();
+    doubleEntries.push_back(NT_GetEntry(inst, name.data(), name.size()));
+    NT_SetEntryDoubleArray(doubleEntries.back(), 0, doubles.data(),
+                           doubles.size(), 0);
+    name = ("/Arrays/String" + wpi::Twine(i)).str();
+    stringEntries.push_back(NT_GetEntry(inst, name.data(), name.size()));
+    NT_SetEntryStringArray(stringEntries.back(), 0, strings.data(),
+                           strings.size(), 0);
+  }
+
+  Run("NT_GetEntryDoubleArray", [&] {
+    for (auto entry : doubleEntries) {
+      uint64_t last_change;
+      size_t size;
+      NT_FreeDoubleArray(NT_GetEntryDoubleArray(entry, &last_change, &size));
+    }
+  });
+
+  Run("NT_GetEntryDoubleArrayBuffer", [&] {
+    for (auto entry : doubleEntries) {
+      uint64_t last_change;
+      size_t size = doubles.size();
+      NT_GetEntryDoubleArrayBuffer(entry, &last_change, doubles.data(), &size);
+    }
+  });
+
+  Run("NT_GetEntryValue (string arrays)", [&] {
+    for (auto entry : stringEntries) {
+      NT_Value value;
+      NT_GetEntryValue(entry, &value);
+      NT_DisposeValue(&value);
+    }
+  });
+
+  std::vector<NT_Value> values(kEntries);
+  std::vector<double> buf(
+      NT_GetEntryValuesBuffer(stringEntries.data(), kEntries, values.data(),
+                              nullptr, 0) /
+          sizeof(double) +
+      1);
+  Run("NT_GetEntryValuesBuffer (string arrays)", [&] {
+    NT_GetEntryValuesBuffer(stringEntries.data(), kEntries, values.data(),
+                            reinterpret_cast<char*>(buf.data()),
+                            buf.size() * sizeof(double));
+  });
+
+  NT_DestroyInstance(inst);
+}
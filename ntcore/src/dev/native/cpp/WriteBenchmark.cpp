@@ -0,0 +1,115 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <wpi/Format.h>
+#include <wpi/Twine.h>
+#include <wpi/raw_ostream.h>
+
+#include "ntcore.h"
+
+static constexpr int kEntriesPerThread = 16;
+static constexpr int kWritesPerThread = 200000;
+
+// Each thread repeatedly updates its own set of entries, like several robot
+// threads publishing telemetry.
+static void RunWriters(int numThreads) {
+  auto inst = nt::CreateInstance();
+
+  std::vector<std::vector<NT_Entry>> entries(numThreads);
+  for (int t = 0; t < numThreads; ++t) {
+    for (int i = 0; i < kEntriesPerThread; ++i) {
+      entries[t].push_back(nt::GetEntry(inst, "/Telemetry/Thread" +
+                                                  wpi::Twine(t) + "/Value" +
+                                                  wpi::Twine(i)));
+      nt::SetEntryValue(entries[t].back(), nt::Value::MakeDouble(0));
+    }
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (int t = 0; t < numThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 1; i <= kWritesPerThread; ++i) {
+        nt::SetEntryValue(entries[t][i % kEntriesPerThread],
+                          nt::Value::MakeDouble(i));
+      }
+    });
+  }
+  for (auto& thr : threads) thr.join();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  double writes = static_cast<double>(numThreads) * kWritesPerThread;
+  wpi::outs() << numThreads << " writer threads: "
+              << wpi::format("%.2f", writes / elapsed.count() / 1e6)
+              << " M writes/s\n";
+  wpi::outs().flush();
+  nt::DestroyInstance(inst);
+}
+
+// Storage locks entries by stripe (local id % 16, and local ids are given out
+// in creation order).  Each thread updates its own entries, which are either
+// all in a stripe of its own or all in the same stripe as every other
+// thread's, so the difference between the two is the cost of contending for
+// a stripe.
+static constexpr int kStripes = 16;
+static constexpr int kEntriesPerStripeThread = 8;
+
+static double RunStripeWriters(int numThreads, bool shareStripe) {
+  auto inst = nt::CreateInstance();
+
+  std::vector<NT_Entry> all;
+  for (int i = 0; i < kStripes * kEntriesPerStripeThread * numThreads; ++i) {
+    all.push_back(nt::GetEntry(inst, "/Stripes/Value" + wpi::Twine(i)));
+    nt::SetEntryValue(all.back(), nt::Value::MakeDouble(0));
+  }
+  std::vector<std::vector<NT_Entry>> entries(numThreads);
+  for (int t = 0; t < numThreads; ++t) {
+    for (int i = 0; i < kEntriesPerStripeThread; ++i) {
+      // shared: stripe 0, a different row for each thread
+      // own: stripe t
+      int index = shareStripe ? (t * kEntriesPerStripeThread + i) * kStripes
+                              : i * kStripes + t;
+      entries[t].push_back(all[index]);
+    }
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (int t = 0; t < numThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 1; i <= kWritesPerThread; ++i) {
+        nt::SetEntryValue(entries[t][i % kEntriesPerStripeThread],
+                          nt::Value::MakeDouble(i));
+      }
+    });
+  }
+  for (auto& thr : threads) thr.join();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  nt::DestroyInstance(inst);
+
+  return static_cast<double>(numThreads) * kWritesPerThread /
+         elapsed.count() / 1e6;
+}
+
+void RunWriteBenchmark() {
+  for (int numThreads : {1, 2, 4, 8}) RunWriters(numThreads);
+  for (int numThreads : {1, 2, 4, 8}) {
+    double own = RunStripeWriters(numThreads, false);
+    double shared = RunStripeWriters(numThreads, true);
+    wpi::outs() << numThreads << " writer threads: "
+                << wpi::format("%.2f", own) << " M writes/s in own stripes, "
+                << wpi::format("%.2f", shared)
+                << " M writes/s in one stripe\n";
+    wpi::outs().flush();
+  }
+}
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2017-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2017-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -9,10 +9,18 @@
 
 #include "ntcore.h"
 
+void RunMemoryBenchmark();
+void RunReadBenchmark();
+void RunWriteBenchmark();
+
 int main() {
   auto myValue = nt::GetEntry(nt::GetDefaultInstance(), "MyValue");
 
   nt::SetEntryValue(myValue, nt::Value::MakeString("Hello World"));
 
   std::cout << nt::GetEntryValue(myValue)->GetString() << std::endl;
+
+  RunMemoryBenchmark();
+  RunReadBenchmark();
+  RunWriteBenchmark();
 }
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2017-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2017-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -44,6 +44,20 @@ public final class ConnectionInfo {
   @SuppressWarnings("MemberName")
   public final int protocol_version;
 
+  /**
+   * The most recently measured round trip time to the remote node, in
+   * microseconds.  This is a single sample, not an average.  Only measured
+   * with protocol 3.1; 0 if not known.
+   */
+  @SuppressWarnings("MemberName")
+  public final int rtt;
+
+  /**
+   * The smoothed variation of the round trip time, in microseconds.
+   */
+  @SuppressWarnings("MemberName")
+  public final int rtt_jitter;
+
   /** Constructor.
    * This should generally only be used internally to NetworkTables.
    *
@@ -55,10 +69,28 @@ public final class ConnectionInfo {
    */
   public ConnectionInfo(String remoteId, String remoteIp, int remotePort, long lastUpdate,
                         int protocolVersion) {
+    this(remoteId, remoteIp, remotePort, lastUpdate, protocolVersion, 0, 0);
+  }
+
+  /** Constructor.
+   * This should generally only be used internally to NetworkTables.
+   *
+   * @param remoteId Remote identifier
+   * @param remoteIp Remote IP address
+   * @param remotePort Remote port number
+   * @param lastUpdate Last time an update was received
+   * @param protocolVersion The protocol version used for the connection
+   * @param rtt Most recent round trip time, in microseconds
+   * @param rttJitter Round trip time variation, in microseconds
+   */
+  public ConnectionInfo(String remoteId, String remoteIp, int remotePort, long lastUpdate,
+                        int protocolVersion, int rtt, int rttJitter) {
     remote_id = remoteId;
     remote_ip = remoteIp;
     remote_port = remotePort;
     last_update = lastUpdate;
     protocol_version = protocolVersion;
+    this.rtt = rtt;
+    rtt_jitter = rttJitter;
   }
 }
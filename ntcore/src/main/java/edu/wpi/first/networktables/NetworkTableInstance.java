@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2017-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2017-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -9,6 +9,7 @@ package edu.wpi.first.networktables;
 
 import java.util.HashMap;
 import java.util.Map;
+import java.util.OptionalLong;
 import java.util.concurrent.ConcurrentHashMap;
 import java.util.concurrent.ConcurrentMap;
 import java.util.concurrent.TimeUnit;
@@ -948,6 +949,23 @@ public final class NetworkTableInstance implements AutoCloseable {
     NetworkTablesJNI.setUpdateRate(m_handle, interval);
   }
 
+  /**
+   * Set the dead peer timeout.  Connections using protocol 3.1 exchange
+   * heartbeats in both directions, and a connection that has received
+   * nothing from its peer for this long is closed (and a client reconnects).
+   * The timeout is never shorter than three update intervals.
+   *
+   * <p>Dead peer detection is opt-in: the timeout is 0 (disabled) until this
+   * is called, so by default a peer that stops responding without closing the
+   * connection is only noticed when TCP gives up.  A few seconds is a
+   * reasonable value on a robot network.
+   *
+   * @param timeout timeout in seconds (0 to disable)
+   */
+  public void setConnectionTimeout(double timeout) {
+    NetworkTablesJNI.setConnectionTimeout(m_handle, timeout);
+  }
+
   /**
    * Flushes all updated values immediately to the network.
    * Note: This is rate-limited to protect the network from flooding.
@@ -977,6 +995,28 @@ public final class NetworkTableInstance implements AutoCloseable {
     return NetworkTablesJNI.isConnected(m_handle);
   }
 
+  /**
+   * Get the offset of the server clock from the local clock.  Adding the
+   * offset to a local timestamp gives the corresponding server time.
+   *
+   * @return Server time minus local time, in microseconds, or empty if not
+   *         connected or the clocks are not yet synchronized.
+   */
+  public OptionalLong getServerTimeOffset() {
+    Long offset = NetworkTablesJNI.getServerTimeOffset(m_handle);
+    return offset == null ? OptionalLong.empty() : OptionalLong.of(offset);
+  }
+
+  /**
+   * Send value timestamps along with updates, so receivers see the time a
+   * value was set by its publisher instead of the time it arrived.
+   *
+   * @param enable true to send timestamps
+   */
+  public void setPublishTimestamps(boolean enable) {
+    NetworkTablesJNI.setPublishTimestamps(m_handle, enable);
+  }
+
   /**
    * Saves persistent keys to a file.  The server does this automatically.
    *
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2017-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2017-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -154,6 +154,7 @@ public final class NetworkTablesJNI {
   public static native void startDSClient(int inst, int port);
   public static native void stopDSClient(int inst);
   public static native void setUpdateRate(int inst, double interval);
+  public static native void setConnectionTimeout(int inst, double timeout);
 
   public static native void flush(int inst);
 
@@ -161,6 +162,9 @@ public final class NetworkTablesJNI {
 
   public static native boolean isConnected(int inst);
 
+  public static native Long getServerTimeOffset(int inst);
+  public static native void setPublishTimestamps(int inst, boolean enable);
+
   public static native void savePersistent(int inst, String filename) throws PersistentException;
   public static native String[] loadPersistent(int inst, String filename) throws PersistentException;  // returns warnings
 
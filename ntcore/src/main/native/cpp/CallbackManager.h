@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2017-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2017-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -17,6 +17,7 @@
 #include <vector>
 
 #include <wpi/SafeThread.h>
+#include <wpi/ThreadHooks.h>
 #include <wpi/UidVector.h>
 #include <wpi/condition_variable.h>
 #include <wpi/mutex.h>
@@ -104,6 +105,7 @@ class CallbackThread : public wpi::SafeThread {
 template <typename Derived, typename TUserInfo, typename TListenerData,
           typename TNotifierData>
 void CallbackThread<Derived, TUserInfo, TListenerData, TNotifierData>::Main() {
+  wpi::SetCurrentThreadName("NTCallback");
   std::unique_lock lock(m_mutex);
   while (m_active) {
     while (m_queue.empty()) {
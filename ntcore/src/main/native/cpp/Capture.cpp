@@ -0,0 +1,101 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include "Capture.h"
+
+#include <cstring>
+
+#include <wpi/FileSystem.h>
+#include <wpi/SmallString.h>
+#include <wpi/leb128.h>
+#include <wpi/raw_istream.h>
+#include <wpi/raw_ostream.h>
+#include <wpi/timestamp.h>
+
+#include "Message.h"
+
+using namespace nt;
+
+CaptureWriter::~CaptureWriter() { Stop(); }
+
+bool CaptureWriter::Start(const Twine& filename) {
+  std::error_code ec;
+  auto os = std::make_unique<wpi::raw_fd_ostream>(filename.str(), ec,
+                                                  wpi::sys::fs::F_None);
+  if (ec.value() != 0) return false;
+  Start(std::move(os));
+  return true;
+}
+
+void CaptureWriter::Start(std::unique_ptr<wpi::raw_ostream> os) {
+  std::scoped_lock lock(m_mutex);
+  m_os = std::move(os);
+  *m_os << wpi::StringRef(kCaptureMagic, kCaptureMagicLen);
+  m_last_time = 0;
+  m_active = true;
+}
+
+void CaptureWriter::Stop() {
+  std::scoped_lock lock(m_mutex);
+  m_active = false;
+  m_os.reset();  // flushes and closes
+}
+
+void CaptureWriter::Record(unsigned int conn, bool outgoing,
+                           const Message& msg) {
+  if (!m_active) return;
+  std::scoped_lock lock(m_mutex);
+  if (!m_os) return;
+
+  m_encoder.Reset();
+  msg.Write(m_encoder);
+  if (m_encoder.size() == 0 || m_encoder.error()) return;
+
+  uint64_t now = wpi::Now();
+  wpi::SmallString<16> header;
+  wpi::WriteUleb128(header, now - m_last_time);
+  wpi::WriteUleb128(header, conn);
+  header.push_back(outgoing ? kCaptureOutgoing : 0);
+  m_last_time = now;
+  *m_os << header << m_encoder.ToStringRef();
+}
+
+CaptureReader::CaptureReader(wpi::raw_istream& is, wpi::Logger& logger)
+    : m_is(is), m_decoder(is, 0x0300u, logger) {}
+
+bool CaptureReader::ReadHeader() {
+  char magic[kCaptureMagicLen];
+  m_is.read(magic, kCaptureMagicLen);
+  return !m_is.has_error() &&
+         std::memcmp(magic, kCaptureMagic, kCaptureMagicLen) == 0;
+}
+
+bool CaptureReader::Read(Record* rec) {
+  m_decoder.Reset();
+  uint64_t delta, conn;
+  unsigned int flags;
+  // a clean end of file is just the end of the capture
+  if (!m_decoder.ReadUleb128(&delta)) return false;
+  if (!m_decoder.ReadUleb128(&conn) || !m_decoder.Read8(&flags)) {
+    m_decoder.set_error("truncated record");
+    return false;
+  }
+  // 3.0 updates carry their type
+  auto msg =
+      Message::Read(m_decoder, [](unsigned int) { return NT_UNASSIGNED; });
+  if (!msg) {
+    if (!m_decoder.error()) m_decoder.set_error("truncated record");
+    return false;
+  }
+
+  m_time += delta;
+  rec->time = m_time;
+  rec->conn = static_cast<unsigned int>(conn);
+  rec->outgoing = (flags & kCaptureOutgoing) != 0;
+  rec->msg = std::move(msg);
+  return true;
+}
@@ -0,0 +1,102 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#ifndef NTCORE_CAPTURE_H_
+#define NTCORE_CAPTURE_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+
+#include <wpi/Twine.h>
+#include <wpi/mutex.h>
+
+#include "WireDecoder.h"
+#include "WireEncoder.h"
+
+namespace wpi {
+class Logger;
+class raw_istream;
+class raw_ostream;
+}  // namespace wpi
+
+namespace nt {
+
+class Message;
+
+/* Traffic capture file format.  The file starts with kCaptureMagic, followed
+ * by one record per message:
+ *   time since the previous record (the first record: since the epoch of
+ *     wpi::Now()), in microseconds, as ULEB128
+ *   connection uid, as ULEB128
+ *   flags (kCaptureOutgoing), 1 byte
+ *   the message, encoded as protocol revision 3.0 (so updates are
+ *     self-describing, even in a capture started mid-connection)
+ * Messages that only exist in protocol revision 3.1 (time sync and value
+ * history) are not recorded.
+ */
+constexpr char kCaptureMagic[] = "NTCAP\x01";
+constexpr size_t kCaptureMagicLen = sizeof(kCaptureMagic) - 1;
+constexpr unsigned int kCaptureOutgoing = 0x01;
+
+class CaptureWriter {
+ public:
+  CaptureWriter() = default;
+  ~CaptureWriter();
+
+  // Starts capturing to a file (replacing any current capture).  Returns
+  // false if the file could not be opened.
+  bool Start(const Twine& filename);
+  void Start(std::unique_ptr<wpi::raw_ostream> os);
+  void Stop();
+
+  bool active() const { return m_active; }
+
+  // Records a message sent or received on connection conn.  Thread safe.
+  void Record(unsigned int conn, bool outgoing, const Message& msg);
+
+  CaptureWriter(const CaptureWriter&) = delete;
+  CaptureWriter& operator=(const CaptureWriter&) = delete;
+
+ private:
+  std::atomic_bool m_active{false};
+  wpi::mutex m_mutex;
+  std::unique_ptr<wpi::raw_ostream> m_os;
+  WireEncoder m_encoder{0x0300u};
+  uint64_t m_last_time = 0;
+};
+
+class CaptureReader {
+ public:
+  struct Record {
+    uint64_t time;
+    unsigned int conn;
+    bool outgoing;
+    std::shared_ptr<Message> msg;
+  };
+
+  CaptureReader(wpi::raw_istream& is, wpi::Logger& logger);
+
+  // Returns false if the stream is not a capture.
+  bool ReadHeader();
+
+  // Reads the next record.  Returns false at the end of the capture or on
+  // error (in which case error() is set).
+  bool Read(Record* rec);
+
+  const char* error() const { return m_decoder.error(); }
+
+ private:
+  wpi::raw_istream& m_is;
+  WireDecoder m_decoder;
+  uint64_t m_time = 0;
+};
+
+}  // namespace nt
+
+#endif  // NTCORE_CAPTURE_H_
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -12,6 +12,8 @@
 
 #include <wpi/TCPAcceptor.h>
 #include <wpi/TCPConnector.h>
+#include <wpi/ThreadHooks.h>
+#include <wpi/Trace.h>
 
 #include "IConnectionNotifier.h"
 #include "IStorage.h"
@@ -200,6 +202,7 @@ void DispatcherBase::Stop() {
 
   // close all connections
   conns.resize(0);
+  m_storage.CancelHistoryRequests();
 }
 
 void DispatcherBase::SetUpdateRate(double interval) {
@@ -252,6 +255,43 @@ bool DispatcherBase::IsConnected() const {
   return false;
 }
 
+void DispatcherBase::SetPublishTimestamps(bool enable) {
+  std::scoped_lock lock(m_user_mutex);
+  m_publish_timestamps = enable;
+  for (auto& conn : m_connections) conn->set_publish_timestamps(enable);
+}
+
+void DispatcherBase::SetConnectionTimeout(double timeout) {
+  if (timeout < 0) timeout = 0;
+  m_timeout = static_cast<unsigned int>(timeout * 1000);
+}
+
+bool DispatcherBase::StartCapture(const Twine& filename) {
+  if (!m_capture.Start(filename)) {
+    WARNING("could not open capture file '" << filename << "'");
+    return false;
+  }
+  return true;
+}
+
+void DispatcherBase::StopCapture() { m_capture.Stop(); }
+
+bool DispatcherBase::GetServerTimeOffset(int64_t* offset) const {
+  if (!m_active) return false;
+  if ((m_networkMode & NT_NET_MODE_SERVER) != 0) {
+    *offset = 0;
+    return true;
+  }
+
+  std::scoped_lock lock(m_user_mutex);
+  for (auto& conn : m_connections) {
+    if (conn->state() != NetworkConnection::kActive) continue;
+    if (conn->GetTimeOffset(offset)) return true;
+  }
+
+  return false;
+}
+
 unsigned int DispatcherBase::AddListener(
     std::function<void(const ConnectionNotification& event)> callback,
     bool immediate_notify) const {
@@ -297,6 +337,7 @@ void DispatcherBase::ClearConnectorOverride() {
 }
 
 void DispatcherBase::DispatchThreadMain() {
+  wpi::SetCurrentThreadName("NTDispatch");
   auto timeout_time = std::chrono::steady_clock::now();
 
   static const auto save_delta_time = std::chrono::seconds(1);
@@ -318,6 +359,8 @@ void DispatcherBase::DispatchThreadMain() {
     flush_lock.unlock();
     if (!m_active) break;  // in case we were woken up to terminate
 
+    wpi::TraceScope trace{"Dispatcher::DispatchThreadMain"};
+
     // perform periodic persistent save
     if ((m_networkMode & NT_NET_MODE_SERVER) != 0 &&
         !m_persist_filename.empty() && start > next_save_time) {
@@ -328,6 +371,11 @@ void DispatcherBase::DispatchThreadMain() {
       if (err) WARNING("periodic persistent save: " << err);
     }
 
+    // heartbeats only go out once per update, so don't time out faster
+    // than a few of those
+    unsigned int timeout = m_timeout;
+    if (timeout != 0) timeout = std::max(timeout, 3 * m_update_rate);
+
     {
       std::scoped_lock user_lock(m_user_mutex);
       bool reconnect = false;
@@ -340,16 +388,20 @@ void DispatcherBase::DispatchThreadMain() {
       for (auto& conn : m_connections) {
         // post outgoing messages if connection is active
         // only send keep-alives on client
-        if (conn->state() == NetworkConnection::kActive)
+        if (conn->state() == NetworkConnection::kActive) {
+          conn->set_timeout(timeout);
           conn->PostOutgoing((m_networkMode & NT_NET_MODE_CLIENT) != 0);
+        }
 
         // if client, reconnect if connection died
         if ((m_networkMode & NT_NET_MODE_CLIENT) != 0 &&
             conn->state() == NetworkConnection::kDead)
           reconnect = true;
       }
-      // reconnect if we disconnected (and a reconnect is not in progress)
+      // reconnect if we disconnected (and a reconnect is not in progress);
+      // nothing will answer the requests sent on the old connection
       if (reconnect && !m_do_reconnect) {
+        m_storage.CancelHistoryRequests();
         m_do_reconnect = true;
         m_reconnect_cv.notify_one();
       }
@@ -372,7 +424,21 @@ void DispatcherBase::QueueOutgoing(std::shared_ptr<Message> msg,
   }
 }
 
+unsigned int DispatcherBase::GetMaxProtoRev() const {
+  std::scoped_lock user_lock(m_user_mutex);
+  unsigned int proto_rev = 0;
+  for (auto& conn : m_connections) {
+    auto state = conn->state();
+    if (state != NetworkConnection::kSynchronized &&
+        state != NetworkConnection::kActive)
+      continue;
+    proto_rev = (std::max)(proto_rev, conn->proto_rev());
+  }
+  return proto_rev;
+}
+
 void DispatcherBase::ServerThreadMain() {
+  wpi::SetCurrentThreadName("NTServer");
   if (m_server_acceptor->start() != 0) {
     m_active = false;
     m_networkMode = NT_NET_MODE_SERVER | NT_NET_MODE_FAILURE;
@@ -401,8 +467,12 @@ void DispatcherBase::ServerThreadMain() {
     conn->set_process_incoming(
         std::bind(&IStorage::ProcessIncoming, &m_storage, _1, _2,
                   std::weak_ptr<NetworkConnection>(conn)));
+    conn->set_capture(&m_capture);
+    // the server clock is the reference for all connections
+    conn->SetTimeReference();
     {
       std::scoped_lock lock(m_user_mutex);
+      conn->set_publish_timestamps(m_publish_timestamps);
       // reuse dead connection slots
       bool placed = false;
       for (auto& c : m_connections) {
@@ -420,6 +490,7 @@ void DispatcherBase::ServerThreadMain() {
 }
 
 void DispatcherBase::ClientThreadMain() {
+  wpi::SetCurrentThreadName("NTClient");
   while (m_active) {
     // sleep between retries
     std::this_thread::sleep_for(std::chrono::milliseconds(250));
@@ -458,13 +529,15 @@ void DispatcherBase::ClientThreadMain() {
     conn->set_process_incoming(
         std::bind(&IStorage::ProcessIncoming, &m_storage, _1, _2,
                   std::weak_ptr<NetworkConnection>(conn)));
+    conn->set_capture(&m_capture);
     m_connections.resize(0);  // disconnect any current
     m_connections.emplace_back(conn);
     conn->set_proto_rev(m_reconnect_proto_rev);
+    conn->set_publish_timestamps(m_publish_timestamps);
     conn->Start();
 
     // reconnect the next time starting with latest protocol revision
-    m_reconnect_proto_rev = 0x0300;
+    m_reconnect_proto_rev = 0x0301;
 
     // block until told to reconnect
     m_do_reconnect = false;
@@ -496,7 +569,8 @@ bool DispatcherBase::ClientHandshake(
   }
 
   if (msg->Is(Message::kProtoUnsup)) {
-    if (msg->id() == 0x0200) ClientReconnect(0x0200);
+    // retry with the revision the server supports (a 3.0 server rejects 3.1)
+    if (msg->id() == 0x0200 || msg->id() == 0x0300) ClientReconnect(msg->id());
     return false;
   }
 
@@ -569,8 +643,8 @@ bool DispatcherBase::ServerHandshake(
 
   // Check that the client requested version is not too high.
   unsigned int proto_rev = msg->id();
-  if (proto_rev > 0x0300) {
-    DEBUG0("server: client requested proto > 0x0300");
+  if (proto_rev > 0x0301) {
+    DEBUG0("server: client requested proto > 0x0301");
     send_msgs(Message::ProtoUnsup());
     return false;
   }
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -22,6 +22,7 @@
 #include <wpi/condition_variable.h>
 #include <wpi/mutex.h>
 
+#include "Capture.h"
 #include "IDispatcher.h"
 #include "INetworkConnection.h"
 
@@ -58,6 +59,11 @@ class DispatcherBase : public IDispatcher {
   void Flush();
   std::vector<ConnectionInfo> GetConnections() const;
   bool IsConnected() const;
+  void SetPublishTimestamps(bool enable);
+  void SetConnectionTimeout(double timeout);
+  bool GetServerTimeOffset(int64_t* offset) const;
+  bool StartCapture(const Twine& filename);
+  void StopCapture();
 
   unsigned int AddListener(
       std::function<void(const ConnectionNotification& event)> callback,
@@ -88,10 +94,11 @@ class DispatcherBase : public IDispatcher {
       std::function<std::shared_ptr<Message>()> get_msg,
       std::function<void(wpi::ArrayRef<std::shared_ptr<Message>>)> send_msgs);
 
-  void ClientReconnect(unsigned int proto_rev = 0x0300);
+  void ClientReconnect(unsigned int proto_rev = 0x0301);
 
   void QueueOutgoing(std::shared_ptr<Message> msg, INetworkConnection* only,
                      INetworkConnection* except) override;
+  unsigned int GetMaxProtoRev() const override;
 
   IStorage& m_storage;
   IConnectionNotifier& m_notifier;
@@ -112,6 +119,10 @@ class DispatcherBase : public IDispatcher {
 
   std::atomic_bool m_active;       // set to false to terminate threads
   std::atomic_uint m_update_rate;  // periodic dispatch update rate, in ms
+  std::atomic_bool m_publish_timestamps{false};
+  // dead peer timeout, in ms; 0 (none) unless SetConnectionTimeout() opts in
+  std::atomic_uint m_timeout{0};
+  CaptureWriter m_capture;
 
   // Condition variable for forced dispatch wakeup (flush)
   wpi::mutex m_flush_mutex;
@@ -121,7 +132,7 @@ class DispatcherBase : public IDispatcher {
 
   // Condition variable for client reconnect (uses user mutex)
   wpi::condition_variable m_reconnect_cv;
-  unsigned int m_reconnect_proto_rev = 0x0300;
+  unsigned int m_reconnect_proto_rev = 0x0301;
   bool m_do_reconnect = true;
 
  protected:
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -9,6 +9,7 @@
 
 #include <wpi/SmallString.h>
 #include <wpi/TCPConnector.h>
+#include <wpi/ThreadHooks.h>
 #include <wpi/raw_ostream.h>
 #include <wpi/raw_socket_istream.h>
 
@@ -54,6 +55,7 @@ void DsClient::Stop() {
 }
 
 void DsClient::Thread::Main() {
+  wpi::SetCurrentThreadName("NTDsClient");
   unsigned int oldip = 0;
   wpi::Logger nolog;  // to silence log messages from TCPConnector
 
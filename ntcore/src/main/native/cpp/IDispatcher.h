@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2017-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2017-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -27,6 +27,9 @@ class IDispatcher {
   virtual void QueueOutgoing(std::shared_ptr<Message> msg,
                              INetworkConnection* only,
                              INetworkConnection* except) = 0;
+  // Highest protocol revision of any connection that messages are queued
+  // to, or 0 if there are none.
+  virtual unsigned int GetMaxProtoRev() const = 0;
 };
 
 }  // namespace nt
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2017-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2017-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -8,6 +8,8 @@
 #ifndef NTCORE_INETWORKCONNECTION_H_
 #define NTCORE_INETWORKCONNECTION_H_
 
+#include <stdint.h>
+
 #include <memory>
 
 #include "Message.h"
@@ -34,6 +36,14 @@ class INetworkConnection {
 
   virtual State state() const = 0;
   virtual void set_state(State state) = 0;
+
+  // Get the server clock minus the local clock, in microseconds.  Returns
+  // false if the clocks have not been synchronized yet.
+  virtual bool GetTimeOffset(int64_t* offset) const = 0;
+  virtual void set_publish_timestamps(bool enable) = 0;
+
+  // Set the dead peer timeout, in milliseconds (0 to disable).
+  virtual void set_timeout(unsigned int timeout) = 0;
 };
 
 }  // namespace nt
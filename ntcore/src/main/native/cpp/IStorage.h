@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -51,6 +51,10 @@ class IStorage {
       INetworkConnection& conn, wpi::ArrayRef<std::shared_ptr<Message>> msgs,
       bool new_server, std::vector<std::shared_ptr<Message>>* out_msgs) = 0;
 
+  // Fails any outstanding history requests.  Called when the connection to
+  // the server is lost.
+  virtual void CancelHistoryRequests() = 0;
+
   // Filename-based save/load functions.  Used both by periodic saves and
   // accessible directly via the user API.
   virtual const char* SavePersistent(const Twine& filename,
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -9,6 +9,8 @@
 
 #include <stdint.h>
 
+#include <wpi/timestamp.h>
+
 #include "Log.h"
 #include "WireDecoder.h"
 #include "WireEncoder.h"
@@ -58,7 +60,7 @@ std::shared_ptr<Message> Message::Read(WireDecoder& decoder,
       }
       break;
     case kEntryAssign: {
-      if (!decoder.ReadString(&msg->m_str)) return nullptr;  // name
+      if (!decoder.ReadEntryName(&msg->m_str)) return nullptr;  // name
       NT_Type type;
       if (!decoder.ReadType(&type)) return nullptr;              // entry type
       if (!decoder.Read16(&msg->m_id)) return nullptr;           // id
@@ -84,6 +86,23 @@ std::shared_ptr<Message> Message::Read(WireDecoder& decoder,
       if (!msg->m_value) return nullptr;
       break;
     }
+    case kEntryUpdateTimestamped: {
+      if (decoder.proto_rev() < 0x0301u) {
+        decoder.set_error(
+            "received timestamped ENTRY_UPDATE in protocol < 3.1");
+        return nullptr;
+      }
+      msg->m_type = kEntryUpdate;
+      if (!decoder.Read16(&msg->m_id)) return nullptr;           // id
+      if (!decoder.Read16(&msg->m_seq_num_uid)) return nullptr;  // seq num
+      NT_Type type;
+      if (!decoder.ReadType(&type)) return nullptr;
+      uint64_t time;
+      if (!decoder.ReadUleb128(&time)) return nullptr;  // server time
+      msg->m_value = decoder.ReadValue(type, decoder.ToLocalTime(time));
+      if (!msg->m_value) return nullptr;
+      break;
+    }
     case kFlagsUpdate: {
       if (decoder.proto_rev() < 0x0300u) {
         decoder.set_error("received FLAGS_UPDATE in protocol < 3.0");
@@ -143,6 +162,48 @@ std::shared_ptr<Message> Message::Read(WireDecoder& decoder,
       msg->m_str = wpi::StringRef(results, size);
       break;
     }
+    case kTimeSyncRequest: {
+      if (decoder.proto_rev() < 0x0301u) {
+        decoder.set_error("received TIME_SYNC_REQUEST in protocol < 3.1");
+        return nullptr;
+      }
+      if (!decoder.ReadUleb128(&msg->m_origin_time)) return nullptr;
+      break;
+    }
+    case kTimeSyncResponse: {
+      if (decoder.proto_rev() < 0x0301u) {
+        decoder.set_error("received TIME_SYNC_RESPONSE in protocol < 3.1");
+        return nullptr;
+      }
+      if (!decoder.ReadUleb128(&msg->m_origin_time)) return nullptr;
+      if (!decoder.ReadUleb128(&msg->m_receive_time)) return nullptr;
+      if (!decoder.ReadUleb128(&msg->m_transmit_time)) return nullptr;
+      break;
+    }
+    case kHistoryRequest: {
+      if (decoder.proto_rev() < 0x0301u) {
+        decoder.set_error("received HISTORY_REQUEST in protocol < 3.1");
+        return nullptr;
+      }
+      if (!decoder.Read16(&msg->m_id)) return nullptr;
+      if (!decoder.Read16(&msg->m_seq_num_uid)) return nullptr;
+      uint64_t start, end;
+      if (!decoder.ReadUleb128(&start)) return nullptr;
+      if (!decoder.ReadUleb128(&end)) return nullptr;
+      msg->m_origin_time = decoder.ToLocalTime(start);
+      msg->m_receive_time = end == 0 ? UINT64_MAX : decoder.ToLocalTime(end);
+      break;
+    }
+    case kHistoryResponse: {
+      if (decoder.proto_rev() < 0x0301u) {
+        decoder.set_error("received HISTORY_RESPONSE in protocol < 3.1");
+        return nullptr;
+      }
+      if (!decoder.Read16(&msg->m_id)) return nullptr;
+      if (!decoder.Read16(&msg->m_seq_num_uid)) return nullptr;
+      if (!decoder.ReadString(&msg->m_str)) return nullptr;
+      break;
+    }
     default:
       decoder.set_error("unrecognized message type");
       WPI_INFO(decoder.logger(), "unrecognized message type: " << msg_type);
@@ -221,6 +282,36 @@ std::shared_ptr<Message> Message::RpcResponse(unsigned int id, unsigned int uid,
   return msg;
 }
 
+std::shared_ptr<Message> Message::TimeSyncResponse(uint64_t origin_time,
+                                                   uint64_t receive_time) {
+  auto msg = std::make_shared<Message>(kTimeSyncResponse, private_init());
+  msg->m_origin_time = origin_time;
+  msg->m_receive_time = receive_time;
+  return msg;
+}
+
+std::shared_ptr<Message> Message::HistoryRequest(unsigned int id,
+                                                 unsigned int uid,
+                                                 uint64_t start_time,
+                                                 uint64_t end_time) {
+  auto msg = std::make_shared<Message>(kHistoryRequest, private_init());
+  msg->m_id = id;
+  msg->m_seq_num_uid = uid;
+  msg->m_origin_time = start_time;
+  msg->m_receive_time = end_time;
+  return msg;
+}
+
+std::shared_ptr<Message> Message::HistoryResponse(unsigned int id,
+                                                  unsigned int uid,
+                                                  wpi::StringRef values) {
+  auto msg = std::make_shared<Message>(kHistoryResponse, private_init());
+  msg->m_id = id;
+  msg->m_seq_num_uid = uid;
+  msg->m_str = values;
+  return msg;
+}
+
 void Message::Write(WireEncoder& encoder) const {
   switch (m_type) {
     case kKeepAlive:
@@ -251,7 +342,7 @@ void Message::Write(WireEncoder& encoder) const {
       break;
     case kEntryAssign:
       encoder.Write8(kEntryAssign);
-      encoder.WriteString(m_str);
+      encoder.WriteEntryName(m_str);
       encoder.WriteType(m_value->type());
       encoder.Write16(m_id);
       encoder.Write16(m_seq_num_uid);
@@ -259,6 +350,15 @@ void Message::Write(WireEncoder& encoder) const {
       encoder.WriteValue(*m_value);
       break;
     case kEntryUpdate:
+      if (encoder.timestamps() && encoder.proto_rev() >= 0x0301u) {
+        encoder.Write8(kEntryUpdateTimestamped);
+        encoder.Write16(m_id);
+        encoder.Write16(m_seq_num_uid);
+        encoder.WriteType(m_value->type());
+        encoder.WriteUleb128(encoder.ToServerTime(m_value->time()));
+        encoder.WriteValue(*m_value);
+        break;
+      }
       encoder.Write8(kEntryUpdate);
       encoder.Write16(m_id);
       encoder.Write16(m_seq_num_uid);
@@ -295,6 +395,36 @@ void Message::Write(WireEncoder& encoder) const {
       encoder.Write16(m_seq_num_uid);
       encoder.WriteString(m_str);
       break;
+    case kTimeSyncRequest:
+      if (encoder.proto_rev() < 0x0301u) return;  // new message in version 3.1
+      encoder.Write8(kTimeSyncRequest);
+      encoder.WriteUleb128(wpi::Now());
+      break;
+    case kTimeSyncResponse:
+      if (encoder.proto_rev() < 0x0301u) return;  // new message in version 3.1
+      encoder.Write8(kTimeSyncResponse);
+      encoder.WriteUleb128(m_origin_time);
+      encoder.WriteUleb128(m_receive_time);
+      encoder.WriteUleb128(wpi::Now());
+      break;
+    case kHistoryRequest:
+      if (encoder.proto_rev() < 0x0301u) return;  // new message in version 3.1
+      encoder.Write8(kHistoryRequest);
+      encoder.Write16(m_id);
+      encoder.Write16(m_seq_num_uid);
+      encoder.WriteUleb128(encoder.ToServerTime(m_origin_time));
+      // an end time of 0 means no end
+      encoder.WriteUleb128(m_receive_time == UINT64_MAX
+                               ? 0
+                               : encoder.ToServerTime(m_receive_time));
+      break;
+    case kHistoryResponse:
+      if (encoder.proto_rev() < 0x0301u) return;  // new message in version 3.1
+      encoder.Write8(kHistoryResponse);
+      encoder.Write16(m_id);
+      encoder.Write16(m_seq_num_uid);
+      encoder.WriteString(m_str);
+      break;
     default:
       break;
   }
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -8,6 +8,8 @@
 #ifndef NTCORE_MESSAGE_H_
 #define NTCORE_MESSAGE_H_
 
+#include <stdint.h>
+
 #include <functional>
 #include <memory>
 #include <string>
@@ -37,7 +39,15 @@ class Message {
     kEntryDelete = 0x13,
     kClearEntries = 0x14,
     kExecuteRpc = 0x20,
-    kRpcResponse = 0x21
+    kRpcResponse = 0x21,
+    // Protocol revision 3.1 (0x0301) adds exactly the messages below, plus
+    // prefix compression of Entry Assignment names.  Any further message
+    // needs a new revision.
+    kEntryUpdateTimestamped = 0x15,  // only on the wire; read as kEntryUpdate
+    kTimeSyncRequest = 0x30,
+    kTimeSyncResponse = 0x31,
+    kHistoryRequest = 0x32,
+    kHistoryResponse = 0x33
   };
   typedef std::function<NT_Type(unsigned int id)> GetEntryTypeFunc;
 
@@ -56,6 +66,20 @@ class Message {
   unsigned int flags() const { return m_flags; }
   unsigned int seq_num_uid() const { return m_seq_num_uid; }
 
+  // Time sync timestamps, in the sender's nt::Now() timebase.  The origin
+  // time is when the client sent the request, the receive time is when the
+  // server received it, and the transmit time is when the server sent the
+  // response.  Transmit times (and request origin times) are stamped when
+  // the message is encoded rather than when it's created.
+  uint64_t origin_time() const { return m_origin_time; }
+  uint64_t receive_time() const { return m_receive_time; }
+  uint64_t transmit_time() const { return m_transmit_time; }
+
+  // History request window (inclusive).  These are local times; they're
+  // converted to and from the server timebase on the wire.
+  uint64_t start_time() const { return m_origin_time; }
+  uint64_t end_time() const { return m_receive_time; }
+
   // Read and write from wire representation
   void Write(WireEncoder& encoder) const;
   static std::shared_ptr<Message> Read(WireDecoder& decoder,
@@ -77,6 +101,9 @@ class Message {
   static std::shared_ptr<Message> ClearEntries() {
     return std::make_shared<Message>(kClearEntries, private_init());
   }
+  static std::shared_ptr<Message> TimeSyncRequest() {
+    return std::make_shared<Message>(kTimeSyncRequest, private_init());
+  }
 
   // Create messages with data
   static std::shared_ptr<Message> ClientHello(wpi::StringRef self_id);
@@ -97,6 +124,15 @@ class Message {
                                              wpi::StringRef params);
   static std::shared_ptr<Message> RpcResponse(unsigned int id, unsigned int uid,
                                               wpi::StringRef result);
+  static std::shared_ptr<Message> TimeSyncResponse(uint64_t origin_time,
+                                                   uint64_t receive_time);
+  static std::shared_ptr<Message> HistoryRequest(unsigned int id,
+                                                 unsigned int uid,
+                                                 uint64_t start_time,
+                                                 uint64_t end_time);
+  static std::shared_ptr<Message> HistoryResponse(unsigned int id,
+                                                  unsigned int uid,
+                                                  wpi::StringRef values);
 
   Message(const Message&) = delete;
   Message& operator=(const Message&) = delete;
@@ -110,6 +146,9 @@ class Message {
   unsigned int m_id;  // also used for proto_rev
   unsigned int m_flags;
   unsigned int m_seq_num_uid;
+  uint64_t m_origin_time = 0;
+  uint64_t m_receive_time = 0;
+  uint64_t m_transmit_time = 0;
 };
 
 }  // namespace nt
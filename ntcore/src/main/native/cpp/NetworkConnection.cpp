@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -8,9 +8,11 @@
 #include "NetworkConnection.h"
 
 #include <wpi/NetworkStream.h>
+#include <wpi/ThreadHooks.h>
 #include <wpi/raw_socket_istream.h>
 #include <wpi/timestamp.h>
 
+#include "Capture.h"
 #include "IConnectionNotifier.h"
 #include "Log.h"
 #include "WireDecoder.h"
@@ -32,7 +34,7 @@ NetworkConnection::NetworkConnection(unsigned int uid,
       m_get_entry_type(get_entry_type),
       m_state(kCreated) {
   m_active = false;
-  m_proto_rev = 0x0300;
+  m_proto_rev = 0x0301;
   m_last_update = 0;
 
   // turn off Nagle algorithm; we bundle packets for transmission
@@ -92,9 +94,13 @@ void NetworkConnection::Stop() {
 }
 
 ConnectionInfo NetworkConnection::info() const {
-  return ConnectionInfo{remote_id(), m_stream->getPeerIP(),
+  return ConnectionInfo{remote_id(),
+                        m_stream->getPeerIP(),
                         static_cast<unsigned int>(m_stream->getPeerPort()),
-                        m_last_update, m_proto_rev};
+                        m_last_update,
+                        m_proto_rev,
+                        m_rtt,
+                        m_rtt_jitter};
 }
 
 unsigned int NetworkConnection::proto_rev() const { return m_proto_rev; }
@@ -103,6 +109,18 @@ void NetworkConnection::set_proto_rev(unsigned int proto_rev) {
   m_proto_rev = proto_rev;
 }
 
+void NetworkConnection::SetTimeReference() {
+  m_time_reference = true;
+  m_time_offset = 0;
+  m_time_synced = true;
+}
+
+bool NetworkConnection::GetTimeOffset(int64_t* offset) const {
+  if (!m_time_synced) return false;
+  *offset = m_time_offset;
+  return true;
+}
+
 NetworkConnection::State NetworkConnection::state() const {
   std::scoped_lock lock(m_state_mutex);
   return m_state;
@@ -131,6 +149,7 @@ void NetworkConnection::set_remote_id(StringRef remote_id) {
 }
 
 void NetworkConnection::ReadThreadMain() {
+  wpi::SetCurrentThreadName("NTConnRead");
   wpi::raw_socket_istream is(*m_stream);
   WireDecoder decoder(is, m_proto_rev, m_logger);
 
@@ -142,6 +161,8 @@ void NetworkConnection::ReadThreadMain() {
                      if (!msg && decoder.error())
                        DEBUG0(
                            "error reading in handshake: " << decoder.error());
+                     if (msg && m_capture)
+                       m_capture->Record(m_uid, false, *msg);
                      return msg;
                    },
                    [&](wpi::ArrayRef<std::shared_ptr<Message>> msgs) {
@@ -152,10 +173,12 @@ void NetworkConnection::ReadThreadMain() {
     goto done;
   }
 
+  m_last_update = Now();
   set_state(kActive);
   while (m_active) {
     if (!m_stream) break;
     decoder.set_proto_rev(m_proto_rev);
+    decoder.set_time_offset(m_time_offset);
     decoder.Reset();
     auto msg = Message::Read(decoder, m_get_entry_type);
     if (!msg) {
@@ -167,7 +190,30 @@ void NetworkConnection::ReadThreadMain() {
     DEBUG3("received type=" << msg->type() << " with str=" << msg->str()
                             << " id=" << msg->id()
                             << " seq_num=" << msg->seq_num_uid());
-    m_last_update = Now();
+    if (m_capture) m_capture->Record(m_uid, false, *msg);
+    uint64_t now = Now();
+    m_last_update = now;
+    // time sync is handled entirely within the connection
+    if (msg->Is(Message::kTimeSyncRequest)) {
+      // respond right away rather than waiting for the next dispatch, so the
+      // peer sees our liveness regardless of our update rate
+      m_outgoing.emplace(
+          Outgoing{Message::TimeSyncResponse(msg->origin_time(), now)});
+      continue;
+    }
+    if (msg->Is(Message::kTimeSyncResponse)) {
+      if (m_time_sync.AddSample(msg->origin_time(), msg->receive_time(),
+                                msg->transmit_time(), now)) {
+        m_rtt = static_cast<unsigned int>(m_time_sync.rtt());
+        m_rtt_jitter = static_cast<unsigned int>(m_time_sync.jitter());
+        // the server's clock is the reference; a server only measures RTT
+        if (!m_time_reference) {
+          m_time_offset = m_time_sync.offset();
+          m_time_synced = true;
+        }
+      }
+      continue;
+    }
     m_process_incoming(std::move(msg), this);
   }
   DEBUG2("read thread died (" << this << ")");
@@ -185,6 +231,7 @@ done:
 }
 
 void NetworkConnection::WriteThreadMain() {
+  wpi::SetCurrentThreadName("NTConnWrite");
   WireEncoder encoder(m_proto_rev);
 
   while (m_active) {
@@ -192,6 +239,8 @@ void NetworkConnection::WriteThreadMain() {
     DEBUG4("write thread woke up");
     if (msgs.empty()) continue;
     encoder.set_proto_rev(m_proto_rev);
+    encoder.set_timestamps(m_publish_timestamps && m_time_synced);
+    encoder.set_time_offset(m_time_offset);
     encoder.Reset();
     DEBUG3("sending " << msgs.size() << " messages");
     for (auto& msg : msgs) {
@@ -200,6 +249,7 @@ void NetworkConnection::WriteThreadMain() {
                                << " id=" << msg->id()
                                << " seq_num=" << msg->seq_num_uid());
         msg->Write(encoder);
+        if (m_capture) m_capture->Record(m_uid, true, *msg);
       }
     }
     wpi::NetworkStream::Error err;
@@ -320,6 +370,27 @@ void NetworkConnection::QueueOutgoing(std::shared_ptr<Message> msg) {
 void NetworkConnection::PostOutgoing(bool keep_alive) {
   std::scoped_lock lock(m_pending_mutex);
   auto now = std::chrono::steady_clock::now();
+  if (m_proto_rev >= 0x0301 && state() == kActive) {
+    // A time sync exchange doubles as a heartbeat in both directions: the
+    // peer responds immediately, so a peer that has been silent for longer
+    // than the timeout is gone even if TCP hasn't noticed yet.
+    unsigned int timeout = m_timeout;
+    if (timeout != 0 && Now() - m_last_update > timeout * 1000ull) {
+      INFO("connection timed out after " << timeout << " ms");
+      if (m_stream) m_stream->close();  // read thread will mark us dead
+      return;
+    }
+    // A burst of requests right after connecting gets the filter a good
+    // estimate quickly.
+    if (now >= m_next_time_sync) {
+      m_pending_outgoing.push_back(Message::TimeSyncRequest());
+      if (++m_time_sync_requests >= TimeSyncFilter::kSamples) {
+        m_next_time_sync = now + (timeout != 0
+                                      ? std::chrono::milliseconds(timeout / 5)
+                                      : std::chrono::milliseconds(1000));
+      }
+    }
+  }
   if (m_pending_outgoing.empty()) {
     if (!keep_alive) return;
     // send keep-alives once a second (if no other messages have been sent)
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -24,6 +24,7 @@
 
 #include "INetworkConnection.h"
 #include "Message.h"
+#include "TimeSyncFilter.h"
 #include "ntcore_cpp.h"
 
 namespace wpi {
@@ -33,6 +34,7 @@ class NetworkStream;
 
 namespace nt {
 
+class CaptureWriter;
 class IConnectionNotifier;
 
 class NetworkConnection : public INetworkConnection {
@@ -60,6 +62,9 @@ class NetworkConnection : public INetworkConnection {
     m_process_incoming = func;
   }
 
+  // Set where to record traffic.  This must be called before Start().
+  void set_capture(CaptureWriter* capture) { m_capture = capture; }
+
   void Start();
   void Stop();
 
@@ -84,6 +89,15 @@ class NetworkConnection : public INetworkConnection {
 
   uint64_t last_update() const { return m_last_update; }
 
+  // Make this connection's clock the reference (used on the server side).
+  void SetTimeReference();
+
+  bool GetTimeOffset(int64_t* offset) const override;
+  void set_publish_timestamps(bool enable) override {
+    m_publish_timestamps = enable;
+  }
+  void set_timeout(unsigned int timeout) override { m_timeout = timeout; }
+
   NetworkConnection(const NetworkConnection&) = delete;
   NetworkConnection& operator=(const NetworkConnection&) = delete;
 
@@ -99,6 +113,7 @@ class NetworkConnection : public INetworkConnection {
   HandshakeFunc m_handshake;
   Message::GetEntryTypeFunc m_get_entry_type;
   ProcessIncomingFunc m_process_incoming;
+  CaptureWriter* m_capture = nullptr;
   std::thread m_read_thread;
   std::thread m_write_thread;
   std::atomic_bool m_active;
@@ -110,6 +125,19 @@ class NetworkConnection : public INetworkConnection {
   std::atomic_ullong m_last_update;
   std::chrono::steady_clock::time_point m_last_post;
 
+  // Clock synchronization and heartbeats.  The filter is only touched by the
+  // read thread.
+  TimeSyncFilter m_time_sync;
+  std::atomic<int64_t> m_time_offset{0};
+  std::atomic_bool m_time_synced{false};
+  bool m_time_reference = false;
+  std::atomic_bool m_publish_timestamps{false};
+  std::atomic_uint m_rtt{0};
+  std::atomic_uint m_rtt_jitter{0};
+  std::atomic_uint m_timeout{0};  // dead peer timeout, in ms
+  std::chrono::steady_clock::time_point m_next_time_sync;
+  size_t m_time_sync_requests = 0;
+
   wpi::mutex m_pending_mutex;
   Outgoing m_pending_outgoing;
   std::vector<std::pair<size_t, size_t>> m_pending_update;
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -8,18 +8,20 @@
 #ifndef NTCORE_SEQUENCENUMBER_H_
 #define NTCORE_SEQUENCENUMBER_H_
 
+#include <stdint.h>
+
 namespace nt {
 
 /* A sequence number per RFC 1982 */
 class SequenceNumber {
  public:
   SequenceNumber() : m_value(0) {}
-  explicit SequenceNumber(unsigned int value) : m_value(value) {}
+  explicit SequenceNumber(unsigned int value)
+      : m_value(static_cast<uint16_t>(value)) {}
   unsigned int value() const { return m_value; }
 
   SequenceNumber& operator++() {
-    ++m_value;
-    if (m_value > 0xffff) m_value = 0;
+    ++m_value;  // wraps from 0xffff to 0
     return *this;
   }
   SequenceNumber operator++(int) {
@@ -36,7 +38,7 @@ class SequenceNumber {
   friend bool operator!=(const SequenceNumber& lhs, const SequenceNumber& rhs);
 
  private:
-  unsigned int m_value;
+  uint16_t m_value;
 };
 
 bool operator<(const SequenceNumber& lhs, const SequenceNumber& rhs);
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -7,6 +7,12 @@
 
 #include "Storage.h"
 
+#include <algorithm>
+#include <cstring>
+
+#include <wpi/SmallString.h>
+#include <wpi/StringExtras.h>
+#include <wpi/raw_istream.h>
 #include <wpi/timestamp.h>
 
 #include "Handle.h"
@@ -15,6 +21,8 @@
 #include "INetworkConnection.h"
 #include "IRpcServer.h"
 #include "Log.h"
+#include "WireDecoder.h"
+#include "WireEncoder.h"
 
 using namespace nt;
 
@@ -37,10 +45,126 @@ void Storage::SetDispatcher(IDispatcher* dispatcher, bool server) {
 
 void Storage::ClearDispatcher() { m_dispatcher = nullptr; }
 
+template <typename F>
+Storage::Entry* Storage::LockEntry(unsigned int hint, F lookup,
+                                   std::unique_lock<wpi::mutex>& lock) const {
+  lock = std::unique_lock{m_mutex.GetStripe(hint)};
+  for (;;) {
+    Entry* entry = lookup();
+    if (!entry) return nullptr;
+    wpi::mutex& stripe = m_mutex.GetStripe(entry->local_id);
+    if (lock.mutex() == &stripe) return entry;
+    // Switch to the entry's stripe.  The maps may change while no stripe is
+    // held, so look it up again.
+    lock.unlock();
+    lock = std::unique_lock{stripe};
+  }
+}
+
+Storage::Entry* Storage::LockLocalEntry(
+    unsigned int local_id, std::unique_lock<wpi::mutex>& lock) const {
+  return LockEntry(
+      local_id,
+      [&]() -> Entry* {
+        if (local_id >= m_localmap.size()) return nullptr;
+        return m_localmap[local_id];
+      },
+      lock);
+}
+
+Storage::Entry* Storage::LockIdEntry(unsigned int id,
+                                     std::unique_lock<wpi::mutex>& lock) const {
+  return LockEntry(
+      id,
+      [&]() -> Entry* {
+        if (id >= m_idmap.size()) return nullptr;
+        return m_idmap[id];
+      },
+      lock);
+}
+
+Storage::Entry* Storage::LockNamedEntry(
+    StringRef name, std::unique_lock<wpi::mutex>& lock) const {
+  return LockEntry(
+      wpi::HashString(name), [&] { return FindEntry(name); }, lock);
+}
+
+// An entry's key is the index of its directory followed by its leaf.
+static StringRef MakeKey(unsigned int dir, StringRef leaf,
+                         wpi::SmallVectorImpl<char>& buf) {
+  buf.resize(sizeof(dir));
+  std::memcpy(buf.data(), &dir, sizeof(dir));
+  buf.append(leaf.begin(), leaf.end());
+  return StringRef(buf.data(), buf.size());
+}
+
+static unsigned int GetKeyDir(StringRef key) {
+  unsigned int dir;
+  std::memcpy(&dir, key.data(), sizeof(dir));
+  return dir;
+}
+
+static StringRef GetKeyLeaf(StringRef key) { return key.substr(sizeof(int)); }
+
+// Splits a name after its last '/' (the directory is empty if there isn't
+// one).
+static std::pair<StringRef, StringRef> SplitName(StringRef name) {
+  size_t split = name.rfind('/') + 1;  // npos + 1 == 0
+  return {name.substr(0, split), name.substr(split)};
+}
+
+Storage::Entry* Storage::FindEntry(StringRef name) const {
+  auto [dirName, leaf] = SplitName(name);
+  auto dir = m_dirs.find(dirName);
+  if (dir == m_dirs.end()) return nullptr;
+  wpi::SmallString<64> keyBuf;
+  auto i = m_entries.find(MakeKey(dir->getValue(), leaf, keyBuf));
+  if (i == m_entries.end()) return nullptr;
+  return const_cast<Entry*>(&i->getValue());
+}
+
+StringRef Storage::GetName(const Entry* entry,
+                           wpi::SmallVectorImpl<char>& buf) const {
+  StringRef dirName = m_dir_names[GetKeyDir(entry->key)];
+  StringRef leaf = GetKeyLeaf(entry->key);
+  if (dirName.empty()) return leaf;
+  buf.assign(dirName.begin(), dirName.end());
+  buf.append(leaf.begin(), leaf.end());
+  return StringRef(buf.data(), buf.size());
+}
+
+bool Storage::NameStartsWith(const Entry* entry, StringRef prefix) const {
+  StringRef dirName = m_dir_names[GetKeyDir(entry->key)];
+  if (prefix.size() <= dirName.size()) return dirName.startswith(prefix);
+  return prefix.startswith(dirName) &&
+         GetKeyLeaf(entry->key).startswith(prefix.substr(dirName.size()));
+}
+
+ValueHistory* Storage::GetHistory(const Entry* entry) const {
+  if (m_histories.empty()) return nullptr;
+  auto i = m_histories.find(entry->local_id);
+  if (i == m_histories.end()) return nullptr;
+  return i->second.get();
+}
+
+void Storage::SetValue(Entry* entry, std::shared_ptr<Value> value) {
+  if (auto history = GetHistory(entry)) history->Add(value);
+  entry->value = std::move(value);
+}
+
+template <typename F>
+auto Storage::WithEntryLocked(Entry* entry,
+                              std::unique_lock<wpi::mutex>& entryLock,
+                              F func) {
+  if (entry && !NeedsIdAssignment(entry)) return func(entryLock);
+  entryLock.unlock();
+  std::unique_lock lock(m_mutex);
+  return func(lock);
+}
+
 NT_Type Storage::GetMessageEntryType(unsigned int id) const {
-  std::scoped_lock lock(m_mutex);
-  if (id >= m_idmap.size()) return NT_UNASSIGNED;
-  Entry* entry = m_idmap[id];
+  std::unique_lock<wpi::mutex> lock;
+  Entry* entry = LockIdEntry(id, lock);
   if (!entry || !entry->value) return NT_UNASSIGNED;
   return entry->value->type();
 }
@@ -50,6 +174,8 @@ void Storage::ProcessIncoming(std::shared_ptr<Message> msg,
                               std::weak_ptr<INetworkConnection> conn_weak) {
   switch (msg->type()) {
     case Message::kKeepAlive:
+    case Message::kTimeSyncRequest:
+    case Message::kTimeSyncResponse:
       break;  // ignore
     case Message::kClientHello:
     case Message::kProtoUnsup:
@@ -79,6 +205,12 @@ void Storage::ProcessIncoming(std::shared_ptr<Message> msg,
     case Message::kRpcResponse:
       ProcessIncomingRpcResponse(std::move(msg), conn);
       break;
+    case Message::kHistoryRequest:
+      ProcessIncomingHistoryRequest(std::move(msg), conn);
+      break;
+    case Message::kHistoryResponse:
+      ProcessIncomingHistoryResponse(std::move(msg), conn);
+      break;
     default:
       break;
   }
@@ -131,7 +263,7 @@ void Storage::ProcessIncomingEntryAssign(std::shared_ptr<Message> msg,
       if (!entry->value) {
         // didn't exist at all (rather than just being a response to a
         // id assignment request)
-        entry->value = msg->value();
+        SetValue(entry, msg->value());
         entry->flags = msg->flags();
         entry->seq_num = seq_num;
 
@@ -169,7 +301,8 @@ void Storage::ProcessIncomingEntryAssign(std::shared_ptr<Message> msg,
   }
 
   // sanity check: name should match id
-  if (msg->str() != entry->name) {
+  wpi::SmallString<128> nameBuf;
+  if (name != GetName(entry, nameBuf)) {
     lock.unlock();
     DEBUG0("entry assignment for same id with different name?");
     return;
@@ -192,7 +325,7 @@ void Storage::ProcessIncomingEntryAssign(std::shared_ptr<Message> msg,
     m_persistent_dirty = true;
 
   // update local
-  entry->value = msg->value();
+  SetValue(entry, msg->value());
   entry->seq_num = seq_num;
 
   // notify
@@ -202,7 +335,7 @@ void Storage::ProcessIncomingEntryAssign(std::shared_ptr<Message> msg,
   // be any other connections, so don't bother)
   if (m_server && m_dispatcher) {
     auto dispatcher = m_dispatcher;
-    auto outmsg = Message::EntryAssign(entry->name, id, msg->seq_num_uid(),
+    auto outmsg = Message::EntryAssign(name, id, msg->seq_num_uid(),
                                        msg->value(), entry->flags);
     lock.unlock();
     dispatcher->QueueOutgoing(outmsg, nullptr, conn);
@@ -211,31 +344,32 @@ void Storage::ProcessIncomingEntryAssign(std::shared_ptr<Message> msg,
 
 void Storage::ProcessIncomingEntryUpdate(std::shared_ptr<Message> msg,
                                          INetworkConnection* conn) {
-  std::unique_lock lock(m_mutex);
+  std::unique_lock<wpi::mutex> lock;
   unsigned int id = msg->id();
-  if (id >= m_idmap.size() || !m_idmap[id]) {
+  Entry* entry = LockIdEntry(id, lock);
+  if (!entry) {
     // ignore arbitrary entry updates;
     // this can happen due to deleted entries
     lock.unlock();
     DEBUG0("received update to unknown entry");
     return;
   }
-  Entry* entry = m_idmap[id];
 
   // ignore if sequence number not higher than local
   SequenceNumber seq_num(msg->seq_num_uid());
   if (seq_num <= entry->seq_num) return;
 
   // update local
-  entry->value = msg->value();
+  SetValue(entry, msg->value());
   entry->seq_num = seq_num;
 
   // update persistent dirty flag if it's a persistent value
   if (entry->IsPersistent()) m_persistent_dirty = true;
 
   // notify
-  m_notifier.NotifyEntry(entry->local_id, entry->name, entry->value,
-                         NT_NOTIFY_UPDATE);
+  wpi::SmallString<128> nameBuf;
+  m_notifier.NotifyEntry(entry->local_id, GetName(entry, nameBuf),
+                         entry->value, NT_NOTIFY_UPDATE);
 
   // broadcast to all other connections (note for client there won't
   // be any other connections, so don't bother)
@@ -248,9 +382,10 @@ void Storage::ProcessIncomingEntryUpdate(std::shared_ptr<Message> msg,
 
 void Storage::ProcessIncomingFlagsUpdate(std::shared_ptr<Message> msg,
                                          INetworkConnection* conn) {
-  std::unique_lock lock(m_mutex);
+  std::unique_lock<wpi::mutex> lock;
   unsigned int id = msg->id();
-  if (id >= m_idmap.size() || !m_idmap[id]) {
+  Entry* entry = LockIdEntry(id, lock);
+  if (!entry) {
     // ignore arbitrary entry updates;
     // this can happen due to deleted entries
     lock.unlock();
@@ -259,7 +394,7 @@ void Storage::ProcessIncomingFlagsUpdate(std::shared_ptr<Message> msg,
   }
 
   // update local
-  SetEntryFlagsImpl(m_idmap[id], msg->flags(), lock, false);
+  SetEntryFlagsImpl(entry, msg->flags(), lock, false);
 
   // broadcast to all other connections (note for client there won't
   // be any other connections, so don't bother)
@@ -340,35 +475,108 @@ void Storage::ProcessIncomingExecuteRpc(
     conn_info.protocol_version = 0;
   }
   unsigned int call_uid = msg->seq_num_uid();
+  auto rpc = m_rpcs.find(entry->local_id);
+  wpi::SmallString<128> nameBuf;
   m_rpc_server.ProcessRpc(
-      entry->local_id, call_uid, entry->name, msg->str(), conn_info,
+      entry->local_id, call_uid, GetName(entry, nameBuf), msg->str(),
+      conn_info,
       [=](StringRef result) {
         auto c = conn_weak.lock();
         if (c) c->QueueOutgoing(Message::RpcResponse(id, call_uid, result));
       },
-      entry->rpc_uid);
+      rpc == m_rpcs.end() ? UINT_MAX : rpc->second.rpc_uid);
 }
 
 void Storage::ProcessIncomingRpcResponse(std::shared_ptr<Message> msg,
                                          INetworkConnection* /*conn*/) {
-  std::unique_lock lock(m_mutex);
-  if (m_server) return;  // only process on client
+  std::unique_lock<wpi::mutex> lock;
   unsigned int id = msg->id();
-  if (id >= m_idmap.size() || !m_idmap[id]) {
+  Entry* entry = LockIdEntry(id, lock);
+  if (m_server) return;  // only process on client
+  if (!entry) {
     // ignore response to non-existent RPC
     // this can happen due to deleted entries
     lock.unlock();
     DEBUG0("received rpc response to unknown entry");
     return;
   }
-  Entry* entry = m_idmap[id];
   if (!entry->value || !entry->value->IsRpc()) {
     lock.unlock();
     DEBUG0("received RPC response to non-RPC entry");
     return;
   }
-  m_rpc_results.insert(std::make_pair(
-      RpcIdPair{entry->local_id, msg->seq_num_uid()}, msg->str()));
+  unsigned int local_id = entry->local_id;
+  lock.unlock();
+
+  std::scoped_lock rpcLock(m_rpc_mutex);
+  m_rpc_results.insert(
+      std::make_pair(RpcIdPair{local_id, msg->seq_num_uid()}, msg->str()));
+  m_rpc_results_cond.notify_all();
+}
+
+void Storage::ProcessIncomingHistoryRequest(std::shared_ptr<Message> msg,
+                                            INetworkConnection* conn) {
+  std::vector<std::shared_ptr<Value>> values;
+  {
+    std::unique_lock<wpi::mutex> lock;
+    Entry* entry = LockIdEntry(msg->id(), lock);
+    if (!m_server) return;  // only process on server
+    ValueHistory* history = entry ? GetHistory(entry) : nullptr;
+    if (!history) {
+      // unknown entry, or no history kept for it
+      lock.unlock();
+      conn->QueueOutgoing(
+          Message::HistoryResponse(0xffff, msg->seq_num_uid(), StringRef{}));
+      return;
+    }
+    history->Get(msg->start_time(), msg->end_time(), &values);
+  }
+
+  // Values are sent as type, time and value; the times are already in the
+  // server timebase.
+  WireEncoder enc(0x0300);
+  for (auto& value : values) {
+    enc.WriteType(value->type());
+    enc.WriteUleb128(value->time());
+    enc.WriteValue(*value);
+  }
+  conn->QueueOutgoing(Message::HistoryResponse(
+      msg->id(), msg->seq_num_uid(), StringRef(enc.data(), enc.size())));
+}
+
+void Storage::ProcessIncomingHistoryResponse(std::shared_ptr<Message> msg,
+                                             INetworkConnection* conn) {
+  int64_t offset = 0;
+  conn->GetTimeOffset(&offset);
+
+  std::vector<std::shared_ptr<Value>> values;
+  StringRef str = msg->str();
+  wpi::raw_mem_istream is(str.data(), str.size());
+  WireDecoder dec(is, 0x0300, m_logger);
+  dec.set_time_offset(offset);
+  while (is.in_avail() > 0) {
+    NT_Type type;
+    uint64_t time;
+    if (!dec.ReadType(&type) || !dec.ReadUleb128(&time)) break;
+    auto value = dec.ReadValue(type, dec.ToLocalTime(time));
+    if (!value) break;
+    values.emplace_back(std::move(value));
+  }
+
+  std::scoped_lock lock(m_rpc_mutex);
+  auto i = m_history_results.find(msg->seq_num_uid());
+  if (i == m_history_results.end()) return;  // no longer waiting for it
+  i->getSecond().done = true;
+  // an id of 0xffff means the server has no history for the entry
+  i->getSecond().ok = msg->id() != 0xffff;
+  i->getSecond().values.swap(values);
+  m_rpc_results_cond.notify_all();
+}
+
+void Storage::CancelHistoryRequests() {
+  std::scoped_lock lock(m_rpc_mutex);
+  if (m_history_results.empty()) return;
+  for (auto& result : m_history_results) result.getSecond().done = true;
   m_rpc_results_cond.notify_all();
 }
 
@@ -376,13 +584,22 @@ void Storage::GetInitialAssignments(
     INetworkConnection& conn, std::vector<std::shared_ptr<Message>>* msgs) {
   std::scoped_lock lock(m_mutex);
   conn.set_state(INetworkConnection::kSynchronized);
+  size_t start = msgs->size();
+  wpi::SmallString<128> nameBuf;
   for (auto& i : m_entries) {
-    Entry* entry = i.getValue();
+    Entry* entry = &i.getValue();
     if (!entry->value) continue;
-    msgs->emplace_back(Message::EntryAssign(i.getKey(), entry->id,
+    msgs->emplace_back(Message::EntryAssign(GetName(entry, nameBuf), entry->id,
                                             entry->seq_num.value(),
                                             entry->value, entry->flags));
   }
+
+  // 3.1 sends each name relative to the previous one, so sort to group
+  // names that share prefixes
+  if (conn.proto_rev() >= 0x0301) {
+    std::sort(msgs->begin() + start, msgs->end(),
+              [](const auto& a, const auto& b) { return a->str() < b->str(); });
+  }
 }
 
 void Storage::ApplyInitialAssignments(
@@ -396,7 +613,7 @@ void Storage::ApplyInitialAssignments(
   std::vector<std::shared_ptr<Message>> update_msgs;
 
   // clear existing id's
-  for (auto& i : m_entries) i.getValue()->id = 0xffff;
+  for (auto& i : m_entries) i.getValue().id = 0xffff;
 
   // clear existing idmap
   m_idmap.resize(0);
@@ -422,7 +639,7 @@ void Storage::ApplyInitialAssignments(
     entry->id = id;
     if (!entry->value) {
       // doesn't currently exist
-      entry->value = msg->value();
+      SetValue(entry, msg->value());
       entry->flags = msg->flags();
       // notify
       m_notifier.NotifyEntry(entry->local_id, name, entry->value,
@@ -436,7 +653,7 @@ void Storage::ApplyInitialAssignments(
         update_msgs.emplace_back(Message::EntryUpdate(
             entry->id, entry->seq_num.value(), entry->value));
       } else {
-        entry->value = msg->value();
+        SetValue(entry, msg->value());
         unsigned int notify_flags = NT_NOTIFY_UPDATE;
         // don't update flags from a <3.0 remote (not part of message)
         if (conn.proto_rev() >= 0x0300) {
@@ -461,9 +678,10 @@ void Storage::ApplyInitialAssignments(
     // if we have written the value locally, we send an assign message to the
     // server instead of deleting
     if (entry->local_write) {
-      out_msgs->emplace_back(Message::EntryAssign(entry->name, entry->id,
-                                                  entry->seq_num.value(),
-                                                  entry->value, entry->flags));
+      wpi::SmallString<128> nameBuf;
+      out_msgs->emplace_back(Message::EntryAssign(
+          GetName(entry, nameBuf), entry->id, entry->seq_num.value(),
+          entry->value, entry->flags));
       return false;
     }
     // otherwise delete
@@ -477,81 +695,93 @@ void Storage::ApplyInitialAssignments(
 
 std::shared_ptr<Value> Storage::GetEntryValue(StringRef name) const {
   std::scoped_lock lock(m_mutex);
-  auto i = m_entries.find(name);
-  if (i == m_entries.end()) return nullptr;
-  return i->getValue()->value;
+  Entry* entry = FindEntry(name);
+  if (!entry) return nullptr;
+  return entry->value;
 }
 
 std::shared_ptr<Value> Storage::GetEntryValue(unsigned int local_id) const {
-  std::scoped_lock lock(m_mutex);
-  if (local_id >= m_localmap.size()) return nullptr;
-  return m_localmap[local_id]->value;
+  std::unique_lock<wpi::mutex> lock;
+  Entry* entry = LockLocalEntry(local_id, lock);
+  if (!entry) return nullptr;
+  return entry->value;
 }
 
 bool Storage::SetDefaultEntryValue(StringRef name,
                                    std::shared_ptr<Value> value) {
   if (name.empty()) return false;
   if (!value) return false;
-  std::unique_lock lock(m_mutex);
-  Entry* entry = GetOrNew(name);
+  std::unique_lock<wpi::mutex> entryLock;
+  Entry* entry = LockNamedEntry(name, entryLock);
+  return WithEntryLocked(entry, entryLock, [&](auto& lock) {
+    // only reached without an entry when m_mutex is held
+    if (!entry) entry = GetOrNew(name);
 
-  // we return early if value already exists; if types match return true
-  if (entry->value) return entry->value->type() == value->type();
+    // we return early if value already exists; if types match return true
+    if (entry->value) return entry->value->type() == value->type();
 
-  SetEntryValueImpl(entry, value, lock, true);
-  return true;
+    SetEntryValueImpl(entry, value, lock, true);
+    return true;
+  });
 }
 
 bool Storage::SetDefaultEntryValue(unsigned int local_id,
                                    std::shared_ptr<Value> value) {
   if (!value) return false;
-  std::unique_lock lock(m_mutex);
-  if (local_id >= m_localmap.size()) return false;
-  Entry* entry = m_localmap[local_id].get();
-
-  // we return early if value already exists; if types match return true
-  if (entry->value) return entry->value->type() == value->type();
-
-  SetEntryValueImpl(entry, value, lock, true);
-  return true;
+  std::unique_lock<wpi::mutex> entryLock;
+  Entry* entry = LockLocalEntry(local_id, entryLock);
+  if (!entry) return false;
+  return WithEntryLocked(entry, entryLock, [&](auto& lock) {
+    // we return early if value already exists; if types match return true
+    if (entry->value) return entry->value->type() == value->type();
+
+    SetEntryValueImpl(entry, value, lock, true);
+    return true;
+  });
 }
 
 bool Storage::SetEntryValue(StringRef name, std::shared_ptr<Value> value) {
   if (name.empty()) return true;
   if (!value) return true;
-  std::unique_lock lock(m_mutex);
-  Entry* entry = GetOrNew(name);
+  std::unique_lock<wpi::mutex> entryLock;
+  Entry* entry = LockNamedEntry(name, entryLock);
+  return WithEntryLocked(entry, entryLock, [&](auto& lock) {
+    // only reached without an entry when m_mutex is held
+    if (!entry) entry = GetOrNew(name);
 
-  if (entry->value && entry->value->type() != value->type())
-    return false;  // error on type mismatch
+    if (entry->value && entry->value->type() != value->type())
+      return false;  // error on type mismatch
 
-  SetEntryValueImpl(entry, value, lock, true);
-  return true;
+    SetEntryValueImpl(entry, value, lock, true);
+    return true;
+  });
 }
 
 bool Storage::SetEntryValue(unsigned int local_id,
                             std::shared_ptr<Value> value) {
   if (!value) return true;
-  std::unique_lock lock(m_mutex);
-  if (local_id >= m_localmap.size()) return true;
-  Entry* entry = m_localmap[local_id].get();
-
-  if (entry->value && entry->value->type() != value->type())
-    return false;  // error on type mismatch
-
-  SetEntryValueImpl(entry, value, lock, true);
-  return true;
+  std::unique_lock<wpi::mutex> entryLock;
+  Entry* entry = LockLocalEntry(local_id, entryLock);
+  if (!entry) return true;
+  return WithEntryLocked(entry, entryLock, [&](auto& lock) {
+    if (entry->value && entry->value->type() != value->type())
+      return false;  // error on type mismatch
+
+    SetEntryValueImpl(entry, value, lock, true);
+    return true;
+  });
 }
 
+template <typename Lock>
 void Storage::SetEntryValueImpl(Entry* entry, std::shared_ptr<Value> value,
-                                std::unique_lock<wpi::mutex>& lock,
-                                bool local) {
+                                Lock& lock, bool local) {
   if (!value) return;
   auto old_value = entry->value;
-  entry->value = value;
+  SetValue(entry, value);
 
-  // if we're the server, assign an id if it doesn't have one
-  if (m_server && entry->id == 0xffff) {
+  // if we're the server, assign an id if it doesn't have one (callers only
+  // hold the entry's stripe when this isn't needed)
+  if (NeedsIdAssignment(entry)) {
     unsigned int id = m_idmap.size();
     entry->id = id;
     m_idmap.push_back(entry);
@@ -562,11 +792,12 @@ void Storage::SetEntryValueImpl(Entry* entry, std::shared_ptr<Value> value,
     m_persistent_dirty = true;
 
   // notify
+  wpi::SmallString<128> nameBuf;
   if (!old_value)
-    m_notifier.NotifyEntry(entry->local_id, entry->name, value,
+    m_notifier.NotifyEntry(entry->local_id, GetName(entry, nameBuf), value,
                            NT_NOTIFY_NEW | (local ? NT_NOTIFY_LOCAL : 0));
   else if (*old_value != *value)
-    m_notifier.NotifyEntry(entry->local_id, entry->name, value,
+    m_notifier.NotifyEntry(entry->local_id, GetName(entry, nameBuf), value,
                            NT_NOTIFY_UPDATE | (local ? NT_NOTIFY_LOCAL : 0));
 
   // remember local changes
@@ -577,8 +808,9 @@ void Storage::SetEntryValueImpl(Entry* entry, std::shared_ptr<Value> value,
   auto dispatcher = m_dispatcher;
   if (!old_value || old_value->type() != value->type()) {
     if (local) ++entry->seq_num;
-    auto msg = Message::EntryAssign(
-        entry->name, entry->id, entry->seq_num.value(), value, entry->flags);
+    auto msg =
+        Message::EntryAssign(GetName(entry, nameBuf), entry->id,
+                             entry->seq_num.value(), value, entry->flags);
     lock.unlock();
     dispatcher->QueueOutgoing(msg, nullptr, nullptr);
   } else if (*old_value != *value) {
@@ -595,35 +827,41 @@ void Storage::SetEntryValueImpl(Entry* entry, std::shared_ptr<Value> value,
 void Storage::SetEntryTypeValue(StringRef name, std::shared_ptr<Value> value) {
   if (name.empty()) return;
   if (!value) return;
-  std::unique_lock lock(m_mutex);
-  Entry* entry = GetOrNew(name);
+  std::unique_lock<wpi::mutex> entryLock;
+  Entry* entry = LockNamedEntry(name, entryLock);
+  WithEntryLocked(entry, entryLock, [&](auto& lock) {
+    // only reached without an entry when m_mutex is held
+    if (!entry) entry = GetOrNew(name);
 
-  SetEntryValueImpl(entry, value, lock, true);
+    SetEntryValueImpl(entry, value, lock, true);
+  });
 }
 
 void Storage::SetEntryTypeValue(unsigned int local_id,
                                 std::shared_ptr<Value> value) {
   if (!value) return;
-  std::unique_lock lock(m_mutex);
-  if (local_id >= m_localmap.size()) return;
-  Entry* entry = m_localmap[local_id].get();
+  std::unique_lock<wpi::mutex> entryLock;
+  Entry* entry = LockLocalEntry(local_id, entryLock);
   if (!entry) return;
 
-  SetEntryValueImpl(entry, value, lock, true);
+  WithEntryLocked(entry, entryLock, [&](auto& lock) {
+    SetEntryValueImpl(entry, value, lock, true);
+  });
 }
 
 void Storage::SetEntryFlags(StringRef name, unsigned int flags) {
   if (name.empty()) return;
-  std::unique_lock lock(m_mutex);
-  auto i = m_entries.find(name);
-  if (i == m_entries.end()) return;
-  SetEntryFlagsImpl(i->getValue(), flags, lock, true);
+  std::unique_lock<wpi::mutex> lock;
+  Entry* entry = LockNamedEntry(name, lock);
+  if (!entry) return;
+  SetEntryFlagsImpl(entry, flags, lock, true);
 }
 
 void Storage::SetEntryFlags(unsigned int id_local, unsigned int flags) {
-  std::unique_lock lock(m_mutex);
-  if (id_local >= m_localmap.size()) return;
-  SetEntryFlagsImpl(m_localmap[id_local].get(), flags, lock, true);
+  std::unique_lock<wpi::mutex> lock;
+  Entry* entry = LockLocalEntry(id_local, lock);
+  if (!entry) return;
+  SetEntryFlagsImpl(entry, flags, lock, true);
 }
 
 void Storage::SetEntryFlagsImpl(Entry* entry, unsigned int flags,
@@ -638,7 +876,9 @@ void Storage::SetEntryFlagsImpl(Entry* entry, unsigned int flags,
   entry->flags = flags;
 
   // notify
-  m_notifier.NotifyEntry(entry->local_id, entry->name, entry->value,
+  wpi::SmallString<128> nameBuf;
+  m_notifier.NotifyEntry(entry->local_id, GetName(entry, nameBuf),
+                         entry->value,
                          NT_NOTIFY_FLAGS | (local ? NT_NOTIFY_LOCAL : 0));
 
   // generate message
@@ -654,32 +894,33 @@ void Storage::SetEntryFlagsImpl(Entry* entry, unsigned int flags,
 }
 
 unsigned int Storage::GetEntryFlags(StringRef name) const {
-  std::scoped_lock lock(m_mutex);
-  auto i = m_entries.find(name);
-  if (i == m_entries.end()) return 0;
-  return i->getValue()->flags;
+  std::unique_lock<wpi::mutex> lock;
+  Entry* entry = LockNamedEntry(name, lock);
+  if (!entry) return 0;
+  return entry->flags;
 }
 
 unsigned int Storage::GetEntryFlags(unsigned int local_id) const {
-  std::scoped_lock lock(m_mutex);
-  if (local_id >= m_localmap.size()) return 0;
-  return m_localmap[local_id]->flags;
+  std::unique_lock<wpi::mutex> lock;
+  Entry* entry = LockLocalEntry(local_id, lock);
+  if (!entry) return 0;
+  return entry->flags;
 }
 
 void Storage::DeleteEntry(StringRef name) {
   std::unique_lock lock(m_mutex);
-  auto i = m_entries.find(name);
-  if (i == m_entries.end()) return;
-  DeleteEntryImpl(i->getValue(), lock, true);
+  Entry* entry = FindEntry(name);
+  if (!entry) return;
+  DeleteEntryImpl(entry, lock, true);
 }
 
 void Storage::DeleteEntry(unsigned int local_id) {
   std::unique_lock lock(m_mutex);
   if (local_id >= m_localmap.size()) return;
-  DeleteEntryImpl(m_localmap[local_id].get(), lock, true);
+  DeleteEntryImpl(m_localmap[local_id], lock, true);
 }
 
-void Storage::DeleteEntryImpl(Entry* entry, std::unique_lock<wpi::mutex>& lock,
+void Storage::DeleteEntryImpl(Entry* entry, std::unique_lock<EntryMutex>& lock,
                               bool local) {
   unsigned int id = entry->id;
 
@@ -689,13 +930,15 @@ void Storage::DeleteEntryImpl(Entry* entry, std::unique_lock<wpi::mutex>& lock,
   // empty the value and reset id and local_write flag
   std::shared_ptr<Value> old_value;
   old_value.swap(entry->value);
+  if (auto history = GetHistory(entry)) history->Clear();
   entry->id = 0xffff;
   entry->local_write = false;
 
   // remove RPC if there was one
-  if (entry->rpc_uid != UINT_MAX) {
-    m_rpc_server.RemoveRpc(entry->rpc_uid);
-    entry->rpc_uid = UINT_MAX;
+  auto rpc = m_rpcs.find(entry->local_id);
+  if (rpc != m_rpcs.end() && rpc->second.rpc_uid != UINT_MAX) {
+    m_rpc_server.RemoveRpc(rpc->second.rpc_uid);
+    rpc->second.rpc_uid = UINT_MAX;
   }
 
   // update persistent dirty flag if it's a persistent value
@@ -707,7 +950,8 @@ void Storage::DeleteEntryImpl(Entry* entry, std::unique_lock<wpi::mutex>& lock,
   if (!old_value) return;  // was not previously assigned
 
   // notify
-  m_notifier.NotifyEntry(entry->local_id, entry->name, old_value,
+  wpi::SmallString<128> nameBuf;
+  m_notifier.NotifyEntry(entry->local_id, GetName(entry, nameBuf), old_value,
                          NT_NOTIFY_DELETE | (local ? NT_NOTIFY_LOCAL : 0));
 
   // if it had a value, generate message
@@ -722,17 +966,20 @@ void Storage::DeleteEntryImpl(Entry* entry, std::unique_lock<wpi::mutex>& lock,
 
 template <typename F>
 void Storage::DeleteAllEntriesImpl(bool local, F should_delete) {
+  wpi::SmallString<128> nameBuf;
   for (auto& i : m_entries) {
-    Entry* entry = i.getValue();
+    Entry* entry = &i.getValue();
     if (entry->value && should_delete(entry)) {
       // notify it's being deleted
-      m_notifier.NotifyEntry(entry->local_id, i.getKey(), entry->value,
+      m_notifier.NotifyEntry(entry->local_id, GetName(entry, nameBuf),
+                             entry->value,
                              NT_NOTIFY_DELETE | (local ? NT_NOTIFY_LOCAL : 0));
       // remove it from idmap
       if (entry->id < m_idmap.size()) m_idmap[entry->id] = nullptr;
       entry->id = 0xffff;
       entry->local_write = false;
       entry->value.reset();
+      if (auto history = GetHistory(entry)) history->Clear();
       continue;
     }
   }
@@ -759,22 +1006,57 @@ void Storage::DeleteAllEntries() {
 
 Storage::Entry* Storage::GetOrNew(const Twine& name) {
   wpi::SmallString<128> nameBuf;
-  StringRef nameStr = name.toStringRef(nameBuf);
-  auto& entry = m_entries[nameStr];
-  if (!entry) {
-    m_localmap.emplace_back(new Entry(nameStr));
-    entry = m_localmap.back().get();
-    entry->local_id = m_localmap.size() - 1;
+  auto [dirName, leaf] = SplitName(name.toStringRef(nameBuf));
+  auto [dir, newDir] = m_dirs.try_emplace(dirName, m_dir_names.size());
+  if (newDir) m_dir_names.emplace_back(dir->getKey());
+  wpi::SmallString<64> keyBuf;
+  StringRef key = MakeKey(dir->getValue(), leaf, keyBuf);
+  auto [it, inserted] = m_entries.try_emplace(key, key);
+  Entry* entry = &it->getValue();
+  if (inserted) {
+    // the map owns the only copy of the key
+    entry->key = it->getKey();
+    entry->local_id = m_localmap.size();
+    m_localmap.emplace_back(entry);
+    if (!m_history_sizes.empty()) UpdateHistorySize(entry);
   }
   return entry;
 }
 
+void Storage::UpdateHistorySize(Entry* entry) {
+  // the longest matching prefix wins
+  const std::string* prefix = nullptr;
+  unsigned int size = 0;
+  for (auto& config : m_history_sizes) {
+    if (NameStartsWith(entry, config.first) &&
+        (!prefix || config.first.size() > prefix->size())) {
+      prefix = &config.first;
+      size = config.second;
+    }
+  }
+  if (size == 0) {
+    m_histories.erase(entry->local_id);
+    return;
+  }
+  auto& history = m_histories[entry->local_id];
+  if (history)
+    history->Resize(size);
+  else
+    history = std::make_unique<ValueHistory>(size);
+}
+
 unsigned int Storage::GetEntry(const Twine& name) {
   if (name.isTriviallyEmpty() ||
       (name.isSingleStringRef() && name.getSingleStringRef().empty()))
     return UINT_MAX;
-  std::unique_lock lock(m_mutex);
-  return GetOrNew(name)->local_id;
+  wpi::SmallString<128> nameBuf;
+  StringRef nameStr = name.toStringRef(nameBuf);
+  {
+    std::unique_lock<wpi::mutex> lock;
+    if (Entry* entry = LockNamedEntry(nameStr, lock)) return entry->local_id;
+  }
+  std::scoped_lock lock(m_mutex);
+  return GetOrNew(nameStr)->local_id;
 }
 
 std::vector<unsigned int> Storage::GetEntries(const Twine& prefix,
@@ -784,9 +1066,9 @@ std::vector<unsigned int> Storage::GetEntries(const Twine& prefix,
   std::scoped_lock lock(m_mutex);
   std::vector<unsigned int> ids;
   for (auto& i : m_entries) {
-    Entry* entry = i.getValue();
+    Entry* entry = &i.getValue();
     auto value = entry->value.get();
-    if (!value || !i.getKey().startswith(prefixStr)) continue;
+    if (!value || !NameStartsWith(entry, prefixStr)) continue;
     if (types != 0 && (types & value->type()) == 0) continue;
     ids.push_back(entry->local_id);
   }
@@ -800,13 +1082,13 @@ EntryInfo Storage::GetEntryInfo(int inst, unsigned int local_id) const {
   info.flags = 0;
   info.last_change = 0;
 
-  std::unique_lock lock(m_mutex);
-  if (local_id >= m_localmap.size()) return info;
-  Entry* entry = m_localmap[local_id].get();
-  if (!entry->value) return info;
+  std::unique_lock<wpi::mutex> lock;
+  Entry* entry = LockLocalEntry(local_id, lock);
+  if (!entry || !entry->value) return info;
 
   info.entry = Handle(inst, local_id, Handle::kEntry);
-  info.name = entry->name;
+  wpi::SmallString<128> nameBuf;
+  info.name = GetName(entry, nameBuf);
   info.type = entry->value->type();
   info.flags = entry->flags;
   info.last_change = entry->value->last_change();
@@ -814,24 +1096,24 @@ EntryInfo Storage::GetEntryInfo(int inst, unsigned int local_id) const {
 }
 
 std::string Storage::GetEntryName(unsigned int local_id) const {
-  std::unique_lock lock(m_mutex);
-  if (local_id >= m_localmap.size()) return std::string{};
-  return m_localmap[local_id]->name;
+  std::unique_lock<wpi::mutex> lock;
+  Entry* entry = LockLocalEntry(local_id, lock);
+  if (!entry) return std::string{};
+  wpi::SmallString<128> nameBuf;
+  return GetName(entry, nameBuf);
 }
 
 NT_Type Storage::GetEntryType(unsigned int local_id) const {
-  std::unique_lock lock(m_mutex);
-  if (local_id >= m_localmap.size()) return NT_UNASSIGNED;
-  Entry* entry = m_localmap[local_id].get();
-  if (!entry->value) return NT_UNASSIGNED;
+  std::unique_lock<wpi::mutex> lock;
+  Entry* entry = LockLocalEntry(local_id, lock);
+  if (!entry || !entry->value) return NT_UNASSIGNED;
   return entry->value->type();
 }
 
 uint64_t Storage::GetEntryLastChange(unsigned int local_id) const {
-  std::unique_lock lock(m_mutex);
-  if (local_id >= m_localmap.size()) return 0;
-  Entry* entry = m_localmap[local_id].get();
-  if (!entry->value) return 0;
+  std::unique_lock<wpi::mutex> lock;
+  Entry* entry = LockLocalEntry(local_id, lock);
+  if (!entry || !entry->value) return 0;
   return entry->value->last_change();
 }
 
@@ -841,14 +1123,15 @@ std::vector<EntryInfo> Storage::GetEntryInfo(int inst, const Twine& prefix,
   StringRef prefixStr = prefix.toStringRef(prefixBuf);
   std::scoped_lock lock(m_mutex);
   std::vector<EntryInfo> infos;
+  wpi::SmallString<128> nameBuf;
   for (auto& i : m_entries) {
-    Entry* entry = i.getValue();
+    Entry* entry = &i.getValue();
     auto value = entry->value.get();
-    if (!value || !i.getKey().startswith(prefixStr)) continue;
+    if (!value || !NameStartsWith(entry, prefixStr)) continue;
     if (types != 0 && (types & value->type()) == 0) continue;
     EntryInfo info;
     info.entry = Handle(inst, entry->local_id, Handle::kEntry);
-    info.name = i.getKey();
+    info.name = GetName(entry, nameBuf);
     info.type = value->type();
     info.flags = entry->flags;
     info.last_change = value->last_change();
@@ -867,11 +1150,13 @@ unsigned int Storage::AddListener(
   unsigned int uid = m_notifier.Add(callback, prefixStr, flags);
   // perform immediate notifications
   if ((flags & NT_NOTIFY_IMMEDIATE) != 0 && (flags & NT_NOTIFY_NEW) != 0) {
+    wpi::SmallString<128> nameBuf;
     for (auto& i : m_entries) {
-      Entry* entry = i.getValue();
-      if (!entry->value || !i.getKey().startswith(prefixStr)) continue;
-      m_notifier.NotifyEntry(entry->local_id, i.getKey(), entry->value,
-                             NT_NOTIFY_IMMEDIATE | NT_NOTIFY_NEW, uid);
+      const Entry* entry = &i.getValue();
+      if (!entry->value || !NameStartsWith(entry, prefixStr)) continue;
+      m_notifier.NotifyEntry(entry->local_id, GetName(entry, nameBuf),
+                             entry->value, NT_NOTIFY_IMMEDIATE | NT_NOTIFY_NEW,
+                             uid);
     }
   }
   return uid;
@@ -886,9 +1171,10 @@ unsigned int Storage::AddListener(
   // perform immediate notifications
   if ((flags & NT_NOTIFY_IMMEDIATE) != 0 && (flags & NT_NOTIFY_NEW) != 0 &&
       local_id < m_localmap.size()) {
-    Entry* entry = m_localmap[local_id].get();
+    Entry* entry = m_localmap[local_id];
     if (entry->value) {
-      m_notifier.NotifyEntry(local_id, entry->name, entry->value,
+      wpi::SmallString<128> nameBuf;
+      m_notifier.NotifyEntry(local_id, GetName(entry, nameBuf), entry->value,
                              NT_NOTIFY_IMMEDIATE | NT_NOTIFY_NEW, uid);
     }
   }
@@ -904,12 +1190,13 @@ unsigned int Storage::AddPolledListener(unsigned int poller,
   unsigned int uid = m_notifier.AddPolled(poller, prefixStr, flags);
   // perform immediate notifications
   if ((flags & NT_NOTIFY_IMMEDIATE) != 0 && (flags & NT_NOTIFY_NEW) != 0) {
+    wpi::SmallString<128> nameBuf;
     for (auto& i : m_entries) {
-      if (!i.getKey().startswith(prefixStr)) continue;
-      Entry* entry = i.getValue();
-      if (!entry->value) continue;
-      m_notifier.NotifyEntry(entry->local_id, i.getKey(), entry->value,
-                             NT_NOTIFY_IMMEDIATE | NT_NOTIFY_NEW, uid);
+      const Entry* entry = &i.getValue();
+      if (!entry->value || !NameStartsWith(entry, prefixStr)) continue;
+      m_notifier.NotifyEntry(entry->local_id, GetName(entry, nameBuf),
+                             entry->value, NT_NOTIFY_IMMEDIATE | NT_NOTIFY_NEW,
+                             uid);
     }
   }
   return uid;
@@ -923,10 +1210,11 @@ unsigned int Storage::AddPolledListener(unsigned int poller,
   // perform immediate notifications
   if ((flags & NT_NOTIFY_IMMEDIATE) != 0 && (flags & NT_NOTIFY_NEW) != 0 &&
       local_id < m_localmap.size()) {
-    Entry* entry = m_localmap[local_id].get();
+    Entry* entry = m_localmap[local_id];
     // if no value, don't notify
     if (entry->value) {
-      m_notifier.NotifyEntry(local_id, entry->name, entry->value,
+      wpi::SmallString<128> nameBuf;
+      m_notifier.NotifyEntry(local_id, GetName(entry, nameBuf), entry->value,
                              NT_NOTIFY_IMMEDIATE | NT_NOTIFY_NEW, uid);
     }
   }
@@ -944,11 +1232,12 @@ bool Storage::GetPersistentEntries(
     if (periodic && !m_persistent_dirty) return false;
     m_persistent_dirty = false;
     entries->reserve(m_entries.size());
+    wpi::SmallString<128> nameBuf;
     for (auto& i : m_entries) {
-      Entry* entry = i.getValue();
+      const Entry* entry = &i.getValue();
       // only write persistent-flagged values
       if (!entry->value || !entry->IsPersistent()) continue;
-      entries->emplace_back(i.getKey(), entry->value);
+      entries->emplace_back(GetName(entry, nameBuf), entry->value);
     }
   }
 
@@ -971,11 +1260,12 @@ bool Storage::GetEntries(
   {
     std::scoped_lock lock(m_mutex);
     entries->reserve(m_entries.size());
+    wpi::SmallString<128> nameBuf;
     for (auto& i : m_entries) {
-      Entry* entry = i.getValue();
+      const Entry* entry = &i.getValue();
       // only write values with given prefix
-      if (!entry->value || !i.getKey().startswith(prefixStr)) continue;
-      entries->emplace_back(i.getKey(), entry->value);
+      if (!entry->value || !NameStartsWith(entry, prefixStr)) continue;
+      entries->emplace_back(GetName(entry, nameBuf), entry->value);
     }
   }
 
@@ -992,14 +1282,14 @@ void Storage::CreateRpc(unsigned int local_id, StringRef def,
                         unsigned int rpc_uid) {
   std::unique_lock lock(m_mutex);
   if (local_id >= m_localmap.size()) return;
-  Entry* entry = m_localmap[local_id].get();
+  Entry* entry = m_localmap[local_id];
 
   auto old_value = entry->value;
   auto value = Value::MakeRpc(def);
   entry->value = value;
 
   // set up the RPC info
-  entry->rpc_uid = rpc_uid;
+  m_rpcs[local_id].rpc_uid = rpc_uid;
 
   if (old_value && *old_value == *value) return;
 
@@ -1015,8 +1305,10 @@ void Storage::CreateRpc(unsigned int local_id, StringRef def,
   auto dispatcher = m_dispatcher;
   if (!old_value || old_value->type() != value->type()) {
     ++entry->seq_num;
-    auto msg = Message::EntryAssign(
-        entry->name, entry->id, entry->seq_num.value(), value, entry->flags);
+    wpi::SmallString<128> nameBuf;
+    auto msg =
+        Message::EntryAssign(GetName(entry, nameBuf), entry->id,
+                             entry->seq_num.value(), value, entry->flags);
     lock.unlock();
     dispatcher->QueueOutgoing(msg, nullptr, nullptr);
   } else {
@@ -1030,21 +1322,23 @@ void Storage::CreateRpc(unsigned int local_id, StringRef def,
 unsigned int Storage::CallRpc(unsigned int local_id, StringRef params) {
   std::unique_lock lock(m_mutex);
   if (local_id >= m_localmap.size()) return 0;
-  Entry* entry = m_localmap[local_id].get();
+  Entry* entry = m_localmap[local_id];
 
   if (!entry->value || !entry->value->IsRpc()) return 0;
 
-  ++entry->rpc_call_uid;
-  if (entry->rpc_call_uid > 0xffff) entry->rpc_call_uid = 0;
-  unsigned int call_uid = entry->rpc_call_uid;
+  auto& rpc = m_rpcs[local_id];
+  ++rpc.call_uid;
+  if (rpc.call_uid > 0xffff) rpc.call_uid = 0;
+  unsigned int call_uid = rpc.call_uid;
 
   auto msg = Message::ExecuteRpc(entry->id, call_uid, params);
-  StringRef name{entry->name};
 
   if (m_server) {
     // RPCs are unlikely to be used locally on the server, but handle it
     // gracefully anyway.
-    auto rpc_uid = entry->rpc_uid;
+    auto rpc_uid = rpc.rpc_uid;
+    wpi::SmallString<128> nameBuf;
+    StringRef name = GetName(entry, nameBuf);
     lock.unlock();
     ConnectionInfo conn_info;
     conn_info.remote_id = "Server";
@@ -1055,7 +1349,7 @@ unsigned int Storage::CallRpc(unsigned int local_id, StringRef params) {
     unsigned int call_uid = msg->seq_num_uid();
     m_rpc_server.ProcessRpc(local_id, call_uid, name, msg->str(), conn_info,
                             [=](StringRef result) {
-                              std::scoped_lock lock(m_mutex);
+                              std::scoped_lock lock(m_rpc_mutex);
                               m_rpc_results.insert(std::make_pair(
                                   RpcIdPair{local_id, call_uid}, result));
                               m_rpc_results_cond.notify_all();
@@ -1078,7 +1372,7 @@ bool Storage::GetRpcResult(unsigned int local_id, unsigned int call_uid,
 bool Storage::GetRpcResult(unsigned int local_id, unsigned int call_uid,
                            std::string* result, double timeout,
                            bool* timed_out) {
-  std::unique_lock lock(m_mutex);
+  std::unique_lock lock(m_rpc_mutex);
 
   RpcIdPair call_pair{local_id, call_uid};
 
@@ -1124,8 +1418,81 @@ bool Storage::GetRpcResult(unsigned int local_id, unsigned int call_uid,
 }
 
 void Storage::CancelRpcResult(unsigned int local_id, unsigned int call_uid) {
-  std::unique_lock lock(m_mutex);
+  std::scoped_lock lock(m_rpc_mutex);
   // safe to erase even if id does not exist
   m_rpc_blocking_calls.erase(RpcIdPair{local_id, call_uid});
   m_rpc_results_cond.notify_all();
 }
+
+void Storage::SetEntryHistory(const Twine& prefix, unsigned int size) {
+  std::scoped_lock lock(m_mutex);
+  std::string prefixStr = prefix.str();
+  auto it = std::find_if(
+      m_history_sizes.begin(), m_history_sizes.end(),
+      [&](const auto& config) { return config.first == prefixStr; });
+  if (it != m_history_sizes.end())
+    it->second = size;
+  else
+    m_history_sizes.emplace_back(prefixStr, size);
+
+  for (auto& i : m_entries) {
+    Entry* entry = &i.getValue();
+    if (NameStartsWith(entry, prefixStr)) UpdateHistorySize(entry);
+  }
+}
+
+bool Storage::FetchEntryHistory(unsigned int local_id, uint64_t start,
+                                uint64_t end, double timeout,
+                                std::vector<std::shared_ptr<Value>>* values) {
+  values->clear();
+  std::unique_lock<wpi::mutex> lock;
+  Entry* entry = LockLocalEntry(local_id, lock);
+  if (!entry) return false;
+
+  // the server (or a standalone instance) has the history locally
+  if (m_server) {
+    ValueHistory* history = GetHistory(entry);
+    if (!history) return false;
+    history->Get(start, end, values);
+    return true;
+  }
+
+  unsigned int id = entry->id;
+  auto dispatcher = m_dispatcher;
+  lock.unlock();
+  if (id == 0xffff || !dispatcher) return false;
+
+  std::unique_lock rpcLock(m_rpc_mutex);
+  m_history_uid = (m_history_uid + 1) & 0xffff;
+  unsigned int uid = m_history_uid;
+  m_history_results[uid] = HistoryResult{};
+  rpcLock.unlock();
+
+  // Only protocol 3.1 servers answer history requests.  This is checked
+  // after registering the request so that a disconnect after the check
+  // cancels it.
+  if (dispatcher->GetMaxProtoRev() < 0x0301) {
+    rpcLock.lock();
+    m_history_results.erase(uid);
+    return false;
+  }
+
+  dispatcher->QueueOutgoing(Message::HistoryRequest(id, uid, start, end),
+                            nullptr, nullptr);
+
+  rpcLock.lock();
+  auto done = [&] { return m_terminating || m_history_results[uid].done; };
+  if (timeout < 0) {
+    m_rpc_results_cond.wait(rpcLock, done);
+  } else {
+    m_rpc_results_cond.wait_until(rpcLock,
+                                  std::chrono::steady_clock::now() +
+                                      std::chrono::duration<double>(timeout),
+                                  done);
+  }
+  auto& result = m_history_results[uid];
+  bool ok = result.done && result.ok;
+  if (ok) values->swap(result.values);
+  m_history_results.erase(uid);
+  return ok;
+}
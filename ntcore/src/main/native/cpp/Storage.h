@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -20,6 +20,7 @@
 
 #include <wpi/DenseMap.h>
 #include <wpi/SmallSet.h>
+#include <wpi/SmallVector.h>
 #include <wpi/StringMap.h>
 #include <wpi/condition_variable.h>
 #include <wpi/mutex.h>
@@ -27,6 +28,7 @@
 #include "IStorage.h"
 #include "Message.h"
 #include "SequenceNumber.h"
+#include "ValueHistory.h"
 #include "ntcore_cpp.h"
 
 namespace wpi {
@@ -72,6 +74,7 @@ class Storage : public IStorage {
       INetworkConnection& conn, wpi::ArrayRef<std::shared_ptr<Message>> msgs,
       bool new_server,
       std::vector<std::shared_ptr<Message>>* out_msgs) override;
+  void CancelHistoryRequests() override;
 
   // User functions.  These are the actual implementations of the corresponding
   // user API functions in ntcore_cpp.
@@ -155,15 +158,23 @@ class Storage : public IStorage {
                     std::string* result, double timeout, bool* timed_out);
   void CancelRpcResult(unsigned int local_id, unsigned int call_uid);
 
+  // Value history.  Histories are kept wherever values are set (normally the
+  // server); clients fetch them from the server.
+  void SetEntryHistory(const Twine& prefix, unsigned int size);
+  bool FetchEntryHistory(unsigned int local_id, uint64_t start, uint64_t end,
+                         double timeout,
+                         std::vector<std::shared_ptr<Value>>* values);
+
  private:
-  // Data for each table entry.
+  // Data for each table entry.  Only what every entry needs is kept here;
+  // RPC and history state are in side tables keyed by local id.
   struct Entry {
-    explicit Entry(wpi::StringRef name_) : name(name_) {}
+    explicit Entry(wpi::StringRef key_) : key(key_) {}
     bool IsPersistent() const { return (flags & NT_PERSISTENT) != 0; }
 
-    // We redundantly store the name so that it's available when accessing the
-    // raw Entry* via the ID map.
-    std::string name;
+    // The entry's key in m_entries (see GetName()).  Entries live in the map
+    // next to their key, so this refers to it rather than storing a copy.
+    wpi::StringRef key;
 
     // The current value and flags.
     std::shared_ptr<Value> value;
@@ -183,30 +194,94 @@ class Storage : public IStorage {
     // If value has been written locally.  Used during initial handshake
     // on client to determine whether or not to accept remote changes.
     bool local_write{false};
+  };
 
+  // RPC state for RPC entries.
+  struct RpcInfo {
     // RPC handle.
     unsigned int rpc_uid{UINT_MAX};
 
     // Last UID used when calling this RPC (primarily for client use).  This
     // is incremented for each call.
-    unsigned int rpc_call_uid{0};
+    unsigned int call_uid{0};
   };
 
-  typedef wpi::StringMap<Entry*> EntriesMap;
+  // Entry names are split after their last '/' into a directory and a leaf.
+  // Directories are interned in m_dirs, so one shared by many entries (as
+  // most are) is stored once, and entries are keyed in m_entries by their
+  // directory's index (4 bytes) followed by their leaf.  Entries are never
+  // removed from the map, so pointers to them are stable.
+  typedef wpi::StringMap<Entry> EntriesMap;
+  typedef wpi::StringMap<unsigned int> DirMap;
   typedef std::vector<Entry*> IdMap;
-  typedef std::vector<std::unique_ptr<Entry>> LocalMap;
+  typedef std::vector<Entry*> LocalMap;
   typedef std::pair<unsigned int, unsigned int> RpcIdPair;
   typedef wpi::DenseMap<RpcIdPair, std::string> RpcResultMap;
   typedef wpi::SmallSet<RpcIdPair, 12> RpcBlockingCallSet;
+  struct HistoryResult {
+    bool done = false;
+    // false if the server has no history for the entry, or the request
+    // was cancelled
+    bool ok = false;
+    std::vector<std::shared_ptr<Value>> values;
+  };
+  typedef wpi::DenseMap<unsigned int, HistoryResult> HistoryResultMap;
+
+  // Entry fields are guarded by one of several mutexes ("stripes"), selected
+  // by local id, so that value and flags updates to different entries from
+  // different threads don't contend with each other.  Locking the whole
+  // EntryMutex locks every stripe; this is required for anything that
+  // changes the maps or iterates over entries, and is what the rest of the
+  // code means by holding m_mutex.
+  class EntryMutex {
+   public:
+    static constexpr unsigned int kNumStripes = 16;
+
+    void lock() {
+      for (auto& stripe : m_stripes) stripe.mutex.lock();
+    }
+    void unlock() {
+      for (auto& stripe : m_stripes) stripe.mutex.unlock();
+    }
+
+    wpi::mutex& GetStripe(unsigned int key) {
+      return m_stripes[key % kNumStripes].mutex;
+    }
+
+   private:
+    // padded so stripes don't share cache lines
+    struct alignas(64) Stripe {
+      wpi::mutex mutex;
+    };
+    Stripe m_stripes[kNumStripes];
+  };
 
-  mutable wpi::mutex m_mutex;
+  mutable EntryMutex m_mutex;
   EntriesMap m_entries;
+  DirMap m_dirs;
+  // Directory names by index; these refer to the m_dirs keys
+  std::vector<StringRef> m_dir_names;
   IdMap m_idmap;
   LocalMap m_localmap;
+  // If any persistent values have changed
+  mutable std::atomic_bool m_persistent_dirty{false};
+  // History sizes by name prefix
+  std::vector<std::pair<std::string, unsigned int>> m_history_sizes;
+
+  // RPC state and value histories (if configured by SetEntryHistory()) by
+  // local id.  These are only added to or removed from with all of m_mutex
+  // held; each history is otherwise guarded by its entry's stripe.
+  wpi::DenseMap<unsigned int, RpcInfo> m_rpcs;
+  wpi::DenseMap<unsigned int, std::unique_ptr<ValueHistory>> m_histories;
+
+  // RPC results are independent of the entries, so have their own lock
+  mutable wpi::mutex m_rpc_mutex;
   RpcResultMap m_rpc_results;
   RpcBlockingCallSet m_rpc_blocking_calls;
-  // If any persistent values have changed
-  mutable bool m_persistent_dirty = false;
+  // Outstanding history requests (also guarded by m_rpc_mutex), keyed by
+  // request uid
+  HistoryResultMap m_history_results;
+  unsigned int m_history_uid = 0;
 
   // condition variable and termination flag for blocking on a RPC result
   std::atomic_bool m_terminating;
@@ -235,6 +310,10 @@ class Storage : public IStorage {
                                  std::weak_ptr<INetworkConnection> conn_weak);
   void ProcessIncomingRpcResponse(std::shared_ptr<Message> msg,
                                   INetworkConnection* conn);
+  void ProcessIncomingHistoryRequest(std::shared_ptr<Message> msg,
+                                     INetworkConnection* conn);
+  void ProcessIncomingHistoryResponse(std::shared_ptr<Message> msg,
+                                      INetworkConnection* conn);
 
   bool GetPersistentEntries(
       bool periodic,
@@ -243,11 +322,61 @@ class Storage : public IStorage {
   bool GetEntries(const Twine& prefix,
                   std::vector<std::pair<std::string, std::shared_ptr<Value>>>*
                       entries) const;
+
+  // Finds an entry and locks only its stripe.  The lookup function is called
+  // with a stripe held (which is enough to keep the maps from changing) and
+  // returns the entry or nullptr.  The hint selects the stripe used for the
+  // lookup; it's cheapest if it matches the local id of the entry found.
+  // The lock is left held even if no entry is found.
+  template <typename F>
+  Entry* LockEntry(unsigned int hint, F lookup,
+                   std::unique_lock<wpi::mutex>& lock) const;
+  Entry* LockLocalEntry(unsigned int local_id,
+                        std::unique_lock<wpi::mutex>& lock) const;
+  Entry* LockIdEntry(unsigned int id, std::unique_lock<wpi::mutex>& lock) const;
+  Entry* LockNamedEntry(StringRef name,
+                        std::unique_lock<wpi::mutex>& lock) const;
+
+  // Finds an entry by name.  Must be called with a stripe of m_mutex held.
+  Entry* FindEntry(StringRef name) const;
+
+  // Gets the full name of an entry, assembling it in buf.  Must be called
+  // with a stripe of m_mutex held.
+  StringRef GetName(const Entry* entry, wpi::SmallVectorImpl<char>& buf) const;
+
+  // Whether an entry's name starts with prefix.  Must be called with a
+  // stripe of m_mutex held.
+  bool NameStartsWith(const Entry* entry, StringRef prefix) const;
+
+  // Gets the history of an entry, or nullptr if none is kept.  Must be
+  // called with the entry's stripe held.
+  ValueHistory* GetHistory(const Entry* entry) const;
+
+  // Sets the value of an entry, recording it in the history.  Must be called
+  // with the entry's stripe held.
+  void SetValue(Entry* entry, std::shared_ptr<Value> value);
+
+  // Setting a value only needs the entry's stripe, unless the server needs to
+  // assign the entry an id.
+  bool NeedsIdAssignment(const Entry* entry) const {
+    return m_server && entry->id == 0xffff;
+  }
+
+  // Calls func(lock) with the entry's stripe held if that's enough, otherwise
+  // (no entry, or it needs an id) releases the stripe and calls it with all
+  // of m_mutex held.  entryLock must hold the entry's stripe.
+  template <typename F>
+  auto WithEntryLocked(Entry* entry, std::unique_lock<wpi::mutex>& entryLock,
+                       F func);
+
+  // Lock is either the entry's stripe or the whole m_mutex; if only the
+  // stripe, NeedsIdAssignment() must be false.
+  template <typename Lock>
   void SetEntryValueImpl(Entry* entry, std::shared_ptr<Value> value,
-                         std::unique_lock<wpi::mutex>& lock, bool local);
+                         Lock& lock, bool local);
   void SetEntryFlagsImpl(Entry* entry, unsigned int flags,
                          std::unique_lock<wpi::mutex>& lock, bool local);
-  void DeleteEntryImpl(Entry* entry, std::unique_lock<wpi::mutex>& lock,
+  void DeleteEntryImpl(Entry* entry, std::unique_lock<EntryMutex>& lock,
                        bool local);
 
   // Must be called with m_mutex held
@@ -255,6 +384,8 @@ class Storage : public IStorage {
   void DeleteAllEntriesImpl(bool local, F should_delete);
   void DeleteAllEntriesImpl(bool local);
   Entry* GetOrNew(const Twine& name);
+  // Must be called with m_mutex held
+  void UpdateHistorySize(Entry* entry);
 };
 
 }  // namespace nt
@@ -0,0 +1,41 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include "TimeSyncFilter.h"
+
+using namespace nt;
+
+bool TimeSyncFilter::AddSample(uint64_t t0, uint64_t t1, uint64_t t2,
+                               uint64_t t3) {
+  if (t3 < t0 || t2 < t1) return false;
+
+  // time spent on the network, excluding server processing
+  int64_t delay = static_cast<int64_t>(t3 - t0) - static_cast<int64_t>(t2 - t1);
+  if (delay < 0) delay = 0;
+  // assumes the request and response took equally long
+  int64_t offset = ((static_cast<int64_t>(t1) - static_cast<int64_t>(t0)) +
+                    (static_cast<int64_t>(t2) - static_cast<int64_t>(t3))) /
+                   2;
+
+  if (m_count > 0) {
+    int64_t change = delay > m_rtt ? delay - m_rtt : m_rtt - delay;
+    m_jitter += change - m_jitter / 16;
+  }
+  m_rtt = delay;
+
+  m_samples[m_next] = Sample{offset, delay};
+  m_next = (m_next + 1) % kSamples;
+  if (m_count < kSamples) ++m_count;
+
+  const Sample* best = &m_samples[0];
+  for (size_t i = 1; i < m_count; ++i) {
+    if (m_samples[i].delay < best->delay) best = &m_samples[i];
+  }
+  m_offset = best->offset;
+  m_delay = best->delay;
+  return true;
+}
@@ -0,0 +1,69 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#ifndef NTCORE_TIMESYNCFILTER_H_
+#define NTCORE_TIMESYNCFILTER_H_
+
+#include <stdint.h>
+
+#include <cstddef>
+
+namespace nt {
+
+/* Estimates the offset of the server clock from the local clock from
+ * NTP-style time sync exchanges.  Of the last kSamples exchanges, the one
+ * with the shortest round trip is used, as its offset is the least affected
+ * by queuing delays in either direction.
+ */
+class TimeSyncFilter {
+ public:
+  static constexpr size_t kSamples = 8;
+
+  /* Adds the result of an exchange.  Returns false (and ignores it) if the
+   * timestamps are inconsistent.
+   * @param t0 local time the request was sent
+   * @param t1 server time the request was received
+   * @param t2 server time the response was sent
+   * @param t3 local time the response was received
+   */
+  bool AddSample(uint64_t t0, uint64_t t1, uint64_t t2, uint64_t t3);
+
+  /* Returns true once at least one sample has been added. */
+  bool valid() const { return m_count > 0; }
+
+  /* Server clock minus local clock, in microseconds. */
+  int64_t offset() const { return m_offset; }
+
+  /* Round trip delay of the sample the offset came from, in microseconds. */
+  int64_t delay() const { return m_delay; }
+
+  /* Round trip delay of the most recent sample, in microseconds. */
+  int64_t rtt() const { return m_rtt; }
+
+  /* Smoothed variation of the round trip delay between consecutive samples,
+   * in microseconds (the interarrival jitter estimator of RFC 3550).
+   */
+  int64_t jitter() const { return m_jitter / 16; }
+
+ private:
+  struct Sample {
+    int64_t offset;
+    int64_t delay;
+  };
+
+  Sample m_samples[kSamples];
+  size_t m_count = 0;
+  size_t m_next = 0;
+  int64_t m_offset = 0;
+  int64_t m_delay = 0;
+  int64_t m_rtt = 0;
+  int64_t m_jitter = 0;  // scaled by 16
+};
+
+}  // namespace nt
+
+#endif  // NTCORE_TIMESYNCFILTER_H_
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -7,7 +7,12 @@
 
 #include <stdint.h>
 
+#include <cstring>
+#include <iterator>
+#include <new>
+
 #include <wpi/MemAlloc.h>
+#include <wpi/SmallString.h>
 #include <wpi/timestamp.h>
 
 #include "Value_internal.h"
@@ -26,21 +31,87 @@ Value::Value(NT_Type type, uint64_t time, const private_init&) {
     m_val.last_change = wpi::Now();
   else
     m_val.last_change = time;
-  if (m_val.type == NT_BOOLEAN_ARRAY)
+  if (m_val.type == NT_BOOLEAN_ARRAY) {
     m_val.data.arr_boolean.arr = nullptr;
-  else if (m_val.type == NT_DOUBLE_ARRAY)
+  } else if (m_val.type == NT_DOUBLE_ARRAY) {
     m_val.data.arr_double.arr = nullptr;
-  else if (m_val.type == NT_STRING_ARRAY)
+  } else if (m_val.type == NT_STRING_ARRAY) {
     m_val.data.arr_string.arr = nullptr;
+    m_val.data.arr_string.size = 0;
+  } else if (m_val.type == NT_STRING || m_val.type == NT_RAW ||
+             m_val.type == NT_RPC) {
+    m_val.data.v_string.str = nullptr;
+    m_val.data.v_string.len = 0;
+  }
 }
 
 Value::~Value() {
-  if (m_val.type == NT_BOOLEAN_ARRAY)
-    delete[] m_val.data.arr_boolean.arr;
-  else if (m_val.type == NT_DOUBLE_ARRAY)
-    delete[] m_val.data.arr_double.arr;
-  else if (m_val.type == NT_STRING_ARRAY)
-    delete[] m_val.data.arr_string.arr;
+  switch (m_val.type) {
+    case NT_BOOLEAN_ARRAY:
+      delete[] m_val.data.arr_boolean.arr;
+      break;
+    case NT_DOUBLE_ARRAY:
+      delete[] m_val.data.arr_double.arr;
+      break;
+    case NT_STRING_ARRAY:
+      if (NT_String* arr = m_val.data.arr_string.arr) {
+        size_t size = m_val.data.arr_string.size;
+        auto strings = reinterpret_cast<std::string*>(arr + size);
+        for (size_t i = 0; i < size; ++i) strings[i].~basic_string();
+        ::operator delete(arr);
+      }
+      break;
+    case NT_STRING:
+    case NT_RAW:
+    case NT_RPC:
+      if (!m_string) delete[] m_val.data.v_string.str;
+      break;
+    default:
+      break;
+  }
+}
+
+void Value::SetString(wpi::StringRef str) {
+  char* buf = new char[str.size() + 1];
+  std::memcpy(buf, str.data(), str.size());
+  buf[str.size()] = '\0';
+  if (m_string)
+    m_string.reset();
+  else
+    delete[] m_val.data.v_string.str;
+  m_val.data.v_string.str = buf;
+  m_val.data.v_string.len = str.size();
+}
+
+void Value::TakeString(std::string str) {
+  if (!m_string) delete[] m_val.data.v_string.str;
+  m_string = std::make_unique<std::string>(std::move(str));
+  m_val.data.v_string.str = const_cast<char*>(m_string->c_str());
+  m_val.data.v_string.len = m_string->size();
+}
+
+template <typename It>
+void Value::SetStringArray(It first, size_t size) {
+  static_assert(alignof(std::string) <= alignof(NT_String),
+                "std::string must fit after NT_String array");
+  void* buf = ::operator new(size * (sizeof(NT_String) + sizeof(std::string)));
+  auto arr = static_cast<NT_String*>(buf);
+  auto strings = reinterpret_cast<std::string*>(arr + size);
+  for (size_t i = 0; i < size; ++i, ++first) {
+    new (&strings[i]) std::string(*first);
+    arr[i].str = const_cast<char*>(strings[i].c_str());
+    arr[i].len = strings[i].size();
+  }
+  m_val.data.arr_string.arr = arr;
+  m_val.data.arr_string.size = size;
+}
+
+std::shared_ptr<Value> Value::MakeString(const wpi::Twine& value,
+                                         uint64_t time) {
+  auto val = std::make_shared<Value>(NT_STRING, time, private_init());
+  wpi::SmallString<128> buf;
+  val->SetString(value.toStringRef(buf));
+  return val;
 }
 
 std::shared_ptr<Value> Value::MakeBooleanArray(wpi::ArrayRef<bool> value,
@@ -73,30 +144,15 @@ std::shared_ptr<Value> Value::MakeDoubleArray(wpi::ArrayRef<double> value,
 std::shared_ptr<Value> Value::MakeStringArray(wpi::ArrayRef<std::string> value,
                                               uint64_t time) {
   auto val = std::make_shared<Value>(NT_STRING_ARRAY, time, private_init());
-  val->m_string_array = value;
-  // point NT_Value to the contents in the vector.
-  val->m_val.data.arr_string.arr = new NT_String[value.size()];
-  val->m_val.data.arr_string.size = val->m_string_array.size();
-  for (size_t i = 0; i < value.size(); ++i) {
-    val->m_val.data.arr_string.arr[i].str = const_cast<char*>(value[i].c_str());
-    val->m_val.data.arr_string.arr[i].len = value[i].size();
-  }
+  val->SetStringArray(value.begin(), value.size());
   return val;
 }
 
 std::shared_ptr<Value> Value::MakeStringArray(std::vector<std::string>&& value,
                                               uint64_t time) {
   auto val = std::make_shared<Value>(NT_STRING_ARRAY, time, private_init());
-  val->m_string_array = std::move(value);
+  val->SetStringArray(std::make_move_iterator(value.begin()), value.size());
   value.clear();
-  // point NT_Value to the contents in the vector.
-  val->m_val.data.arr_string.arr = new NT_String[val->m_string_array.size()];
-  val->m_val.data.arr_string.size = val->m_string_array.size();
-  for (size_t i = 0; i < val->m_string_array.size(); ++i) {
-    val->m_val.data.arr_string.arr[i].str =
-        const_cast<char*>(val->m_string_array[i].c_str());
-    val->m_val.data.arr_string.arr[i].len = val->m_string_array[i].size();
-  }
   return val;
 }
 
@@ -159,6 +215,97 @@ void nt::ConvertToC(wpi::StringRef in, NT_String* out) {
   out->str[in.size()] = '\0';
 }
 
+namespace {
+
+// Carves storage out of a caller-provided buffer.  Keeps counting once the
+// buffer is exhausted so the caller can learn the size needed.
+class BufferAllocator {
+ public:
+  BufferAllocator(char* buf, size_t len) : m_buf(buf), m_len(len) {}
+
+  template <typename T>
+  T* Allocate(size_t count) {
+    size_t pos = (m_used + alignof(T) - 1) & ~(alignof(T) - 1);
+    m_used = pos + count * sizeof(T);
+    if (m_used > m_len) return nullptr;
+    return reinterpret_cast<T*>(m_buf + pos);
+  }
+
+  size_t used() const { return m_used; }
+
+ private:
+  char* m_buf;
+  size_t m_len;
+  size_t m_used = 0;
+};
+
+}  // namespace
+
+static void ConvertToC(wpi::StringRef in, NT_String* out,
+                       BufferAllocator& alloc) {
+  out->len = in.size();
+  out->str = alloc.Allocate<char>(in.size() + 1);
+  if (!out->str) return;
+  std::memcpy(out->str, in.data(), in.size());
+  out->str[in.size()] = '\0';
+}
+
+size_t nt::ConvertToC(const Value& in, NT_Value* out, char* buf,
+                      size_t buf_len) {
+  BufferAllocator alloc(buf, buf_len);
+  out->type = NT_UNASSIGNED;
+  out->last_change = in.last_change();
+  switch (in.type()) {
+    case NT_UNASSIGNED:
+      return 0;
+    case NT_BOOLEAN:
+      out->data.v_boolean = in.GetBoolean() ? 1 : 0;
+      break;
+    case NT_DOUBLE:
+      out->data.v_double = in.GetDouble();
+      break;
+    case NT_STRING:
+      ::ConvertToC(in.GetString(), &out->data.v_string, alloc);
+      break;
+    case NT_RAW:
+      ::ConvertToC(in.GetRaw(), &out->data.v_raw, alloc);
+      break;
+    case NT_RPC:
+      ::ConvertToC(in.GetRpc(), &out->data.v_raw, alloc);
+      break;
+    case NT_BOOLEAN_ARRAY: {
+      auto v = in.GetBooleanArray();
+      out->data.arr_boolean.arr = alloc.Allocate<NT_Bool>(v.size());
+      out->data.arr_boolean.size = v.size();
+      if (out->data.arr_boolean.arr)
+        std::copy(v.begin(), v.end(), out->data.arr_boolean.arr);
+      break;
+    }
+    case NT_DOUBLE_ARRAY: {
+      auto v = in.GetDoubleArray();
+      out->data.arr_double.arr = alloc.Allocate<double>(v.size());
+      out->data.arr_double.size = v.size();
+      if (out->data.arr_double.arr)
+        std::copy(v.begin(), v.end(), out->data.arr_double.arr);
+      break;
+    }
+    case NT_STRING_ARRAY: {
+      auto v = in.GetStringArray();
+      NT_String* arr = alloc.Allocate<NT_String>(v.size());
+      out->data.arr_string.arr = arr;
+      out->data.arr_string.size = v.size();
+      NT_String str;
+      for (size_t i = 0; i < v.size(); ++i)
+        ::ConvertToC(v[i], arr ? &arr[i] : &str, alloc);
+      break;
+    }
+    default:
+      return 0;
+  }
+  if (alloc.used() <= buf_len) out->type = in.type();
+  return alloc.used();
+}
+
 std::shared_ptr<Value> nt::ConvertFromC(const NT_Value& value) {
   switch (value.type) {
     case NT_UNASSIGNED:
@@ -204,7 +351,8 @@ bool nt::operator==(const Value& lhs, const Value& rhs) {
     case NT_STRING:
     case NT_RAW:
     case NT_RPC:
-      return lhs.m_string == rhs.m_string;
+      return ConvertFromC(lhs.m_val.data.v_string) ==
+             ConvertFromC(rhs.m_val.data.v_string);
     case NT_BOOLEAN_ARRAY:
       if (lhs.m_val.data.arr_boolean.size != rhs.m_val.data.arr_boolean.size)
         return false;
@@ -220,7 +368,7 @@ bool nt::operator==(const Value& lhs, const Value& rhs) {
                          lhs.m_val.data.arr_double.size *
                              sizeof(lhs.m_val.data.arr_double.arr[0])) == 0;
     case NT_STRING_ARRAY:
-      return lhs.m_string_array == rhs.m_string_array;
+      return lhs.GetStringArray() == rhs.GetStringArray();
     default:
       // assert(false && "unknown value type");
       return false;
@@ -0,0 +1,49 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include "ValueHistory.h"
+
+using namespace nt;
+
+void ValueHistory::Add(std::shared_ptr<Value> value) {
+  if (m_values.empty()) return;
+  if (m_count < m_values.size()) {
+    m_values[(m_first + m_count) % m_values.size()] = std::move(value);
+    ++m_count;
+  } else {
+    // full; overwrite the oldest
+    m_values[m_first] = std::move(value);
+    m_first = (m_first + 1) % m_values.size();
+  }
+}
+
+void ValueHistory::Clear() {
+  for (auto& value : m_values) value.reset();
+  m_first = 0;
+  m_count = 0;
+}
+
+void ValueHistory::Resize(size_t size) {
+  if (size == m_values.size()) return;
+  std::vector<std::shared_ptr<Value>> values(size);
+  size_t count = m_count < size ? m_count : size;
+  for (size_t i = 0; i < count; ++i)
+    values[i] = std::move(m_values[(m_first + m_count - count + i) %
+                                   m_values.size()]);
+  m_values.swap(values);
+  m_first = 0;
+  m_count = count;
+}
+
+void ValueHistory::Get(uint64_t start, uint64_t end,
+                       std::vector<std::shared_ptr<Value>>* out) const {
+  for (size_t i = 0; i < m_count; ++i) {
+    auto& value = at(i);
+    uint64_t time = value->time();
+    if (time >= start && time <= end) out->push_back(value);
+  }
+}
@@ -0,0 +1,51 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#ifndef NTCORE_VALUEHISTORY_H_
+#define NTCORE_VALUEHISTORY_H_
+
+#include <stdint.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "networktables/NetworkTableValue.h"
+
+namespace nt {
+
+/* A fixed size ring of the most recent values of an entry, oldest first. */
+class ValueHistory {
+ public:
+  explicit ValueHistory(size_t size) : m_values(size) {}
+
+  size_t capacity() const { return m_values.size(); }
+  size_t size() const { return m_count; }
+
+  void Add(std::shared_ptr<Value> value);
+  void Clear();
+
+  // Changes the capacity, keeping the newest values.
+  void Resize(size_t size);
+
+  // Appends the values with start <= time <= end to out, oldest first.
+  void Get(uint64_t start, uint64_t end,
+           std::vector<std::shared_ptr<Value>>* out) const;
+
+ private:
+  const std::shared_ptr<Value>& at(size_t i) const {
+    return m_values[(m_first + i) % m_values.size()];
+  }
+
+  std::vector<std::shared_ptr<Value>> m_values;
+  size_t m_first = 0;
+  size_t m_count = 0;
+};
+
+}  // namespace nt
+
+#endif  // NTCORE_VALUEHISTORY_H_
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -20,6 +20,10 @@ namespace nt {
 class Value;
 
 void ConvertToC(const Value& in, NT_Value* out);
+// Converts into a caller-provided buffer (aligned as for double) rather than
+// allocating.  Returns the number of buffer bytes needed; if that's more than
+// buf_len, out is left unassigned.
+size_t ConvertToC(const Value& in, NT_Value* out, char* buf, size_t buf_len);
 std::shared_ptr<Value> ConvertFromC(const NT_Value& value);
 void ConvertToC(wpi::StringRef in, NT_String* out);
 inline wpi::StringRef ConvertFromC(const NT_String& str) {
@@ -113,22 +113,22 @@ bool WireDecoder::ReadType(NT_Type* type) {
   return true;
 }
 
-std::shared_ptr<Value> WireDecoder::ReadValue(NT_Type type) {
+std::shared_ptr<Value> WireDecoder::ReadValue(NT_Type type, uint64_t time) {
   switch (type) {
     case NT_BOOLEAN: {
       unsigned int v;
       if (!Read8(&v)) return nullptr;
-      return Value::MakeBoolean(v != 0);
+      return Value::MakeBoolean(v != 0, time);
     }
     case NT_DOUBLE: {
       double v;
       if (!ReadDouble(&v)) return nullptr;
-      return Value::MakeDouble(v);
+      return Value::MakeDouble(v, time);
     }
     case NT_STRING: {
       std::string v;
       if (!ReadString(&v)) return nullptr;
-      return Value::MakeString(std::move(v));
+      return Value::MakeString(std::move(v), time);
     }
     case NT_RAW: {
       if (m_proto_rev < 0x0300u) {
@@ -137,7 +137,7 @@ std::shared_ptr<Value> WireDecoder::ReadValue(NT_Type type) {
       }
       std::string v;
       if (!ReadString(&v)) return nullptr;
-      return Value::MakeRaw(std::move(v));
+      return Value::MakeRaw(std::move(v), time);
     }
     case NT_RPC: {
       if (m_proto_rev < 0x0300u) {
@@ -146,7 +146,7 @@ std::shared_ptr<Value> WireDecoder::ReadValue(NT_Type type) {
       }
       std::string v;
       if (!ReadString(&v)) return nullptr;
-      return Value::MakeRpc(std::move(v));
+      return Value::MakeRpc(std::move(v), time);
     }
     case NT_BOOLEAN_ARRAY: {
       // size
@@ -158,7 +158,7 @@ std::shared_ptr<Value> WireDecoder::ReadValue(NT_Type type) {
       if (!Read(&buf, size)) return nullptr;
       std::vector<int> v(size);
       for (unsigned int i = 0; i < size; ++i) v[i] = buf[i] ? 1 : 0;
-      return Value::MakeBooleanArray(std::move(v));
+      return Value::MakeBooleanArray(std::move(v), time);
     }
     case NT_DOUBLE_ARRAY: {
       // size
@@ -170,7 +170,7 @@ std::shared_ptr<Value> WireDecoder::ReadValue(NT_Type type) {
       if (!Read(&buf, size * 8)) return nullptr;
       std::vector<double> v(size);
       for (unsigned int i = 0; i < size; ++i) v[i] = ::ReadDouble(buf);
-      return Value::MakeDoubleArray(std::move(v));
+      return Value::MakeDoubleArray(std::move(v), time);
     }
     case NT_STRING_ARRAY: {
       // size
@@ -182,7 +182,7 @@ std::shared_ptr<Value> WireDecoder::ReadValue(NT_Type type) {
       for (unsigned int i = 0; i < size; ++i) {
         if (!ReadString(&v[i])) return nullptr;
       }
-      return Value::MakeStringArray(std::move(v));
+      return Value::MakeStringArray(std::move(v), time);
     }
     default:
       m_error = "invalid type when trying to read value";
@@ -206,3 +206,22 @@ bool WireDecoder::ReadString(std::string* str) {
   *str = wpi::StringRef(buf, len);
   return true;
 }
+
+bool WireDecoder::ReadEntryName(std::string* name) {
+  if (m_proto_rev < 0x0301u) return ReadString(name);
+
+  uint64_t prefix;
+  if (!ReadUleb128(&prefix)) return false;
+  if (prefix > m_last_name.size()) {
+    m_error = "entry name prefix longer than previous name";
+    return false;
+  }
+  uint64_t len;
+  if (!ReadUleb128(&len)) return false;
+  const char* buf;
+  if (!Read(&buf, len)) return false;
+  m_last_name.resize(prefix);
+  m_last_name.append(buf, len);
+  *name = m_last_name;
+  return true;
+}
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -43,6 +43,18 @@ class WireDecoder {
   /* Get the logger. */
   wpi::Logger& logger() const { return m_logger; }
 
+  /* Set the offset of the server clock from the local clock (zero on the
+   * server), used to convert timestamps received from the network.
+   */
+  void set_time_offset(int64_t offset) { m_time_offset = offset; }
+
+  /* Converts a server timestamp to the local timebase. */
+  uint64_t ToLocalTime(uint64_t time) const {
+    int64_t local = static_cast<int64_t>(time) - m_time_offset;
+    // zero means "now" when creating values, so clamp to 1
+    return local > 0 ? local : 1;
+  }
+
   /* Clears error indicator. */
   void Reset() { m_error = nullptr; }
 
@@ -124,7 +136,14 @@ class WireDecoder {
 
   bool ReadType(NT_Type* type);
   bool ReadString(std::string* str);
-  std::shared_ptr<Value> ReadValue(NT_Type type);
+
+  /* Reads an entry name (see WireEncoder::WriteEntryName()). */
+  bool ReadEntryName(std::string* name);
+
+  /* Reads a value.  If time is nonzero, it's used as the value timestamp
+   * instead of the current time.
+   */
+  std::shared_ptr<Value> ReadValue(NT_Type type, uint64_t time = 0);
 
   WireDecoder(const WireDecoder&) = delete;
   WireDecoder& operator=(const WireDecoder&) = delete;
@@ -151,6 +170,12 @@ class WireDecoder {
 
   /* allocated size of temporary buffer */
   size_t m_allocated;
+
+  /* last entry name read */
+  std::string m_last_name;
+
+  /* server clock minus local clock */
+  int64_t m_time_offset = 0;
 };
 
 }  // namespace nt
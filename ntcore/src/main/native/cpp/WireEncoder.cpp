@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
@@ -33,7 +34,7 @@ void WireEncoder::WriteDouble(double val) {
        static_cast<char>((v >> 8) & 0xff), static_cast<char>(v & 0xff)});
 }
 
-void WireEncoder::WriteUleb128(uint32_t val) { wpi::WriteUleb128(m_data, val); }
+void WireEncoder::WriteUleb128(uint64_t val) { wpi::WriteUleb128(m_data, val); }
 
 void WireEncoder::WriteType(NT_Type type) {
   char ch;
@@ -197,3 +198,20 @@ void WireEncoder::WriteString(wpi::StringRef str) {
   // contents
   m_data.append(str.data(), str.data() + len);
 }
+
+void WireEncoder::WriteEntryName(wpi::StringRef name) {
+  if (m_proto_rev < 0x0301u) {
+    WriteString(name);
+    return;
+  }
+
+  // length of prefix shared with the last name
+  size_t prefix = 0;
+  size_t maxPrefix = std::min(name.size(), m_last_name.size());
+  while (prefix < maxPrefix && name[prefix] == m_last_name[prefix]) ++prefix;
+  WriteUleb128(prefix);
+  WriteString(name.substr(prefix));
+
+  m_last_name.resize(prefix);
+  m_last_name.append(name.data() + prefix, name.size() - prefix);
+}
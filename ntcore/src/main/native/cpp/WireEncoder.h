@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -12,6 +12,7 @@
 
 #include <cassert>
 #include <cstddef>
+#include <string>
 
 #include <wpi/SmallVector.h>
 #include <wpi/StringRef.h>
@@ -35,6 +36,25 @@ class WireEncoder {
   /* Get the active protocol revision. */
   unsigned int proto_rev() const { return m_proto_rev; }
 
+  /* Set whether entry updates include the value timestamp (protocol 3.1 and
+   * later).  Timestamps are sent in the server timebase, so this should only
+   * be enabled once the offset of the server clock is known.
+   */
+  void set_timestamps(bool timestamps) { m_timestamps = timestamps; }
+
+  bool timestamps() const { return m_timestamps; }
+
+  /* Set the offset of the server clock from the local clock (zero on the
+   * server).
+   */
+  void set_time_offset(int64_t offset) { m_time_offset = offset; }
+
+  /* Converts a local timestamp to the server timebase. */
+  uint64_t ToServerTime(uint64_t time) const {
+    int64_t server = static_cast<int64_t>(time) + m_time_offset;
+    return server > 0 ? server : 1;
+  }
+
   /* Clears buffer and error indicator. */
   void Reset() {
     m_data.clear();
@@ -79,12 +99,18 @@ class WireEncoder {
   void WriteDouble(double val);
 
   /* Writes an ULEB128-encoded unsigned integer. */
-  void WriteUleb128(uint32_t val);
+  void WriteUleb128(uint64_t val);
 
   void WriteType(NT_Type type);
   void WriteValue(const Value& value);
   void WriteString(wpi::StringRef str);
 
+  /* Writes an entry name.  From protocol revision 3.1, the name is written as
+   * the ULEB128 length of the prefix it shares with the previously written
+   * entry name, followed by the remainder as a string.
+   */
+  void WriteEntryName(wpi::StringRef name);
+
   /* Utility function to get the written size of a value (without actually
    * writing it).
    */
@@ -104,6 +130,14 @@ class WireEncoder {
 
  private:
   wpi::SmallVector<char, 256> m_data;
+
+  /* Last entry name written (kept across Reset()). */
+  std::string m_last_name;
+
+  bool m_timestamps = false;
+
+  /* server clock minus local clock */
+  int64_t m_time_offset = 0;
 };
 
 }  // namespace nt
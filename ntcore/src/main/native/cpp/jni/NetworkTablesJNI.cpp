@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2018-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2018-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -36,6 +36,7 @@ static JClass doubleCls;
 static JClass entryInfoCls;
 static JClass entryNotificationCls;
 static JClass logMessageCls;
+static JClass longCls;
 static JClass rpcAnswerCls;
 static JClass valueCls;
 static JException illegalArgEx;
@@ -52,6 +53,7 @@ static const JClassInit classes[] = {
     {"edu/wpi/first/networktables/EntryInfo", &entryInfoCls},
     {"edu/wpi/first/networktables/EntryNotification", &entryNotificationCls},
     {"edu/wpi/first/networktables/LogMessage", &logMessageCls},
+    {"java/lang/Long", &longCls},
     {"edu/wpi/first/networktables/RpcAnswer", &rpcAnswerCls},
     {"edu/wpi/first/networktables/NetworkTableValue", &valueCls}};
 
@@ -207,12 +209,13 @@ static jobject MakeJValue(JNIEnv* env, const nt::Value* value) {
 static jobject MakeJObject(JNIEnv* env, const nt::ConnectionInfo& info) {
   static jmethodID constructor =
       env->GetMethodID(connectionInfoCls, "<init>",
-                       "(Ljava/lang/String;Ljava/lang/String;IJI)V");
+                       "(Ljava/lang/String;Ljava/lang/String;IJIII)V");
   JLocal<jstring> remote_id{env, MakeJString(env, info.remote_id)};
   JLocal<jstring> remote_ip{env, MakeJString(env, info.remote_ip)};
   return env->NewObject(connectionInfoCls, constructor, remote_id.obj(),
                         remote_ip.obj(), (jint)info.remote_port,
-                        (jlong)info.last_update, (jint)info.protocol_version);
+                        (jlong)info.last_update, (jint)info.protocol_version,
+                        (jint)info.rtt, (jint)info.rtt_jitter);
 }
 
 static jobject MakeJObject(JNIEnv* env, jobject inst,
@@ -1632,6 +1635,18 @@ Java_edu_wpi_first_networktables_NetworkTablesJNI_setUpdateRate
   nt::SetUpdateRate(inst, interval);
 }
 
+/*
+ * Class:     edu_wpi_first_networktables_NetworkTablesJNI
+ * Method:    setConnectionTimeout
+ * Signature: (ID)V
+ */
+JNIEXPORT void JNICALL
+Java_edu_wpi_first_networktables_NetworkTablesJNI_setConnectionTimeout
+  (JNIEnv*, jclass, jint inst, jdouble timeout)
+{
+  nt::SetConnectionTimeout(inst, timeout);
+}
+
 /*
  * Class:     edu_wpi_first_networktables_NetworkTablesJNI
  * Method:    flush
@@ -1676,6 +1691,35 @@ Java_edu_wpi_first_networktables_NetworkTablesJNI_isConnected
   return nt::IsConnected(inst);
 }
 
+/*
+ * Class:     edu_wpi_first_networktables_NetworkTablesJNI
+ * Method:    getServerTimeOffset
+ * Signature: (I)Ljava/lang/Long;
+ */
+JNIEXPORT jobject JNICALL
+Java_edu_wpi_first_networktables_NetworkTablesJNI_getServerTimeOffset
+  (JNIEnv* env, jclass, jint inst)
+{
+  int64_t offset;
+  if (!nt::GetServerTimeOffset(inst, &offset)) return nullptr;
+  static jmethodID valueOf =
+      env->GetStaticMethodID(longCls, "valueOf", "(J)Ljava/lang/Long;");
+  return env->CallStaticObjectMethod(longCls, valueOf,
+                                     static_cast<jlong>(offset));
+}
+
+/*
+ * Class:     edu_wpi_first_networktables_NetworkTablesJNI
+ * Method:    setPublishTimestamps
+ * Signature: (IZ)V
+ */
+JNIEXPORT void JNICALL
+Java_edu_wpi_first_networktables_NetworkTablesJNI_setPublishTimestamps
+  (JNIEnv*, jclass, jint inst, jboolean enable)
+{
+  nt::SetPublishTimestamps(inst, enable);
+}
+
 /*
  * Class:     edu_wpi_first_networktables_NetworkTablesJNI
  * Method:    savePersistent
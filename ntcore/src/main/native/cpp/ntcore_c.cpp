@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -7,8 +7,10 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
 
 #include <wpi/MemAlloc.h>
 #include <wpi/timestamp.h>
@@ -26,6 +28,10 @@ static void ConvertToC(wpi::StringRef in, char** out) {
   (*out)[in.size()] = '\0';
 }
 
+static void ConvertToC(const std::shared_ptr<Value>& in, NT_Value* out) {
+  ConvertToC(*in, out);
+}
+
 static void ConvertToC(const EntryInfo& in, NT_EntryInfo* out) {
   out->entry = in.entry;
   ConvertToC(in.name, &out->name);
@@ -40,6 +46,8 @@ static void ConvertToC(const ConnectionInfo& in, NT_ConnectionInfo* out) {
   out->remote_port = in.remote_port;
   out->last_update = in.last_update;
   out->protocol_version = in.protocol_version;
+  out->rtt = in.rtt;
+  out->rtt_jitter = in.rtt_jitter;
 }
 
 static void ConvertToC(const RpcParamDef& in, NT_RpcParamDef* out) {
@@ -213,6 +221,30 @@ void NT_GetEntryValue(NT_Entry entry, struct NT_Value* value) {
   ConvertToC(*v, value);
 }
 
+size_t NT_GetEntryValueBuffer(NT_Entry entry, struct NT_Value* value,
+                              char* buf, size_t buf_len) {
+  NT_InitValue(value);
+  auto v = nt::GetEntryValue(entry);
+  if (!v) return 0;
+  return ConvertToC(*v, value, buf, buf_len);
+}
+
+size_t NT_GetEntryValuesBuffer(const NT_Entry* entries, size_t count,
+                               struct NT_Value* values, char* buf,
+                               size_t buf_len) {
+  size_t used = 0;
+  for (size_t i = 0; i < count; ++i) {
+    NT_InitValue(&values[i]);
+    auto v = nt::GetEntryValue(entries[i]);
+    if (!v) continue;
+    // keep each value's storage aligned as for double
+    used = (used + alignof(double) - 1) & ~(alignof(double) - 1);
+    used += ConvertToC(*v, &values[i], used <= buf_len ? buf + used : nullptr,
+                       used <= buf_len ? buf_len - used : 0);
+  }
+  return used;
+}
+
 int NT_SetDefaultEntryValue(NT_Entry entry,
                             const struct NT_Value* default_value) {
   return nt::SetDefaultEntryValue(entry, ConvertFromC(*default_value));
@@ -236,6 +268,22 @@ unsigned int NT_GetEntryFlags(NT_Entry entry) {
 
 void NT_DeleteEntry(NT_Entry entry) { nt::DeleteEntry(entry); }
 
+void NT_SetEntryHistory(NT_Inst inst, const char* prefix, size_t prefix_len,
+                        unsigned int size) {
+  nt::SetEntryHistory(inst, StringRef(prefix, prefix_len), size);
+}
+
+struct NT_Value* NT_FetchEntryHistory(NT_Entry entry, uint64_t start,
+                                      uint64_t end, double timeout,
+                                      size_t* count) {
+  std::vector<std::shared_ptr<Value>> values;
+  if (!nt::FetchEntryHistory(entry, start, end, timeout, &values)) {
+    *count = 0;
+    return nullptr;
+  }
+  return ConvertToC<NT_Value>(values, count);
+}
+
 void NT_DeleteAllEntries(NT_Inst inst) { nt::DeleteAllEntries(inst); }
 
 struct NT_EntryInfo* NT_GetEntryInfo(NT_Inst inst, const char* prefix,
@@ -602,6 +650,24 @@ void NT_Flush(NT_Inst inst) { nt::Flush(inst); }
 
 NT_Bool NT_IsConnected(NT_Inst inst) { return nt::IsConnected(inst); }
 
+NT_Bool NT_GetServerTimeOffset(NT_Inst inst, int64_t* offset) {
+  return nt::GetServerTimeOffset(inst, offset);
+}
+
+void NT_SetPublishTimestamps(NT_Inst inst, NT_Bool enable) {
+  nt::SetPublishTimestamps(inst, enable);
+}
+
+void NT_SetConnectionTimeout(NT_Inst inst, double timeout) {
+  nt::SetConnectionTimeout(inst, timeout);
+}
+
+NT_Bool NT_StartCapture(NT_Inst inst, const char* filename) {
+  return nt::StartCapture(inst, filename);
+}
+
+void NT_StopCapture(NT_Inst inst) { nt::StopCapture(inst); }
+
 struct NT_ConnectionInfo* NT_GetConnections(NT_Inst inst, size_t* count) {
   auto conn_v = nt::GetConnections(inst);
   return ConvertToC<NT_ConnectionInfo>(conn_v, count);
@@ -715,6 +781,11 @@ void NT_DisposeValue(NT_Value* value) {
   value->last_change = 0;
 }
 
+void NT_DisposeValueArray(NT_Value* arr, size_t count) {
+  for (size_t i = 0; i < count; i++) NT_DisposeValue(&arr[i]);
+  std::free(arr);
+}
+
 void NT_InitValue(NT_Value* value) {
   value->type = NT_UNASSIGNED;
   value->last_change = 0;
@@ -1137,4 +1208,64 @@ NT_String* NT_GetEntryStringArray(NT_Entry entry, uint64_t* last_change,
   return arr;
 }
 
+NT_Bool NT_GetEntryStringBuffer(NT_Entry entry, uint64_t* last_change,
+                                char* buf, size_t* str_len) {
+  auto v = nt::GetEntryValue(entry);
+  if (!v || !v->IsString()) {
+    *str_len = 0;
+    return 0;
+  }
+  *last_change = v->last_change();
+  auto str = v->GetString();
+  bool fits = str.size() <= *str_len;
+  if (fits) std::memcpy(buf, str.data(), str.size());
+  *str_len = str.size();
+  return fits;
+}
+
+NT_Bool NT_GetEntryRawBuffer(NT_Entry entry, uint64_t* last_change, char* buf,
+                             size_t* raw_len) {
+  auto v = nt::GetEntryValue(entry);
+  if (!v || !v->IsRaw()) {
+    *raw_len = 0;
+    return 0;
+  }
+  *last_change = v->last_change();
+  auto raw = v->GetRaw();
+  bool fits = raw.size() <= *raw_len;
+  if (fits) std::memcpy(buf, raw.data(), raw.size());
+  *raw_len = raw.size();
+  return fits;
+}
+
+NT_Bool NT_GetEntryBooleanArrayBuffer(NT_Entry entry, uint64_t* last_change,
+                                      NT_Bool* arr, size_t* arr_size) {
+  auto v = nt::GetEntryValue(entry);
+  if (!v || !v->IsBooleanArray()) {
+    *arr_size = 0;
+    return 0;
+  }
+  *last_change = v->last_change();
+  auto vArr = v->GetBooleanArray();
+  bool fits = vArr.size() <= *arr_size;
+  if (fits) std::copy(vArr.begin(), vArr.end(), arr);
+  *arr_size = vArr.size();
+  return fits;
+}
+
+NT_Bool NT_GetEntryDoubleArrayBuffer(NT_Entry entry, uint64_t* last_change,
+                                     double* arr, size_t* arr_size) {
+  auto v = nt::GetEntryValue(entry);
+  if (!v || !v->IsDoubleArray()) {
+    *arr_size = 0;
+    return 0;
+  }
+  *last_change = v->last_change();
+  auto vArr = v->GetDoubleArray();
+  bool fits = vArr.size() <= *arr_size;
+  if (fits) std::copy(vArr.begin(), vArr.end(), arr);
+  *arr_size = vArr.size();
+  return fits;
+}
+
 }  // extern "C"
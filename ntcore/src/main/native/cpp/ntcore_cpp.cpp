@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -180,6 +180,24 @@ unsigned int GetEntryFlags(NT_Entry entry) {
   return ii->storage.GetEntryFlags(id);
 }
 
+void SetEntryHistory(NT_Inst inst, const Twine& prefix, unsigned int size) {
+  auto ii = InstanceImpl::Get(Handle{inst}.GetTypedInst(Handle::kInstance));
+  if (!ii) return;
+
+  ii->storage.SetEntryHistory(prefix, size);
+}
+
+bool FetchEntryHistory(NT_Entry entry, uint64_t start, uint64_t end,
+                       double timeout,
+                       std::vector<std::shared_ptr<Value>>* values) {
+  Handle handle{entry};
+  int id = handle.GetTypedIndex(Handle::kEntry);
+  auto ii = InstanceImpl::Get(handle.GetInst());
+  if (id < 0 || !ii) return false;
+
+  return ii->storage.FetchEntryHistory(id, start, end, timeout, values);
+}
+
 void DeleteEntry(StringRef name) {
   InstanceImpl::GetDefault()->storage.DeleteEntry(name);
 }
@@ -922,6 +940,41 @@ bool IsConnected(NT_Inst inst) {
   return ii->dispatcher.IsConnected();
 }
 
+bool GetServerTimeOffset(NT_Inst inst, int64_t* offset) {
+  auto ii = InstanceImpl::Get(Handle{inst}.GetTypedInst(Handle::kInstance));
+  if (!ii) return false;
+
+  return ii->dispatcher.GetServerTimeOffset(offset);
+}
+
+void SetPublishTimestamps(NT_Inst inst, bool enable) {
+  auto ii = InstanceImpl::Get(Handle{inst}.GetTypedInst(Handle::kInstance));
+  if (!ii) return;
+
+  ii->dispatcher.SetPublishTimestamps(enable);
+}
+
+void SetConnectionTimeout(NT_Inst inst, double timeout) {
+  auto ii = InstanceImpl::Get(Handle{inst}.GetTypedInst(Handle::kInstance));
+  if (!ii) return;
+
+  ii->dispatcher.SetConnectionTimeout(timeout);
+}
+
+bool StartCapture(NT_Inst inst, const Twine& filename) {
+  auto ii = InstanceImpl::Get(Handle{inst}.GetTypedInst(Handle::kInstance));
+  if (!ii) return false;
+
+  return ii->dispatcher.StartCapture(filename);
+}
+
+void StopCapture(NT_Inst inst) {
+  auto ii = InstanceImpl::Get(Handle{inst}.GetTypedInst(Handle::kInstance));
+  if (!ii) return;
+
+  ii->dispatcher.StopCapture();
+}
+
 /*
  * Persistent Functions
  */
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2017-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2017-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -577,6 +577,22 @@ class NetworkTableEntry final {
    */
   void Delete();
 
+  /**
+   * Fetches the recent values of the entry (see
+   * NetworkTableInstance::SetEntryHistory()).  On a client, this requests
+   * the history from the server and blocks until it arrives.
+   *
+   * @param start earliest value time to return (same scale as nt::Now())
+   * @param end latest value time to return (UINT64_MAX for no limit)
+   * @param timeout how long to wait for the server, in seconds
+   * @param values values, oldest first (output)
+   * @return False if no history is kept, the client isn't connected to a
+   *         protocol 3.1 server, the connection was lost, or the request
+   *         timed out.
+   */
+  bool FetchHistory(uint64_t start, uint64_t end, double timeout,
+                    std::vector<std::shared_ptr<Value>>* values) const;
+
   /**
    * Create a callback-based RPC entry point.  Only valid to use on the server.
    * The callback function will be called when the RPC is called.
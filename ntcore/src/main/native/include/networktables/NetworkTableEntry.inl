@@ -274,6 +274,12 @@ inline bool NetworkTableEntry::IsPersistent() const {
 
 inline void NetworkTableEntry::Delete() { DeleteEntry(m_handle); }
 
+inline bool NetworkTableEntry::FetchHistory(
+    uint64_t start, uint64_t end, double timeout,
+    std::vector<std::shared_ptr<Value>>* values) const {
+  return FetchEntryHistory(m_handle, start, end, timeout, values);
+}
+
 inline void NetworkTableEntry::CreateRpc(
     std::function<void(const RpcAnswer& answer)> callback) {
   ::nt::CreateRpc(m_handle, StringRef("\0", 1), callback);
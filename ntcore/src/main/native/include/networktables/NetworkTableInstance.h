@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2017-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2017-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -168,6 +168,16 @@ class NetworkTableInstance final {
   std::vector<EntryInfo> GetEntryInfo(const Twine& prefix,
                                       unsigned int types) const;
 
+  /**
+   * Keep a history of recent values for entries whose names start with the
+   * given prefix, so clients can fetch it with
+   * NetworkTableEntry::FetchHistory().  Normally called on the server.
+   *
+   * @param prefix entry name prefix
+   * @param size number of values to keep per entry (0 to keep none)
+   */
+  void SetEntryHistory(const Twine& prefix, unsigned int size);
+
   /**
    * Gets the table with the specified key.
    *
@@ -454,6 +464,51 @@ class NetworkTableInstance final {
    */
   bool IsConnected() const;
 
+  /**
+   * Get the offset of the server clock from the local clock.  Adding the
+   * offset to a local timestamp gives the corresponding server time.
+   *
+   * @param offset server time minus local time, in microseconds (output)
+   * @return False if not connected or the clocks are not yet synchronized.
+   */
+  bool GetServerTimeOffset(int64_t* offset) const;
+
+  /**
+   * Send value timestamps along with updates, so receivers see the time a
+   * value was set by its publisher instead of the time it arrived.
+   *
+   * @param enable true to send timestamps
+   */
+  void SetPublishTimestamps(bool enable);
+
+  /**
+   * Set the dead peer timeout.  Connections using protocol 3.1 exchange
+   * heartbeats in both directions, and a connection that has received
+   * nothing from its peer for this long is closed.
+   *
+   * Dead peer detection is opt-in: the timeout is 0 (disabled) until this is
+   * called, so by default a peer that stops responding without closing the
+   * connection is only noticed when TCP gives up.  A few seconds is a
+   * reasonable value on a robot network.
+   *
+   * @param timeout timeout in seconds (0 to disable)
+   */
+  void SetConnectionTimeout(double timeout);
+
+  /**
+   * Start capturing network traffic to a file, for playback with the
+   * ntreplay tool.
+   *
+   * @param filename capture file name
+   * @return False if the file could not be opened.
+   */
+  bool StartCapture(const Twine& filename);
+
+  /**
+   * Stop capturing network traffic.
+   */
+  void StopCapture();
+
   /** @} */
 
   /**
@@ -41,6 +41,11 @@ inline std::vector<NetworkTableEntry> NetworkTableInstance::GetEntries(
   return entries;
 }
 
+inline void NetworkTableInstance::SetEntryHistory(const Twine& prefix,
+                                                  unsigned int size) {
+  ::nt::SetEntryHistory(m_handle, prefix, size);
+}
+
 inline std::vector<EntryInfo> NetworkTableInstance::GetEntryInfo(
     const Twine& prefix, unsigned int types) const {
   return ::nt::GetEntryInfo(m_handle, prefix, types);
@@ -150,6 +155,26 @@ inline bool NetworkTableInstance::IsConnected() const {
   return ::nt::IsConnected(m_handle);
 }
 
+inline bool NetworkTableInstance::GetServerTimeOffset(int64_t* offset) const {
+  return ::nt::GetServerTimeOffset(m_handle, offset);
+}
+
+inline void NetworkTableInstance::SetPublishTimestamps(bool enable) {
+  ::nt::SetPublishTimestamps(m_handle, enable);
+}
+
+inline void NetworkTableInstance::SetConnectionTimeout(double timeout) {
+  ::nt::SetConnectionTimeout(m_handle, timeout);
+}
+
+inline bool NetworkTableInstance::StartCapture(const Twine& filename) {
+  return ::nt::StartCapture(m_handle, filename);
+}
+
+inline void NetworkTableInstance::StopCapture() {
+  ::nt::StopCapture(m_handle);
+}
+
 inline const char* NetworkTableInstance::SavePersistent(
     const Twine& filename) const {
   return ::nt::SavePersistent(m_handle, filename);
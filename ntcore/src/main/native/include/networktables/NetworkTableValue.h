@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -172,7 +172,7 @@ class Value final {
    */
   StringRef GetString() const {
     assert(m_val.type == NT_STRING);
-    return m_string;
+    return StringRef(m_val.data.v_string.str, m_val.data.v_string.len);
   }
 
   /**
@@ -182,7 +182,7 @@ class Value final {
    */
   StringRef GetRaw() const {
     assert(m_val.type == NT_RAW);
-    return m_string;
+    return StringRef(m_val.data.v_raw.str, m_val.data.v_raw.len);
   }
 
   /**
@@ -192,7 +192,7 @@ class Value final {
    */
   StringRef GetRpc() const {
     assert(m_val.type == NT_RPC);
-    return m_string;
+    return StringRef(m_val.data.v_raw.str, m_val.data.v_raw.len);
   }
 
   /**
@@ -224,7 +224,11 @@ class Value final {
    */
   ArrayRef<std::string> GetStringArray() const {
     assert(m_val.type == NT_STRING_ARRAY);
-    return m_string_array;
+    // the strings follow the NT_String array in the same allocation
+    return ArrayRef<std::string>(
+        reinterpret_cast<const std::string*>(m_val.data.arr_string.arr +
+                                             m_val.data.arr_string.size),
+        m_val.data.arr_string.size);
   }
 
   /** @} */
@@ -271,13 +275,7 @@ class Value final {
    * @return The entry value
    */
   static std::shared_ptr<Value> MakeString(const Twine& value,
-                                           uint64_t time = 0) {
-    auto val = std::make_shared<Value>(NT_STRING, time, private_init());
-    val->m_string = value.str();
-    val->m_val.data.v_string.str = const_cast<char*>(val->m_string.c_str());
-    val->m_val.data.v_string.len = val->m_string.size();
-    return val;
-  }
+                                           uint64_t time = 0);
 
   /**
    * Creates a string entry value.
@@ -287,13 +285,11 @@ class Value final {
    *             time)
    * @return The entry value
    */
-  template <typename T,
-            typename std::enable_if<std::is_same<T, std::string>::value>::type>
+  template <typename T, typename = typename std::enable_if<
+                            std::is_same<T, std::string>::value>::type>
   static std::shared_ptr<Value> MakeString(T&& value, uint64_t time = 0) {
     auto val = std::make_shared<Value>(NT_STRING, time, private_init());
-    val->m_string = std::move(value);
-    val->m_val.data.v_string.str = const_cast<char*>(val->m_string.c_str());
-    val->m_val.data.v_string.len = val->m_string.size();
+    val->TakeString(std::move(value));
     return val;
   }
 
@@ -307,9 +303,7 @@ class Value final {
    */
   static std::shared_ptr<Value> MakeRaw(StringRef value, uint64_t time = 0) {
     auto val = std::make_shared<Value>(NT_RAW, time, private_init());
-    val->m_string = value;
-    val->m_val.data.v_raw.str = const_cast<char*>(val->m_string.c_str());
-    val->m_val.data.v_raw.len = val->m_string.size();
+    val->SetString(value);
     return val;
   }
 
@@ -321,13 +315,11 @@ class Value final {
    *             time)
    * @return The entry value
    */
-  template <typename T,
-            typename std::enable_if<std::is_same<T, std::string>::value>::type>
+  template <typename T, typename = typename std::enable_if<
+                            std::is_same<T, std::string>::value>::type>
   static std::shared_ptr<Value> MakeRaw(T&& value, uint64_t time = 0) {
     auto val = std::make_shared<Value>(NT_RAW, time, private_init());
-    val->m_string = std::move(value);
-    val->m_val.data.v_raw.str = const_cast<char*>(val->m_string.c_str());
-    val->m_val.data.v_raw.len = val->m_string.size();
+    val->TakeString(std::move(value));
     return val;
   }
 
@@ -341,9 +333,7 @@ class Value final {
    */
   static std::shared_ptr<Value> MakeRpc(StringRef value, uint64_t time = 0) {
     auto val = std::make_shared<Value>(NT_RPC, time, private_init());
-    val->m_string = value;
-    val->m_val.data.v_raw.str = const_cast<char*>(val->m_string.c_str());
-    val->m_val.data.v_raw.len = val->m_string.size();
+    val->SetString(value);
     return val;
   }
 
@@ -358,9 +348,7 @@ class Value final {
   template <typename T>
   static std::shared_ptr<Value> MakeRpc(T&& value, uint64_t time = 0) {
     auto val = std::make_shared<Value>(NT_RPC, time, private_init());
-    val->m_string = std::move(value);
-    val->m_val.data.v_raw.str = const_cast<char*>(val->m_string.c_str());
-    val->m_val.data.v_raw.len = val->m_string.size();
+    val->TakeString(std::move(value));
     return val;
   }
 
@@ -482,9 +470,24 @@ class Value final {
   friend bool operator==(const Value& lhs, const Value& rhs);
 
  private:
+  // Copies str into a buffer owned by m_val.
+  void SetString(StringRef str);
+
+  // Takes ownership of str and points m_val at its contents, so moved-in
+  // strings and raw data aren't copied.
+  void TakeString(std::string str);
+
+  // Moves strings into a single buffer owned by m_val that holds the NT_String
+  // array followed by the std::string objects it points into.
+  template <typename It>
+  void SetStringArray(It first, size_t size);
+
+  // All value data lives in (or is owned through) the C value, so each type
+  // is stored exactly once.
   NT_Value m_val;
-  std::string m_string;
-  std::vector<std::string> m_string_array;
+
+  // Owns the contents of m_val for strings set by TakeString().
+  std::unique_ptr<std::string> m_string;
 };
 
 bool operator==(const Value& lhs, const Value& rhs);
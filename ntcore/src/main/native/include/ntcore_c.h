@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -186,6 +186,17 @@ struct NT_ConnectionInfo {
    * layer format, so 0x0200 = 2.0, 0x0300 = 3.0).
    */
   unsigned int protocol_version;
+
+  /**
+   * The most recently measured round trip time to the remote node, in
+   * microseconds.  Only measured with protocol 3.1; 0 if not known.
+   */
+  unsigned int rtt;
+
+  /**
+   * The smoothed variation of the round trip time, in microseconds.
+   */
+  unsigned int rtt_jitter;
 };
 
 /** NetworkTables RPC Version 1 Definition Parameter */
@@ -382,6 +393,50 @@ uint64_t NT_GetEntryLastChange(NT_Entry entry);
  */
 void NT_GetEntryValue(NT_Entry entry, struct NT_Value* value);
 
+/**
+ * Get Entry Value into a caller-provided buffer.
+ *
+ * Like NT_GetEntryValue(), but strings and arrays are stored in buf instead
+ * of being allocated, so reading a value doesn't touch the heap. The buffer
+ * must be aligned as for a double (e.g. allocated with malloc()).
+ *
+ * @param entry     entry handle
+ * @param value     storage for returned entry value
+ * @param buf       buffer for string and array contents
+ * @param buf_len   length of buf in bytes
+ * @return          Number of buffer bytes needed. If this is greater than
+ *                  buf_len, value is left unassigned and the call should be
+ *                  retried with a larger buffer.
+ *
+ * The returned value points into buf, so it's only valid as long as buf is,
+ * and must not be passed to NT_DisposeValue().
+ */
+size_t NT_GetEntryValueBuffer(NT_Entry entry, struct NT_Value* value,
+                              char* buf, size_t buf_len);
+
+/**
+ * Get Multiple Entry Values into a caller-provided buffer.
+ *
+ * Reads the values of several entries at once, storing all of their strings
+ * and arrays contiguously in buf. The buffer must be aligned as for a double.
+ * Unassigned entries result in unassigned values.
+ *
+ * @param entries   array of entry handles
+ * @param count     number of elements in entries (and values)
+ * @param values    storage for returned entry values
+ * @param buf       buffer for string and array contents
+ * @param buf_len   length of buf in bytes
+ * @return          Number of buffer bytes needed for all of the values. If
+ *                  this is greater than buf_len, the values that didn't fit
+ *                  are left unassigned.
+ *
+ * The returned values point into buf, so they are only valid as long as buf
+ * is, and must not be passed to NT_DisposeValue().
+ */
+size_t NT_GetEntryValuesBuffer(const NT_Entry* entries, size_t count,
+                               struct NT_Value* values, char* buf,
+                               size_t buf_len);
+
 /**
  * Set Default Entry Value.
  *
@@ -439,6 +494,39 @@ void NT_SetEntryFlags(NT_Entry entry, unsigned int flags);
  */
 unsigned int NT_GetEntryFlags(NT_Entry entry);
 
+/**
+ * Keep a history of recent values for entries whose names start with a
+ * prefix.  Normally called on the server.
+ *
+ * @param inst        instance handle
+ * @param prefix      entry name prefix
+ * @param prefix_len  length of prefix in bytes
+ * @param size        number of values to keep per entry (0 to keep none)
+ */
+void NT_SetEntryHistory(NT_Inst inst, const char* prefix, size_t prefix_len,
+                        unsigned int size);
+
+/**
+ * Fetch the recent values of an entry, oldest first.  On a client, this
+ * requests the history from the server and blocks until it arrives.
+ *
+ * It is the caller's responsibility to free the array.  The
+ * NT_DisposeValueArray function is useful for this purpose.
+ *
+ * @param entry    entry handle
+ * @param start    earliest value time to return
+ * @param end      latest value time to return (UINT64_MAX for no limit)
+ * @param timeout  how long to wait for the server, in seconds (negative to
+ *                 wait forever)
+ * @param count    number of values returned (output)
+ * @return Array of values, or NULL if there were none, no history is kept,
+ *         the client isn't connected to a protocol 3.1 server, the connection
+ *         was lost, or the request timed out.
+ */
+struct NT_Value* NT_FetchEntryHistory(NT_Entry entry, uint64_t start,
+                                      uint64_t end, double timeout,
+                                      size_t* count);
+
 /**
  * Delete Entry.
  *
@@ -1210,6 +1298,55 @@ struct NT_ConnectionInfo* NT_GetConnections(NT_Inst inst, size_t* count);
  */
 NT_Bool NT_IsConnected(NT_Inst inst);
 
+/**
+ * Get the offset of the server clock from the local clock, as estimated by
+ * periodic time synchronization with the server.  A server always reports
+ * an offset of 0.
+ *
+ * @param inst    instance handle
+ * @param offset  server time minus local time, in microseconds (output)
+ * @return False if not connected or the clocks are not yet synchronized.
+ */
+NT_Bool NT_GetServerTimeOffset(NT_Inst inst, int64_t* offset);
+
+/**
+ * Send value timestamps (in the server's timebase) along with updates.
+ *
+ * @param inst    instance handle
+ * @param enable  true to send timestamps
+ */
+void NT_SetPublishTimestamps(NT_Inst inst, NT_Bool enable);
+
+/**
+ * Set the dead peer timeout for protocol 3.1 connections.  A connection that
+ * has received nothing from its peer for this long is closed.
+ *
+ * Dead peer detection is opt-in: the timeout is 0 (disabled) until this is
+ * called, so by default a peer that stops responding without closing the
+ * connection is only noticed when TCP gives up.  A few seconds is a
+ * reasonable value on a robot network.
+ *
+ * @param inst     instance handle
+ * @param timeout  timeout in seconds (0 to disable)
+ */
+void NT_SetConnectionTimeout(NT_Inst inst, double timeout);
+
+/**
+ * Start capturing network traffic to a file.
+ *
+ * @param inst      instance handle
+ * @param filename  capture file name
+ * @return 0 if the file could not be opened.
+ */
+NT_Bool NT_StartCapture(NT_Inst inst, const char* filename);
+
+/**
+ * Stop capturing network traffic.
+ *
+ * @param inst  instance handle
+ */
+void NT_StopCapture(NT_Inst inst);
+
 /** @} */
 
 /**
@@ -1283,6 +1420,14 @@ const char* NT_LoadEntries(NT_Inst inst, const char* filename,
  */
 void NT_DisposeValue(struct NT_Value* value);
 
+/**
+ * Disposes an array of values (as returned by NT_FetchEntryHistory()).
+ *
+ * @param arr   pointer to the array to dispose
+ * @param count number of elements in the array
+ */
+void NT_DisposeValueArray(struct NT_Value* arr, size_t count);
+
 /**
  * Initializes a NT_Value.
  * Sets type to NT_UNASSIGNED and clears rest of struct.
@@ -1864,6 +2009,68 @@ double* NT_GetEntryDoubleArray(NT_Entry entry, uint64_t* last_change,
 struct NT_String* NT_GetEntryStringArray(NT_Entry entry, uint64_t* last_change,
                                          size_t* arr_size);
 
+/**
+ * Copies the string assigned to the entry name into a caller-provided buffer.
+ * The copy is not zero-terminated.
+ *
+ * @param entry       entry handle
+ * @param last_change returns time in ms since the last change in the value
+ * @param buf         buffer for the string
+ * @param str_len     on input, the length of buf; on output, the length of
+ *                    the string (0 if the entry is not a string)
+ * @return            1 if successful, or 0 if value is unassigned, not a
+ *                    string, or longer than buf
+ */
+NT_Bool NT_GetEntryStringBuffer(NT_Entry entry, uint64_t* last_change,
+                                char* buf, size_t* str_len);
+
+/**
+ * Copies the raw value assigned to the entry name into a caller-provided
+ * buffer.
+ *
+ * @param entry       entry handle
+ * @param last_change returns time in ms since the last change in the value
+ * @param buf         buffer for the raw value
+ * @param raw_len     on input, the length of buf; on output, the length of
+ *                    the raw value (0 if the entry is not a raw value)
+ * @return            1 if successful, or 0 if value is unassigned, not a raw
+ *                    value, or longer than buf
+ */
+NT_Bool NT_GetEntryRawBuffer(NT_Entry entry, uint64_t* last_change, char* buf,
+                             size_t* raw_len);
+
+/**
+ * Copies the boolean array assigned to the entry name into a caller-provided
+ * array.
+ *
+ * @param entry       entry handle
+ * @param last_change returns time in ms since the last change in the value
+ * @param arr         array for the elements
+ * @param arr_size    on input, the number of elements arr can hold; on output,
+ *                    the number of elements in the value (0 if the entry is
+ *                    not a boolean array)
+ * @return            1 if successful, or 0 if value is unassigned, not a
+ *                    boolean array, or larger than arr
+ */
+NT_Bool NT_GetEntryBooleanArrayBuffer(NT_Entry entry, uint64_t* last_change,
+                                      NT_Bool* arr, size_t* arr_size);
+
+/**
+ * Copies the double array assigned to the entry name into a caller-provided
+ * array.
+ *
+ * @param entry       entry handle
+ * @param last_change returns time in ms since the last change in the value
+ * @param arr         array for the elements
+ * @param arr_size    on input, the number of elements arr can hold; on output,
+ *                    the number of elements in the value (0 if the entry is
+ *                    not a double array)
+ * @return            1 if successful, or 0 if value is unassigned, not a
+ *                    double array, or larger than arr
+ */
+NT_Bool NT_GetEntryDoubleArrayBuffer(NT_Entry entry, uint64_t* last_change,
+                                     double* arr, size_t* arr_size);
+
 /** @} */
 
 /**
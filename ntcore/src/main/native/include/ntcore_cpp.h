@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -93,6 +93,17 @@ struct ConnectionInfo {
    */
   unsigned int protocol_version{0};
 
+  /**
+   * The most recently measured round trip time to the remote node, in
+   * microseconds.  Only measured with protocol 3.1; 0 if not known.
+   */
+  unsigned int rtt{0};
+
+  /**
+   * The smoothed variation of the round trip time, in microseconds.
+   */
+  unsigned int rtt_jitter{0};
+
   friend void swap(ConnectionInfo& first, ConnectionInfo& second) {
     using std::swap;
     swap(first.remote_id, second.remote_id);
@@ -100,6 +111,8 @@ struct ConnectionInfo {
     swap(first.remote_port, second.remote_port);
     swap(first.last_update, second.last_update);
     swap(first.protocol_version, second.protocol_version);
+    swap(first.rtt, second.rtt);
+    swap(first.rtt_jitter, second.rtt_jitter);
   }
 };
 
@@ -546,6 +559,37 @@ void DeleteEntry(StringRef name);
  */
 void DeleteEntry(NT_Entry entry);
 
+/**
+ * Keep a history of recent values for entries whose names start with a
+ * prefix.  Histories are kept by the node that values are set on, so this is
+ * normally called on the server; clients fetch histories from the server
+ * with FetchEntryHistory().  If several prefixes match an entry, the longest
+ * one applies.
+ *
+ * @param inst      instance handle
+ * @param prefix    entry name prefix
+ * @param size      number of values to keep per entry (0 to keep none)
+ */
+void SetEntryHistory(NT_Inst inst, const Twine& prefix, unsigned int size);
+
+/**
+ * Fetch the recent values of an entry.  On a client, this requests the
+ * history from the server (protocol 3.1 only) and blocks until it arrives.
+ *
+ * @param entry     entry handle
+ * @param start     earliest value time to return (same scale as nt::Now())
+ * @param end       latest value time to return (UINT64_MAX for no limit)
+ * @param timeout   how long to wait for the server, in seconds (negative
+ *                  to wait forever)
+ * @param values    values, oldest first (output)
+ * @return False if no history is kept for the entry, the client isn't
+ *         connected to a protocol 3.1 server, the connection was lost, or
+ *         the request timed out.
+ */
+bool FetchEntryHistory(NT_Entry entry, uint64_t start, uint64_t end,
+                       double timeout,
+                       std::vector<std::shared_ptr<Value>>* values);
+
 /**
  * Delete All Entries.
  *
@@ -1380,6 +1424,66 @@ std::vector<ConnectionInfo> GetConnections(NT_Inst inst);
  */
 bool IsConnected(NT_Inst inst);
 
+/**
+ * Get the offset of the server clock from the local clock, as estimated by
+ * periodic time synchronization with the server.  Adding the offset to a
+ * local timestamp (e.g. from Now()) gives the corresponding server time.
+ * A server always reports an offset of 0.
+ *
+ * @param inst    instance handle
+ * @param offset  server time minus local time, in microseconds (output)
+ * @return False if not connected or the clocks are not yet synchronized.
+ */
+bool GetServerTimeOffset(NT_Inst inst, int64_t* offset);
+
+/**
+ * Send value timestamps along with updates, so receivers see the time a
+ * value was set by its publisher instead of the time it arrived.
+ * Timestamps are sent in the server's timebase and converted back to the
+ * receiver's local timebase.  Requires protocol 3.1 on both ends; a server
+ * must also enable this to forward publisher timestamps to other clients.
+ *
+ * @param inst    instance handle
+ * @param enable  true to send timestamps
+ */
+void SetPublishTimestamps(NT_Inst inst, bool enable);
+
+/**
+ * Set the dead peer timeout.  Connections using protocol 3.1 exchange
+ * heartbeats in both directions, and a connection that has received
+ * nothing from its peer for this long is closed (and a client reconnects).
+ * The timeout is never shorter than three update intervals (see
+ * SetUpdateRate()).
+ *
+ * Dead peer detection is opt-in: the timeout is 0 (disabled) until this is
+ * called, so by default a peer that stops responding without closing the
+ * connection is only noticed when TCP gives up.  A few seconds is a
+ * reasonable value on a robot network.
+ *
+ * @param inst     instance handle
+ * @param timeout  timeout in seconds (0 to disable)
+ */
+void SetConnectionTimeout(NT_Inst inst, double timeout);
+
+/**
+ * Start capturing network traffic to a file.  Every message sent or received
+ * on any connection is recorded along with the time and the connection it
+ * was on, replacing any capture already in progress.  The ntreplay tool plays
+ * captures back against real peers.
+ *
+ * @param inst      instance handle
+ * @param filename  capture file name
+ * @return False if the file could not be opened.
+ */
+bool StartCapture(NT_Inst inst, const Twine& filename);
+
+/**
+ * Stop capturing network traffic and close the capture file.
+ *
+ * @param inst  instance handle
+ */
+void StopCapture(NT_Inst inst);
+
 /** @} */
 
 /**
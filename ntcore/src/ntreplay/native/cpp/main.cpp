@@ -0,0 +1,214 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+#include <wpi/DenseMap.h>
+#include <wpi/Format.h>
+#include <wpi/Logger.h>
+#include <wpi/StringRef.h>
+#include <wpi/raw_istream.h>
+#include <wpi/raw_ostream.h>
+
+#include "Capture.h"
+#include "Message.h"
+#include "ntcore.h"
+
+namespace {
+
+struct Options {
+  std::string server;  // empty to run as a server
+  unsigned int port = NT_DEFAULT_PORT;
+  double speed = 1.0;  // 0 for as fast as possible
+  int conn = -1;       // -1 for the first connection in the capture
+  bool received = false;
+  bool loop = false;
+};
+
+class Replayer {
+ public:
+  Replayer(NT_Inst inst, const Options& options)
+      : m_inst(inst), m_options(options) {}
+
+  // Plays the capture back once.  Returns false on a read error.
+  bool Play(const char* filename);
+
+ private:
+  void Apply(const nt::Message& msg);
+
+  NT_Inst m_inst;
+  const Options& m_options;
+  // entry names by id, as assigned in the capture
+  wpi::DenseMap<unsigned int, std::string> m_names;
+};
+
+}  // namespace
+
+bool Replayer::Play(const char* filename) {
+  std::error_code ec;
+  wpi::raw_fd_istream is(filename, ec);
+  if (ec.value() != 0) {
+    wpi::errs() << "could not open '" << filename << "'\n";
+    return false;
+  }
+  wpi::Logger logger;
+  nt::CaptureReader reader(is, logger);
+  if (!reader.ReadHeader()) {
+    wpi::errs() << "'" << filename << "' is not a capture file\n";
+    return false;
+  }
+
+  m_names.clear();
+  int conn = m_options.conn;
+  uint64_t first = 0;
+  size_t applied = 0;
+  auto start = std::chrono::steady_clock::now();
+  nt::CaptureReader::Record rec;
+  while (reader.Read(&rec)) {
+    if (conn < 0) conn = rec.conn;
+    if (static_cast<int>(rec.conn) != conn) continue;
+
+    // learn ids from assignments in both directions; a client only learns
+    // the ids of the entries it creates from the server's response
+    if (rec.msg->Is(nt::Message::kEntryAssign) && rec.msg->id() != 0xffff)
+      m_names[rec.msg->id()] = rec.msg->str();
+
+    // the side being replayed sent outgoing messages, unless replaying what
+    // it received instead
+    if (rec.outgoing == m_options.received) continue;
+
+    if (first == 0) first = rec.time;
+    if (m_options.speed > 0) {
+      std::this_thread::sleep_until(
+          start + std::chrono::microseconds(static_cast<int64_t>(
+                      (rec.time - first) / m_options.speed)));
+    }
+    Apply(*rec.msg);
+    ++applied;
+  }
+  nt::Flush(m_inst);
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  if (reader.error()) wpi::errs() << "read error: " << reader.error() << '\n';
+  wpi::outs() << "replayed " << applied << " messages in "
+              << wpi::format("%.3f", elapsed.count()) << " s ("
+              << wpi::format("%.0f", applied / elapsed.count())
+              << " messages/s)\n";
+  wpi::outs().flush();
+  return !reader.error();
+}
+
+void Replayer::Apply(const nt::Message& msg) {
+  switch (msg.type()) {
+    case nt::Message::kEntryAssign: {
+      auto entry = nt::GetEntry(m_inst, msg.str());
+      nt::SetEntryTypeValue(entry, msg.value());
+      nt::SetEntryFlags(entry, msg.flags());
+      break;
+    }
+    case nt::Message::kEntryUpdate: {
+      auto it = m_names.find(msg.id());
+      if (it == m_names.end()) break;
+      nt::SetEntryTypeValue(nt::GetEntry(m_inst, it->second), msg.value());
+      break;
+    }
+    case nt::Message::kFlagsUpdate: {
+      auto it = m_names.find(msg.id());
+      if (it == m_names.end()) break;
+      nt::SetEntryFlags(nt::GetEntry(m_inst, it->second), msg.flags());
+      break;
+    }
+    case nt::Message::kEntryDelete: {
+      auto it = m_names.find(msg.id());
+      if (it == m_names.end()) break;
+      nt::DeleteEntry(nt::GetEntry(m_inst, it->second));
+      m_names.erase(it);
+      break;
+    }
+    case nt::Message::kClearEntries:
+      nt::DeleteAllEntries(m_inst);
+      break;
+    default:
+      // handshakes, keep alives and RPCs aren't replayed
+      break;
+  }
+}
+
+int main(int argc, char* argv[]) {
+  // parse arguments
+  Options options;
+  int arg = 1;
+  bool err = false;
+
+  while (arg < argc && argv[arg][0] == '-') {
+    wpi::StringRef opt(argv[arg]);
+    if (opt == "-r") {
+      options.received = true;
+    } else if (opt == "-l") {
+      options.loop = true;
+    } else if (arg + 1 < argc &&
+               (opt == "-c" || opt == "-p" || opt == "-s" || opt == "-i")) {
+      wpi::StringRef val(argv[++arg]);
+      if (opt == "-c") {
+        options.server = val;
+      } else if (opt == "-p") {
+        err |= val.getAsInteger(10, options.port);
+      } else if (opt == "-s") {
+        char* end;
+        options.speed = std::strtod(argv[arg], &end);
+        err |= *end != '\0' || options.speed < 0;
+      } else {
+        err |= val.getAsInteger(10, options.conn);
+      }
+    } else {
+      wpi::errs() << "unrecognized command line option " << argv[arg] << '\n';
+      err = true;
+    }
+    ++arg;
+  }
+
+  if (err || arg + 1 != argc) {
+    wpi::errs()
+        << argv[0] << " [-c server] [-p port] [-s speed] [-i conn] [-rl] "
+        << "capture\n"
+        << "  -c  connect to server as a client (default is to be a server)\n"
+        << "  -p  port (default " << NT_DEFAULT_PORT << ")\n"
+        << "  -s  playback speed multiple (default 1, 0 for maximum)\n"
+        << "  -i  connection uid to replay (default first in capture)\n"
+        << "  -r  replay what the connection received instead of sent\n"
+        << "  -l  loop forever\n";
+    return EXIT_FAILURE;
+  }
+
+  auto inst = nt::GetDefaultInstance();
+  nt::SetNetworkIdentity(inst, "ntreplay");
+  if (options.server.empty()) {
+    nt::StartServer(inst, "ntreplay.ini", "", options.port);
+  } else {
+    nt::StartClient(inst, options.server.c_str(), options.port);
+  }
+
+  wpi::outs() << "waiting for a connection\n";
+  wpi::outs().flush();
+  while (!nt::IsConnected(inst))
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  Replayer replayer(inst, options);
+  do {
+    if (!replayer.Play(argv[arg])) return EXIT_FAILURE;
+  } while (options.loop);
+
+  // give the last updates a chance to go out
+  std::this_thread::sleep_for(std::chrono::seconds(1));
+  nt::StopServer(inst);
+  nt::StopClient(inst);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,148 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+#include <wpi/Logger.h>
+#include <wpi/raw_istream.h>
+#include <wpi/raw_ostream.h>
+
+#include "Capture.h"
+#include "Message.h"
+#include "TestPrinters.h"
+#include "ValueMatcher.h"
+#include "gtest/gtest.h"
+#include "ntcore_cpp.h"
+
+namespace nt {
+
+TEST(CaptureTest, RoundTrip) {
+  std::string data;
+  CaptureWriter writer;
+  EXPECT_FALSE(writer.active());
+  writer.Start(std::make_unique<wpi::raw_string_ostream>(data));
+  EXPECT_TRUE(writer.active());
+  writer.Record(1, true,
+                *Message::EntryAssign("/foo", 5, 1, Value::MakeDouble(1.5), 0));
+  writer.Record(1, false, *Message::TimeSyncRequest());  // not recorded
+  writer.Record(2, false,
+                *Message::EntryUpdate(5, 2, Value::MakeString("hello")));
+  writer.Record(1, true, *Message::FlagsUpdate(5, NT_PERSISTENT));
+  writer.Stop();
+  EXPECT_FALSE(writer.active());
+  writer.Record(1, true, *Message::EntryDelete(5));  // not recorded
+
+  wpi::raw_mem_istream is(data.data(), data.size());
+  wpi::Logger logger;
+  CaptureReader reader(is, logger);
+  ASSERT_TRUE(reader.ReadHeader());
+
+  CaptureReader::Record rec;
+  ASSERT_TRUE(reader.Read(&rec));
+  EXPECT_EQ(1u, rec.conn);
+  EXPECT_TRUE(rec.outgoing);
+  uint64_t time = rec.time;
+  EXPECT_GT(time, 0u);
+  ASSERT_TRUE(rec.msg->Is(Message::kEntryAssign));
+  EXPECT_EQ("/foo", rec.msg->str());
+  EXPECT_EQ(5u, rec.msg->id());
+  EXPECT_EQ(*Value::MakeDouble(1.5), *rec.msg->value());
+
+  ASSERT_TRUE(reader.Read(&rec));
+  EXPECT_EQ(2u, rec.conn);
+  EXPECT_FALSE(rec.outgoing);
+  EXPECT_GE(rec.time, time);
+  ASSERT_TRUE(rec.msg->Is(Message::kEntryUpdate));
+  EXPECT_EQ(*Value::MakeString("hello"), *rec.msg->value());
+
+  ASSERT_TRUE(reader.Read(&rec));
+  ASSERT_TRUE(rec.msg->Is(Message::kFlagsUpdate));
+  EXPECT_EQ(static_cast<unsigned int>(NT_PERSISTENT), rec.msg->flags());
+
+  EXPECT_FALSE(reader.Read(&rec));
+  EXPECT_EQ(nullptr, reader.error());
+}
+
+TEST(CaptureTest, NotCapture) {
+  wpi::raw_mem_istream is("NTCAP", 5);
+  wpi::Logger logger;
+  CaptureReader reader(is, logger);
+  EXPECT_FALSE(reader.ReadHeader());
+}
+
+TEST(CaptureTest, Truncated) {
+  std::string data;
+  CaptureWriter writer;
+  writer.Start(std::make_unique<wpi::raw_string_ostream>(data));
+  writer.Record(1, true,
+                *Message::EntryAssign("/foo", 5, 1, Value::MakeDouble(1.5), 0));
+  writer.Stop();
+
+  wpi::raw_mem_istream is(data.data(), data.size() - 1);
+  wpi::Logger logger;
+  CaptureReader reader(is, logger);
+  ASSERT_TRUE(reader.ReadHeader());
+  CaptureReader::Record rec;
+  EXPECT_FALSE(reader.Read(&rec));
+  EXPECT_NE(nullptr, reader.error());
+}
+
+TEST(CaptureTest, Connection) {
+  auto server_inst = CreateInstance();
+  auto client_inst = CreateInstance();
+  SetNetworkIdentity(server_inst, "server");
+  SetNetworkIdentity(client_inst, "client");
+  ASSERT_TRUE(StartCapture(server_inst, "capturetest.ntcap"));
+  StartServer(server_inst, "capturetest.ini", "127.0.0.1", 10013);
+  StartClient(client_inst, "127.0.0.1", 10013);
+
+  auto entry = GetEntry(client_inst, "/captured");
+  SetEntryValue(entry, Value::MakeDouble(1));
+  auto server_entry = GetEntry(server_inst, "/captured");
+  for (int i = 0; i < 50 && !GetEntryValue(server_entry); ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  SetEntryValue(server_entry, Value::MakeDouble(2));
+  Flush(server_inst);
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  StopCapture(server_inst);
+  DestroyInstance(client_inst);
+  DestroyInstance(server_inst);
+
+  std::error_code ec;
+  wpi::raw_fd_istream is("capturetest.ntcap", ec);
+  ASSERT_EQ(0, ec.value());
+  wpi::Logger logger;
+  CaptureReader reader(is, logger);
+  ASSERT_TRUE(reader.ReadHeader());
+  bool hello = false, assigned = false, updated = false;
+  CaptureReader::Record rec;
+  while (reader.Read(&rec)) {
+    EXPECT_EQ(1u, rec.conn);
+    if (rec.msg->Is(Message::kClientHello)) {
+      EXPECT_FALSE(rec.outgoing);
+      hello = true;
+    } else if (rec.msg->Is(Message::kEntryAssign) && !rec.outgoing) {
+      EXPECT_EQ("/captured", rec.msg->str());
+      assigned = true;
+    } else if ((rec.msg->Is(Message::kEntryAssign) ||
+                rec.msg->Is(Message::kEntryUpdate)) &&
+               rec.outgoing) {
+      // the server's update may be merged into its assignment
+      updated |= rec.msg->value()->GetDouble() == 2.0;
+    }
+  }
+  EXPECT_EQ(nullptr, reader.error());
+  EXPECT_TRUE(hello);
+  EXPECT_TRUE(assigned);
+  EXPECT_TRUE(updated);
+  is.close();
+  std::remove("capturetest.ntcap");
+}
+
+}  // namespace nt
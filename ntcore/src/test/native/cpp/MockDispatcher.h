@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2017-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2017-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -20,6 +20,7 @@ class MockDispatcher : public IDispatcher {
   MOCK_METHOD3(QueueOutgoing,
                void(std::shared_ptr<Message> msg, INetworkConnection* only,
                     INetworkConnection* except));
+  MOCK_CONST_METHOD0(GetMaxProtoRev, unsigned int());
 };
 
 }  // namespace nt
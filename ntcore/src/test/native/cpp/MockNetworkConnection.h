@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2017-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2017-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -27,6 +27,10 @@ class MockNetworkConnection : public INetworkConnection {
 
   MOCK_CONST_METHOD0(state, State());
   MOCK_METHOD1(set_state, void(State state));
+
+  MOCK_CONST_METHOD1(GetTimeOffset, bool(int64_t* offset));
+  MOCK_METHOD1(set_publish_timestamps, void(bool enable));
+  MOCK_METHOD1(set_timeout, void(unsigned int timeout));
 };
 
 }  // namespace nt
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -7,6 +7,11 @@
 
 #include "StorageTest.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 #include <wpi/raw_istream.h>
 #include <wpi/raw_ostream.h>
 
@@ -20,6 +25,7 @@
 
 using ::testing::_;
 using ::testing::AnyNumber;
+using ::testing::Invoke;
 using ::testing::IsNull;
 using ::testing::Return;
 
@@ -127,6 +133,36 @@ class StorageTestPersistent : public StorageTestEmpty {
   }
 };
 
+class StorageTestHistory : public StorageTest, public ::testing::Test {
+ public:
+  StorageTestHistory() : conn(std::make_shared<MockNetworkConnection>()) {
+    HookOutgoing(false);
+    EXPECT_CALL(notifier, NotifyEntry(_, _, _, _, _)).Times(AnyNumber());
+    EXPECT_CALL(notifier, local_notifiers())
+        .Times(AnyNumber())
+        .WillRepeatedly(Return(false));
+    EXPECT_CALL(*conn, GetTimeOffset(_)).WillRepeatedly(Return(false));
+    // the server assigns id 0
+    storage.ProcessIncoming(
+        Message::EntryAssign("foo", 0, 1, Value::MakeDouble(1.0), 0),
+        conn.get(), conn);
+    foo = storage.GetEntry("foo");
+  }
+
+  // Answers the next history request with a response for the given id.
+  void RespondWith(unsigned int id) {
+    EXPECT_CALL(dispatcher, QueueOutgoing(_, IsNull(), IsNull()))
+        .WillOnce(Invoke([=](std::shared_ptr<Message> msg, auto, auto) {
+          storage.ProcessIncoming(
+              Message::HistoryResponse(id, msg->seq_num_uid(), StringRef{}),
+              conn.get(), conn);
+        }));
+  }
+
+  std::shared_ptr<MockNetworkConnection> conn;
+  unsigned int foo;
+};
+
 class MockLoadWarn {
  public:
   MOCK_METHOD2(Warn, void(size_t line, wpi::StringRef msg));
@@ -141,7 +177,7 @@ TEST_P(StorageTestEmpty, StorageEntryInit) {
   auto entry = GetEntry("foo");
   EXPECT_FALSE(entry->value);
   EXPECT_EQ(0u, entry->flags);
-  EXPECT_EQ("foobar", entry->name);  // since GetEntry uses the tmp_entry.
+  EXPECT_EQ(&tmp_entry, entry);  // since GetEntry uses the tmp_entry.
   EXPECT_EQ(0xffffu, entry->id);
   EXPECT_EQ(SequenceNumber(), entry->seq_num);
 }
@@ -354,7 +390,7 @@ TEST_P(StorageTestEmpty, SetDefaultEntryEmptyName) {
   auto entry = GetEntry("foo");
   EXPECT_FALSE(entry->value);
   EXPECT_EQ(0u, entry->flags);
-  EXPECT_EQ("foobar", entry->name);  // since GetEntry uses the tmp_entry.
+  EXPECT_EQ(&tmp_entry, entry);  // since GetEntry uses the tmp_entry.
   EXPECT_EQ(0xffffu, entry->id);
   EXPECT_EQ(SequenceNumber(), entry->seq_num);
   EXPECT_TRUE(entries().empty());
@@ -368,7 +404,7 @@ TEST_P(StorageTestEmpty, SetDefaultEntryEmptyValue) {
   auto entry = GetEntry("foo");
   EXPECT_FALSE(entry->value);
   EXPECT_EQ(0u, entry->flags);
-  EXPECT_EQ("foobar", entry->name);  // since GetEntry uses the tmp_entry.
+  EXPECT_EQ(&tmp_entry, entry);  // since GetEntry uses the tmp_entry.
   EXPECT_EQ(0xffffu, entry->id);
   EXPECT_EQ(SequenceNumber(), entry->seq_num);
   EXPECT_TRUE(entries().empty());
@@ -463,10 +499,10 @@ TEST_P(StorageTestPopulated, DeleteEntryExist) {
                           NT_NOTIFY_DELETE | NT_NOTIFY_LOCAL, UINT_MAX));
 
   storage.DeleteEntry("foo2");
-  ASSERT_EQ(1u, entries().count("foo2"));
-  EXPECT_EQ(nullptr, entries()["foo2"]->value);
-  EXPECT_EQ(0xffffu, entries()["foo2"]->id);
-  EXPECT_FALSE(entries()["foo2"]->local_write);
+  ASSERT_TRUE(HasEntry("foo2"));
+  EXPECT_EQ(nullptr, GetEntry("foo2")->value);
+  EXPECT_EQ(0xffffu, GetEntry("foo2")->id);
+  EXPECT_FALSE(GetEntry("foo2")->local_write);
   if (GetParam()) {
     ASSERT_TRUE(idmap().size() >= 2);
     EXPECT_FALSE(idmap()[1]);
@@ -486,8 +522,8 @@ TEST_P(StorageTestPopulated, DeleteAllEntries) {
       .Times(4);
 
   storage.DeleteAllEntries();
-  ASSERT_EQ(1u, entries().count("foo2"));
-  EXPECT_EQ(nullptr, entries()["foo2"]->value);
+  ASSERT_TRUE(HasEntry("foo2"));
+  EXPECT_EQ(nullptr, GetEntry("foo2")->value);
 }
 
 TEST_P(StorageTestPopulated, DeleteAllEntriesPersistent) {
@@ -500,8 +536,8 @@ TEST_P(StorageTestPopulated, DeleteAllEntriesPersistent) {
       .Times(3);
 
   storage.DeleteAllEntries();
-  ASSERT_EQ(1u, entries().count("foo2"));
-  EXPECT_NE(nullptr, entries()["foo2"]->value);
+  ASSERT_TRUE(HasEntry("foo2"));
+  EXPECT_NE(nullptr, GetEntry("foo2")->value);
 }
 
 TEST_P(StorageTestPopulated, GetEntryInfoAll) {
@@ -546,6 +582,34 @@ TEST_P(StorageTestPopulated, GetEntryInfoPrefixTypes) {
   EXPECT_EQ(NT_BOOLEAN, info[0].type);
 }
 
+TEST_P(StorageTestEmpty, GetEntryInfoPrefixDirectories) {
+  EXPECT_CALL(dispatcher, QueueOutgoing(_, _, _)).Times(AnyNumber());
+  EXPECT_CALL(notifier, NotifyEntry(_, _, _, _, _)).Times(AnyNumber());
+  EXPECT_CALL(notifier, local_notifiers())
+      .Times(AnyNumber())
+      .WillRepeatedly(Return(false));
+  // a prefix may end partway through a directory or a leaf
+  storage.SetEntryTypeValue("/a/b", Value::MakeDouble(0.0));
+  storage.SetEntryTypeValue("/a/bc/d", Value::MakeDouble(1.0));
+  storage.SetEntryTypeValue("/a/x", Value::MakeDouble(2.0));
+  storage.SetEntryTypeValue("/ab", Value::MakeDouble(3.0));
+  EXPECT_TRUE(HasEntry("/a/bc/d"));
+  EXPECT_FALSE(HasEntry("/a/bc"));
+  EXPECT_FALSE(HasEntry("/a/d"));
+
+  auto info = storage.GetEntryInfo(0, "/a/b", 0u);
+  ASSERT_EQ(2u, info.size());
+  std::sort(info.begin(), info.end(),
+            [](const auto& a, const auto& b) { return a.name < b.name; });
+  EXPECT_EQ("/a/b", info[0].name);
+  EXPECT_EQ("/a/bc/d", info[1].name);
+
+  EXPECT_EQ(4u, storage.GetEntryInfo(0, "/a", 0u).size());
+  EXPECT_EQ(3u, storage.GetEntryInfo(0, "/a/", 0u).size());
+  EXPECT_EQ(1u, storage.GetEntryInfo(0, "/a/bc/", 0u).size());
+  EXPECT_EQ("/a/bc/d", storage.GetEntryName(storage.GetEntry("/a/bc/d")));
+}
+
 TEST_P(StorageTestPersistent, SavePersistentEmpty) {
   wpi::SmallString<256> buf;
   wpi::raw_svector_ostream oss(buf);
@@ -554,7 +618,7 @@ TEST_P(StorageTestPersistent, SavePersistentEmpty) {
 }
 
 TEST_P(StorageTestPersistent, SavePersistent) {
-  for (auto& i : entries()) i.getValue()->flags = NT_PERSISTENT;
+  for (auto& i : entries()) i.getValue().flags = NT_PERSISTENT;
   wpi::SmallString<256> buf;
   wpi::raw_svector_ostream oss(buf);
   storage.SavePersistent(oss, false);
@@ -981,6 +1045,97 @@ TEST_P(StorageTestPopulateOne, DeletedGetEntries) {
   EXPECT_TRUE(storage.GetEntries("", 0).empty());
 }
 
+TEST_P(StorageTestPopulated, ConcurrentSetEntryValue) {
+  EXPECT_CALL(dispatcher, QueueOutgoing(_, _, _)).Times(AnyNumber());
+  EXPECT_CALL(notifier, NotifyEntry(_, _, _, _, _)).Times(AnyNumber());
+  constexpr int kThreads = 4;
+  constexpr int kUpdates = 1000;
+  auto foo2 = storage.GetEntry("foo2");
+  auto bar = storage.GetEntry("bar");
+  auto seq_num = GetEntry("foo2")->seq_num.value();
+
+  // writers to a shared entry and a private one, racing entry creation
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < kUpdates; ++i) {
+        storage.SetEntryValue(foo2, Value::MakeDouble(i * kThreads + t + 1));
+        storage.SetEntryValue(t % 2 == 0 ? bar : storage.GetEntry("foo"),
+                              t % 2 == 0 ? Value::MakeDouble(i)
+                                         : Value::MakeBoolean(i % 2 == 0));
+      }
+    });
+  }
+  threads.emplace_back([&] {
+    for (int i = 0; i < kUpdates; ++i) {
+      storage.SetEntryValue(storage.GetEntry("new/" + wpi::Twine(i)),
+                            Value::MakeDouble(i));
+    }
+  });
+  for (auto& thr : threads) thr.join();
+  ::testing::Mock::VerifyAndClearExpectations(&dispatcher);
+  ::testing::Mock::VerifyAndClearExpectations(&notifier);
+
+  // every update had a distinct value, so none may be lost
+  EXPECT_EQ(GetEntry("foo2")->seq_num.value(),
+            static_cast<unsigned int>(seq_num + kThreads * kUpdates));
+  EXPECT_EQ(entries().size(), 4u + kUpdates);
+  EXPECT_EQ(*storage.GetEntryValue("new/999"), *Value::MakeDouble(999));
+  if (GetParam()) {
+    EXPECT_EQ(idmap().size(), 4u + kUpdates);
+  }
+}
+
+TEST_P(StorageTestEmpty, ProcessIncomingHistoryRequestUnknown) {
+  auto conn = std::make_shared<MockNetworkConnection>();
+  if (GetParam()) {
+    // no history kept: the server answers with id 0xffff
+    EXPECT_CALL(*conn, QueueOutgoing(MessageEq(Message::HistoryResponse(
+                           0xffff, 5, StringRef{}))));
+  }
+  storage.ProcessIncoming(Message::HistoryRequest(0, 5, 0, UINT64_MAX),
+                          conn.get(), conn);
+}
+
+TEST_F(StorageTestHistory, FetchOldServer) {
+  // a protocol 3.0 server never answers, so don't wait for it
+  EXPECT_CALL(dispatcher, GetMaxProtoRev()).WillOnce(Return(0x0300u));
+  std::vector<std::shared_ptr<Value>> values;
+  EXPECT_FALSE(storage.FetchEntryHistory(foo, 0, UINT64_MAX, -1, &values));
+}
+
+TEST_F(StorageTestHistory, FetchEmpty) {
+  EXPECT_CALL(dispatcher, GetMaxProtoRev()).WillOnce(Return(0x0301u));
+  RespondWith(0);
+  std::vector<std::shared_ptr<Value>> values{Value::MakeDouble(1.0)};
+  EXPECT_TRUE(storage.FetchEntryHistory(foo, 0, UINT64_MAX, -1, &values));
+  EXPECT_TRUE(values.empty());
+}
+
+TEST_F(StorageTestHistory, FetchNoHistory) {
+  EXPECT_CALL(dispatcher, GetMaxProtoRev()).WillOnce(Return(0x0301u));
+  RespondWith(0xffff);
+  std::vector<std::shared_ptr<Value>> values;
+  EXPECT_FALSE(storage.FetchEntryHistory(foo, 0, UINT64_MAX, -1, &values));
+}
+
+TEST_F(StorageTestHistory, FetchDisconnect) {
+  EXPECT_CALL(dispatcher, GetMaxProtoRev()).WillOnce(Return(0x0301u));
+  EXPECT_CALL(dispatcher, QueueOutgoing(_, IsNull(), IsNull()));
+  // the dispatcher cancels requests when it sees the connection has died
+  std::atomic_bool done{false};
+  std::thread disconnect([&] {
+    while (!done) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      storage.CancelHistoryRequests();
+    }
+  });
+  std::vector<std::shared_ptr<Value>> values;
+  EXPECT_FALSE(storage.FetchEntryHistory(foo, 0, UINT64_MAX, -1, &values));
+  done = true;
+  disconnect.join();
+}
+
 INSTANTIATE_TEST_SUITE_P(StorageTestsEmpty, StorageTestEmpty,
                          ::testing::Bool());
 INSTANTIATE_TEST_SUITE_P(StorageTestsPopulateOne, StorageTestPopulateOne,
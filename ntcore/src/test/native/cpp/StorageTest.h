@@ -28,10 +28,12 @@ class StorageTest {
   Storage::IdMap& idmap() { return storage.m_idmap; }
 
   Storage::Entry* GetEntry(StringRef name) {
-    auto i = storage.m_entries.find(name);
-    return i == storage.m_entries.end() ? &tmp_entry : i->getValue();
+    auto entry = storage.FindEntry(name);
+    return entry ? entry : &tmp_entry;
   }
 
+  bool HasEntry(StringRef name) { return storage.FindEntry(name) != nullptr; }
+
   void HookOutgoing(bool server) { storage.SetDispatcher(&dispatcher, server); }
 
   wpi::Logger logger;
@@ -0,0 +1,270 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
+#include <wpi/Logger.h>
+#include <wpi/TCPAcceptor.h>
+#include <wpi/raw_istream.h>
+
+#include "Message.h"
+#include "TestPrinters.h"
+#include "TimeSyncFilter.h"
+#include "WireDecoder.h"
+#include "WireEncoder.h"
+#include "gtest/gtest.h"
+#include "ntcore_cpp.h"
+
+namespace nt {
+
+TEST(TimeSyncFilterTest, Empty) {
+  TimeSyncFilter filter;
+  EXPECT_FALSE(filter.valid());
+}
+
+TEST(TimeSyncFilterTest, Symmetric) {
+  TimeSyncFilter filter;
+  // server is 1000 us ahead, 100 us each way, 10 us processing
+  ASSERT_TRUE(filter.AddSample(5000, 6100, 6110, 5210));
+  ASSERT_TRUE(filter.valid());
+  EXPECT_EQ(1000, filter.offset());
+  EXPECT_EQ(200, filter.delay());
+}
+
+TEST(TimeSyncFilterTest, ServerBehind) {
+  TimeSyncFilter filter;
+  ASSERT_TRUE(filter.AddSample(5000, 4100, 4100, 5200));
+  EXPECT_EQ(-1000, filter.offset());
+}
+
+TEST(TimeSyncFilterTest, Inconsistent) {
+  TimeSyncFilter filter;
+  EXPECT_FALSE(filter.AddSample(5000, 6000, 6000, 4000));
+  EXPECT_FALSE(filter.AddSample(5000, 6000, 5000, 6000));
+  EXPECT_FALSE(filter.valid());
+}
+
+TEST(TimeSyncFilterTest, MinimumDelay) {
+  TimeSyncFilter filter;
+  // the queued (asymmetric) sample skews the offset; the fast one wins
+  ASSERT_TRUE(filter.AddSample(0, 1900, 1900, 2000));
+  EXPECT_EQ(900, filter.offset());
+  ASSERT_TRUE(filter.AddSample(10000, 11050, 11050, 10100));
+  EXPECT_EQ(1000, filter.offset());
+  EXPECT_EQ(100, filter.delay());
+  ASSERT_TRUE(filter.AddSample(20000, 21500, 21500, 20600));
+  EXPECT_EQ(1000, filter.offset());
+}
+
+TEST(TimeSyncFilterTest, Window) {
+  TimeSyncFilter filter;
+  ASSERT_TRUE(filter.AddSample(0, 1050, 1050, 100));
+  // push the good sample out of the window
+  for (size_t i = 1; i <= TimeSyncFilter::kSamples; ++i) {
+    uint64_t t0 = i * 10000;
+    ASSERT_TRUE(filter.AddSample(t0, t0 + 2100, t0 + 2100, t0 + 200));
+  }
+  EXPECT_EQ(2000, filter.offset());
+  EXPECT_EQ(200, filter.delay());
+}
+
+TEST(TimeSyncFilterTest, Jitter) {
+  TimeSyncFilter filter;
+  ASSERT_TRUE(filter.AddSample(0, 50, 50, 100));
+  EXPECT_EQ(100, filter.rtt());
+  EXPECT_EQ(0, filter.jitter());
+  // alternate between 100 and 300 us round trips
+  for (int i = 1; i < 200; ++i) {
+    uint64_t t0 = i * 10000;
+    uint64_t rtt = (i % 2) ? 300 : 100;
+    ASSERT_TRUE(filter.AddSample(t0, t0 + 50, t0 + 50, t0 + rtt));
+  }
+  EXPECT_EQ(300, filter.rtt());
+  EXPECT_NEAR(200, filter.jitter(), 5);
+  EXPECT_EQ(100, filter.delay());
+}
+
+TEST(TimeSyncMessageTest, TimestampedUpdate) {
+  auto value = Value::MakeDouble(1.5, 100000);
+  WireEncoder e(0x0301u);
+  e.set_timestamps(true);
+  e.set_time_offset(5000);
+  Message::EntryUpdate(1, 2, value)->Write(e);
+  ASSERT_EQ(nullptr, e.error());
+  EXPECT_EQ(0x15u, static_cast<unsigned char>(e.data()[0]));
+
+  wpi::raw_mem_istream is(e.data(), e.size());
+  wpi::Logger logger;
+  WireDecoder d(is, 0x0301u, logger);
+  d.set_time_offset(3000);
+  auto msg = Message::Read(d, [](unsigned int) { return NT_DOUBLE; });
+  ASSERT_NE(nullptr, msg);
+  EXPECT_TRUE(msg->Is(Message::kEntryUpdate));
+  EXPECT_EQ(1u, msg->id());
+  EXPECT_EQ(2u, msg->seq_num_uid());
+  ASSERT_NE(nullptr, msg->value());
+  EXPECT_EQ(1.5, msg->value()->GetDouble());
+  EXPECT_EQ(102000u, msg->value()->time());
+}
+
+TEST(TimeSyncMessageTest, NoTimestamps30) {
+  WireEncoder e(0x0300u);
+  e.set_timestamps(true);
+  Message::EntryUpdate(1, 2, Value::MakeDouble(1.5))->Write(e);
+  EXPECT_EQ(0x11u, static_cast<unsigned char>(e.data()[0]));
+
+  e.Reset();
+  Message::TimeSyncRequest()->Write(e);
+  EXPECT_EQ(0u, e.size());
+}
+
+TEST(TimeSyncMessageTest, Response) {
+  WireEncoder e(0x0301u);
+  Message::TimeSyncResponse(1234, 5678)->Write(e);
+  ASSERT_EQ(nullptr, e.error());
+
+  wpi::raw_mem_istream is(e.data(), e.size());
+  wpi::Logger logger;
+  WireDecoder d(is, 0x0301u, logger);
+  auto msg = Message::Read(d, [](unsigned int) { return NT_UNASSIGNED; });
+  ASSERT_NE(nullptr, msg);
+  EXPECT_TRUE(msg->Is(Message::kTimeSyncResponse));
+  EXPECT_EQ(1234u, msg->origin_time());
+  EXPECT_EQ(5678u, msg->receive_time());
+  EXPECT_GE(msg->transmit_time(), 5678u);
+}
+
+class TimeSyncTest : public ::testing::Test {
+ public:
+  TimeSyncTest()
+      : server_inst(CreateInstance()), client_inst(CreateInstance()) {
+    SetNetworkIdentity(server_inst, "server");
+    SetNetworkIdentity(client_inst, "client");
+  }
+
+  ~TimeSyncTest() override {
+    DestroyInstance(server_inst);
+    DestroyInstance(client_inst);
+  }
+
+  bool Connect();
+
+ protected:
+  NT_Inst server_inst;
+  NT_Inst client_inst;
+};
+
+bool TimeSyncTest::Connect() {
+  StartServer(server_inst, "timesynctest.ini", "127.0.0.1", 10010);
+  StartClient(client_inst, "127.0.0.1", 10010);
+
+  int64_t offset;
+  for (int i = 0; i < 50; ++i) {
+    if (GetServerTimeOffset(client_inst, &offset)) return true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+  return false;
+}
+
+TEST_F(TimeSyncTest, Offset) {
+  int64_t offset = 1;
+  EXPECT_FALSE(GetServerTimeOffset(client_inst, &offset));
+  ASSERT_TRUE(Connect());
+
+  // same clock on both ends
+  ASSERT_TRUE(GetServerTimeOffset(client_inst, &offset));
+  EXPECT_LT(std::abs(offset), 10000);
+  ASSERT_TRUE(GetServerTimeOffset(server_inst, &offset));
+  EXPECT_EQ(0, offset);
+}
+
+TEST_F(TimeSyncTest, RoundTripTime) {
+  ASSERT_TRUE(Connect());
+
+  // both ends measure it
+  for (int i = 0; i < 50; ++i) {
+    auto server_conns = GetConnections(server_inst);
+    auto client_conns = GetConnections(client_inst);
+    if (server_conns.size() == 1 && server_conns[0].rtt != 0 &&
+        client_conns.size() == 1 && client_conns[0].rtt != 0)
+      break;
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+  auto conns = GetConnections(client_inst);
+  ASSERT_EQ(1u, conns.size());
+  EXPECT_GT(conns[0].rtt, 0u);
+  EXPECT_LT(conns[0].rtt, 100000u);
+  conns = GetConnections(server_inst);
+  ASSERT_EQ(1u, conns.size());
+  EXPECT_GT(conns[0].rtt, 0u);
+  EXPECT_LT(conns[0].rtt, 100000u);
+}
+
+// A server that completes the handshake and then goes silent, as if the
+// network dropped without closing the connection.
+TEST_F(TimeSyncTest, DeadPeerTimeout) {
+  wpi::Logger logger;
+  wpi::TCPAcceptor acceptor(10011, "127.0.0.1", logger);
+  ASSERT_EQ(0, acceptor.start());
+  SetConnectionTimeout(client_inst, 0.3);
+  StartClient(client_inst, "127.0.0.1", 10011);
+
+  auto stream = acceptor.accept();
+  ASSERT_NE(nullptr, stream);
+  // Server Hello (no flags, empty identity), Server Hello Complete
+  static const char hello[] = {0x04, 0x00, 0x00, 0x03};
+  wpi::NetworkStream::Error err;
+  ASSERT_EQ(sizeof(hello), stream->send(hello, sizeof(hello), &err));
+
+  for (int i = 0; i < 50 && !IsConnected(client_inst); ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  ASSERT_TRUE(IsConnected(client_inst));
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < 200 && IsConnected(client_inst); ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_FALSE(IsConnected(client_inst));
+  EXPECT_LT(std::chrono::steady_clock::now() - start,
+            std::chrono::milliseconds(1000));
+
+  StopClient(client_inst);
+  acceptor.shutdown();
+}
+
+TEST_F(TimeSyncTest, PublishTimestamps) {
+  SetPublishTimestamps(client_inst, true);
+  ASSERT_TRUE(Connect());
+
+  uint64_t time = Now() - 5000000;
+  auto entry = GetEntry(client_inst, "/ts");
+  ASSERT_TRUE(SetEntryValue(entry, Value::MakeDouble(1.0, time)));
+  Flush(client_inst);
+
+  auto server_entry = GetEntry(server_inst, "/ts");
+  std::shared_ptr<Value> value;
+  for (int i = 0; i < 50 && !value; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    value = GetEntryValue(server_entry);
+  }
+  ASSERT_NE(nullptr, value);
+  // created with an assignment, so the timestamp is the arrival time
+  EXPECT_GT(value->time(), time + 4000000);
+
+  ASSERT_TRUE(SetEntryValue(entry, Value::MakeDouble(2.0, time + 1)));
+  Flush(client_inst);
+  for (int i = 0; i < 50 && value->GetDouble() != 2.0; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    value = GetEntryValue(server_entry);
+  }
+  ASSERT_EQ(2.0, value->GetDouble());
+  EXPECT_LT(std::abs(static_cast<int64_t>(value->time() - (time + 1))),
+            10000);
+}
+
+}  // namespace nt
@@ -0,0 +1,160 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include <chrono>
+#include <thread>
+
+#include "TestPrinters.h"
+#include "ValueHistory.h"
+#include "gtest/gtest.h"
+#include "ntcore_cpp.h"
+
+namespace nt {
+
+static std::vector<double> GetDoubles(const ValueHistory& history,
+                                      uint64_t start = 0,
+                                      uint64_t end = UINT64_MAX) {
+  std::vector<std::shared_ptr<Value>> values;
+  history.Get(start, end, &values);
+  std::vector<double> out;
+  for (auto& value : values) out.push_back(value->GetDouble());
+  return out;
+}
+
+TEST(ValueHistoryTest, Wraparound) {
+  ValueHistory history(3);
+  history.Add(Value::MakeDouble(1, 10));
+  history.Add(Value::MakeDouble(2, 20));
+  EXPECT_EQ(2u, history.size());
+  EXPECT_EQ((std::vector<double>{1, 2}), GetDoubles(history));
+  history.Add(Value::MakeDouble(3, 30));
+  history.Add(Value::MakeDouble(4, 40));
+  EXPECT_EQ(3u, history.size());
+  EXPECT_EQ((std::vector<double>{2, 3, 4}), GetDoubles(history));
+}
+
+TEST(ValueHistoryTest, Window) {
+  ValueHistory history(10);
+  for (int i = 1; i <= 10; ++i) history.Add(Value::MakeDouble(i, i * 10));
+  EXPECT_EQ((std::vector<double>{3, 4, 5}), GetDoubles(history, 30, 50));
+  EXPECT_EQ((std::vector<double>{3, 4, 5}), GetDoubles(history, 25, 55));
+  EXPECT_TRUE(GetDoubles(history, 101).empty());
+}
+
+TEST(ValueHistoryTest, Resize) {
+  ValueHistory history(4);
+  for (int i = 1; i <= 6; ++i) history.Add(Value::MakeDouble(i, i));
+  history.Resize(2);
+  EXPECT_EQ((std::vector<double>{5, 6}), GetDoubles(history));
+  history.Resize(3);
+  history.Add(Value::MakeDouble(7, 7));
+  history.Add(Value::MakeDouble(8, 8));
+  EXPECT_EQ((std::vector<double>{6, 7, 8}), GetDoubles(history));
+  history.Clear();
+  EXPECT_EQ(0u, history.size());
+}
+
+class EntryHistoryTest : public ::testing::Test {
+ public:
+  EntryHistoryTest()
+      : server_inst(CreateInstance()), client_inst(CreateInstance()) {
+    SetNetworkIdentity(server_inst, "server");
+    SetNetworkIdentity(client_inst, "client");
+  }
+
+  ~EntryHistoryTest() override {
+    DestroyInstance(server_inst);
+    DestroyInstance(client_inst);
+  }
+
+ protected:
+  NT_Inst server_inst;
+  NT_Inst client_inst;
+};
+
+TEST_F(EntryHistoryTest, Local) {
+  SetEntryHistory(server_inst, "/plot/", 5);
+  auto entry = GetEntry(server_inst, "/plot/x");
+  auto other = GetEntry(server_inst, "/other");
+  for (int i = 1; i <= 8; ++i) {
+    SetEntryValue(entry, Value::MakeDouble(i, i * 1000));
+    SetEntryValue(other, Value::MakeDouble(i, i * 1000));
+  }
+
+  std::vector<std::shared_ptr<Value>> values;
+  ASSERT_TRUE(FetchEntryHistory(entry, 0, UINT64_MAX, 0, &values));
+  ASSERT_EQ(5u, values.size());
+  EXPECT_EQ(4, values[0]->GetDouble());
+  EXPECT_EQ(8, values[4]->GetDouble());
+
+  ASSERT_TRUE(FetchEntryHistory(entry, 5000, 6000, 0, &values));
+  ASSERT_EQ(2u, values.size());
+  EXPECT_EQ(5, values[0]->GetDouble());
+
+  EXPECT_FALSE(FetchEntryHistory(other, 0, UINT64_MAX, 0, &values));
+
+  // a longer prefix overrides, and deleting clears the history
+  SetEntryHistory(server_inst, "/plot/x", 0);
+  EXPECT_FALSE(FetchEntryHistory(entry, 0, UINT64_MAX, 0, &values));
+  SetEntryHistory(server_inst, "/plot/x", 2);
+  SetEntryValue(entry, Value::MakeDouble(9, 9000));
+  ASSERT_TRUE(FetchEntryHistory(entry, 0, UINT64_MAX, 0, &values));
+  EXPECT_EQ(1u, values.size());
+  DeleteEntry(entry);
+  ASSERT_TRUE(FetchEntryHistory(entry, 0, UINT64_MAX, 0, &values));
+  EXPECT_TRUE(values.empty());
+}
+
+TEST_F(EntryHistoryTest, Remote) {
+  SetEntryHistory(server_inst, "/plot/", 100);
+  auto server_entry = GetEntry(server_inst, "/plot/x");
+  uint64_t now = Now();
+  for (int i = 0; i < 50; ++i)
+    SetEntryValue(server_entry, Value::MakeDouble(i, now - (50 - i) * 1000));
+
+  StartServer(server_inst, "entryhistorytest.ini", "127.0.0.1", 10012);
+  StartClient(client_inst, "127.0.0.1", 10012);
+  int64_t offset;
+  for (int i = 0; i < 50 && !GetServerTimeOffset(client_inst, &offset); ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  ASSERT_TRUE(GetServerTimeOffset(client_inst, &offset));
+
+  auto entry = GetEntry(client_inst, "/plot/x");
+  for (int i = 0; i < 50 && !GetEntryValue(entry); ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+  // the last 10 ms worth (ten values), in local time
+  std::vector<std::shared_ptr<Value>> values;
+  ASSERT_TRUE(FetchEntryHistory(entry, now - 10500, UINT64_MAX, 2.0, &values));
+  ASSERT_EQ(10u, values.size());
+  EXPECT_EQ(40, values[0]->GetDouble());
+  EXPECT_EQ(49, values[9]->GetDouble());
+  EXPECT_LT(std::abs(static_cast<int64_t>(values[9]->time() - (now - 1000))),
+            10000);
+
+  // nothing in the window
+  ASSERT_TRUE(FetchEntryHistory(entry, now + 1000000, UINT64_MAX, 2.0,
+                                &values));
+  EXPECT_TRUE(values.empty());
+
+  // not configured on the server, as for a local fetch
+  SetEntryValue(GetEntry(server_inst, "/other"), Value::MakeDouble(1));
+  auto other = GetEntry(client_inst, "/other");
+  for (int i = 0; i < 50 && !GetEntryValue(other); ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(FetchEntryHistory(other, 0, UINT64_MAX, 2.0, &values));
+
+  // a lost connection fails the fetch rather than waiting for the timeout
+  StopServer(server_inst);
+  for (int i = 0; i < 50 && IsConnected(client_inst); ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_FALSE(FetchEntryHistory(entry, 0, UINT64_MAX, -1, &values));
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+}
+
+}  // namespace nt
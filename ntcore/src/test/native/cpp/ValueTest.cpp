@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -9,6 +9,7 @@
 #include "Value_internal.h"
 #include "gtest/gtest.h"
 #include "networktables/NetworkTableValue.h"
+#include "ntcore.h"
 
 namespace nt {
 
@@ -105,6 +106,22 @@ TEST_F(ValueTest, Raw) {
   NT_DisposeValue(&cv);
 }
 
+TEST_F(ValueTest, RawMove) {
+  // long enough to be heap allocated, so a move keeps the same buffer
+  std::string raw(100, 'x');
+  const char* data = raw.data();
+  auto v = Value::MakeRaw(std::move(raw));
+  ASSERT_EQ(NT_RAW, v->type());
+  ASSERT_EQ(100u, v->GetRaw().size());
+  ASSERT_EQ(data, v->GetRaw().data());
+
+  std::string rpc(100, 'y');
+  data = rpc.data();
+  v = Value::MakeRpc(std::move(rpc));
+  ASSERT_EQ(NT_RPC, v->type());
+  ASSERT_EQ(data, v->GetRpc().data());
+}
+
 TEST_F(ValueTest, BooleanArray) {
   std::vector<int> vec{1, 0, 1};
   auto v = Value::MakeBooleanArray(vec);
@@ -241,6 +258,80 @@ TEST_F(ValueTest, StringArray) {
   NT_DisposeValue(&cv);
 }
 
+TEST_F(ValueTest, ConvertToBuffer) {
+  std::vector<std::string> vec{"hello", "goodbye"};
+  auto v = Value::MakeStringArray(std::move(vec));
+  NT_Value cv;
+  // size query
+  size_t needed = ConvertToC(*v, &cv, nullptr, 0);
+  EXPECT_EQ(NT_UNASSIGNED, cv.type);
+  ASSERT_GE(needed, 2 * sizeof(NT_String) + 14);
+
+  alignas(double) char buf[256];
+  EXPECT_EQ(needed, ConvertToC(*v, &cv, buf, needed - 1));
+  EXPECT_EQ(NT_UNASSIGNED, cv.type);
+  EXPECT_EQ(needed, ConvertToC(*v, &cv, buf, needed));
+  ASSERT_EQ(NT_STRING_ARRAY, cv.type);
+  EXPECT_EQ(v->last_change(), cv.last_change);
+  ASSERT_EQ(2u, cv.data.arr_string.size);
+  EXPECT_EQ(wpi::StringRef("hello"), cv.data.arr_string.arr[0].str);
+  EXPECT_EQ(wpi::StringRef("goodbye"), cv.data.arr_string.arr[1].str);
+  EXPECT_GE(cv.data.arr_string.arr[1].str, buf);
+  EXPECT_LT(cv.data.arr_string.arr[1].str, buf + needed);
+
+  v = Value::MakeDoubleArray(std::vector<double>{1.0, 2.0});
+  EXPECT_EQ(2 * sizeof(double), ConvertToC(*v, &cv, buf, sizeof(buf)));
+  ASSERT_EQ(NT_DOUBLE_ARRAY, cv.type);
+  EXPECT_EQ(2.0, cv.data.arr_double.arr[1]);
+
+  v = Value::MakeDouble(0.5);
+  EXPECT_EQ(0u, ConvertToC(*v, &cv, nullptr, 0));
+  ASSERT_EQ(NT_DOUBLE, cv.type);
+  EXPECT_EQ(0.5, cv.data.v_double);
+}
+
+TEST_F(ValueTest, GetEntryBuffer) {
+  auto inst = NT_CreateInstance();
+  NT_Entry entries[3] = {NT_GetEntry(inst, "/a", 2), NT_GetEntry(inst, "/b", 2),
+                         NT_GetEntry(inst, "/c", 2)};
+  const double arr[3] = {1.0, 2.0, 3.0};
+  NT_SetEntryDoubleArray(entries[0], 0, arr, 3, 0);
+  NT_SetEntryString(entries[2], 0, "str", 3, 0);
+
+  double out[3];
+  uint64_t last_change;
+  size_t size = 2;
+  EXPECT_FALSE(
+      NT_GetEntryDoubleArrayBuffer(entries[0], &last_change, out, &size));
+  EXPECT_EQ(3u, size);
+  ASSERT_TRUE(
+      NT_GetEntryDoubleArrayBuffer(entries[0], &last_change, out, &size));
+  EXPECT_EQ(3.0, out[2]);
+  char str[3];
+  size = sizeof(str);
+  EXPECT_FALSE(NT_GetEntryStringBuffer(entries[0], &last_change, str, &size));
+  EXPECT_EQ(0u, size);
+  size = sizeof(str);
+  ASSERT_TRUE(NT_GetEntryStringBuffer(entries[2], &last_change, str, &size));
+  EXPECT_EQ(wpi::StringRef("str"), wpi::StringRef(str, size));
+
+  NT_Value values[3];
+  size_t needed = NT_GetEntryValuesBuffer(entries, 3, values, nullptr, 0);
+  EXPECT_EQ(NT_UNASSIGNED, values[0].type);
+  std::vector<double> buf((needed + sizeof(double) - 1) / sizeof(double));
+  EXPECT_EQ(needed, NT_GetEntryValuesBuffer(
+                        entries, 3, values, reinterpret_cast<char*>(buf.data()),
+                        needed));
+  ASSERT_EQ(NT_DOUBLE_ARRAY, values[0].type);
+  EXPECT_EQ(3u, values[0].data.arr_double.size);
+  EXPECT_EQ(2.0, values[0].data.arr_double.arr[1]);
+  EXPECT_EQ(NT_UNASSIGNED, values[1].type);
+  ASSERT_EQ(NT_STRING, values[2].type);
+  EXPECT_EQ(wpi::StringRef("str"), values[2].data.v_string.str);
+
+  NT_DestroyInstance(inst);
+}
+
 TEST_F(ValueDeathTest, GetAssertions) {
   Value v;
   ASSERT_DEATH((void)v.GetBoolean(), "type == NT_BOOLEAN");
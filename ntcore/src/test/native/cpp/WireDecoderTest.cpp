@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -640,4 +640,33 @@ TEST_F(WireDecoderTest, ReadString3) {
   ASSERT_EQ(nullptr, d.error());
 }
 
+TEST_F(WireDecoderTest, ReadEntryName31) {
+  wpi::StringRef s("\x00\x04/a/b\x03\x02" "cd\x05\x00\x01\x01x", 15);
+  wpi::raw_mem_istream is(s.data(), s.size());
+  wpi::Logger logger;
+  WireDecoder d(is, 0x0301u, logger);
+  std::string outs;
+  ASSERT_TRUE(d.ReadEntryName(&outs));
+  EXPECT_EQ("/a/b", outs);
+  ASSERT_TRUE(d.ReadEntryName(&outs));
+  EXPECT_EQ("/a/cd", outs);
+  ASSERT_TRUE(d.ReadEntryName(&outs));
+  EXPECT_EQ("/a/cd", outs);
+  ASSERT_TRUE(d.ReadEntryName(&outs));
+  EXPECT_EQ("/x", outs);
+  ASSERT_EQ(nullptr, d.error());
+}
+
+TEST_F(WireDecoderTest, ReadEntryNameBadPrefix31) {
+  wpi::StringRef s("\x00\x01" "a\x02\x01" "b", 6);
+  wpi::raw_mem_istream is(s.data(), s.size());
+  wpi::Logger logger;
+  WireDecoder d(is, 0x0301u, logger);
+  std::string outs;
+  ASSERT_TRUE(d.ReadEntryName(&outs));
+  EXPECT_EQ("a", outs);
+  ASSERT_FALSE(d.ReadEntryName(&outs));
+  ASSERT_NE(nullptr, d.error());
+}
+
 }  // namespace nt
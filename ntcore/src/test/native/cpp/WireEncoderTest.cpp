@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -490,4 +490,29 @@ TEST_F(WireEncoderTest, WriteString3) {
   EXPECT_EQ('x', e.data()[65539]);
 }
 
+TEST_F(WireEncoderTest, WriteEntryName3) {
+  WireEncoder e(0x0300u);
+  e.WriteEntryName("/a/b");
+  e.WriteEntryName("/a/c");
+  EXPECT_EQ(nullptr, e.error());
+  EXPECT_EQ(wpi::StringRef("\x04/a/b\x04/a/c", 10),
+            wpi::StringRef(e.data(), e.size()));
+}
+
+TEST_F(WireEncoderTest, WriteEntryName31) {
+  WireEncoder e(0x0301u);
+  e.WriteEntryName("/a/b");
+  e.WriteEntryName("/a/cd");
+  e.WriteEntryName("/a/cd");
+  e.WriteEntryName("/x");
+  EXPECT_EQ(nullptr, e.error());
+  EXPECT_EQ(wpi::StringRef("\x00\x04/a/b\x03\x02" "cd\x05\x00\x01\x01x", 15),
+            wpi::StringRef(e.data(), e.size()));
+
+  // prefix is relative to the last name even across Reset()
+  e.Reset();
+  e.WriteEntryName("/xy");
+  EXPECT_EQ(wpi::StringRef("\x02\x01y", 3), wpi::StringRef(e.data(), e.size()));
+}
+
 }  // namespace nt
@@ -106,6 +106,14 @@ bool Command::HasRequirement(Subsystem* requirement) const {
   return hasRequirement;
 }
 
+RequirementMask Command::GetRequirementMask() const {
+  RequirementMask mask;
+  for (auto&& requirement : GetRequirements()) {
+    mask.Add(requirement);
+  }
+  return mask;
+}
+
 std::string Command::GetName() const { return GetTypeName(*this); }
 
 bool Command::IsGrouped() const { return m_isGrouped; }
@@ -114,11 +122,7 @@ void Command::SetGrouped(bool grouped) { m_isGrouped = grouped; }
 
 namespace frc2 {
 bool RequirementsDisjoint(Command* first, Command* second) {
-  bool disjoint = true;
-  auto&& requirements = second->GetRequirements();
-  for (auto&& requirement : first->GetRequirements()) {
-    disjoint &= requirements.find(requirement) == requirements.end();
-  }
-  return disjoint;
+  return !first->GetRequirementMask().Intersects(
+      second->GetRequirementMask());
 }
 }  // namespace frc2
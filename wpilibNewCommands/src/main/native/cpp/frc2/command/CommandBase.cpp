@@ -18,21 +18,45 @@ CommandBase::CommandBase() {
 
 void CommandBase::AddRequirements(
     std::initializer_list<Subsystem*> requirements) {
-  m_requirements.insert(requirements.begin(), requirements.end());
+  AddRequirementsImpl(requirements);
 }
 
 void CommandBase::AddRequirements(wpi::ArrayRef<Subsystem*> requirements) {
-  m_requirements.insert(requirements.begin(), requirements.end());
+  AddRequirementsImpl(requirements);
 }
 
 void CommandBase::AddRequirements(wpi::SmallSet<Subsystem*, 4> requirements) {
-  m_requirements.insert(requirements.begin(), requirements.end());
+  AddRequirementsImpl(requirements);
 }
 
 wpi::SmallSet<Subsystem*, 4> CommandBase::GetRequirements() const {
   return m_requirements;
 }
 
+RequirementMask CommandBase::GetRequirementMask() const {
+  if (!IsRequirementMaskCurrent()) {
+    m_requirementMask = RequirementMask{};
+    for (auto&& requirement : m_requirements) {
+      m_requirementMask.Add(requirement);
+    }
+    m_requirementMaskSize = m_requirements.size();
+    m_requirementMaskGeneration = RequirementMask::Generation();
+  }
+  return m_requirementMask;
+}
+
+template <typename Range>
+void CommandBase::AddRequirementsImpl(const Range& requirements) {
+  bool current = IsRequirementMaskCurrent();
+  m_requirements.insert(requirements.begin(), requirements.end());
+  if (current) {
+    for (auto&& requirement : requirements) {
+      m_requirementMask.Add(requirement);
+    }
+    m_requirementMaskSize = m_requirements.size();
+  }
+}
+
 void CommandBase::SetName(const wpi::Twine& name) {
   frc::SendableRegistry::GetInstance().SetName(this, name);
 }
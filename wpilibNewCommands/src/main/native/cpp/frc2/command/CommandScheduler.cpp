@@ -7,6 +7,14 @@
 
 #include "frc2/command/CommandScheduler.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include <frc/RobotBase.h>
 #include <frc/RobotState.h>
 #include <frc/WPIErrors.h>
 #include <frc/livewindow/LiveWindow.h>
@@ -15,28 +23,144 @@
 #include <hal/FRCUsageReporting.h>
 #include <hal/HALBase.h>
 #include <networktables/NetworkTableEntry.h>
-#include <wpi/DenseMap.h>
 #include <wpi/SmallVector.h>
+#include <wpi/ThreadHooks.h>
+#include <wpi/Trace.h>
+#include <wpi/condition_variable.h>
+#include <wpi/mutex.h>
 
 #include "frc2/command/CommandGroupBase.h"
 #include "frc2/command/CommandState.h"
+#include "frc2/command/RequirementMask.h"
 #include "frc2/command/Subsystem.h"
 
 using namespace frc2;
 
+namespace {
+struct ScheduledCommand {
+  Command* command;
+  CommandState state;
+  RequirementMask requirements;
+};
+
+struct RegisteredSubsystem {
+  Subsystem* subsystem;
+  unsigned index;
+  std::unique_ptr<Command> defaultCommand;
+  bool independent = false;
+  std::chrono::nanoseconds periodicTime{0};
+};
+
+// Worker threads that run a batch of tasks together with the calling thread.
+// Tasks are claimed from a shared counter, so a slow task doesn't hold up the
+// rest of the batch.
+class PeriodicPool {
+ public:
+  explicit PeriodicPool(int threads) {
+    for (int i = 0; i < threads; ++i) {
+      m_threads.emplace_back([this] { WorkerMain(); });
+    }
+  }
+
+  ~PeriodicPool() {
+    {
+      std::scoped_lock lock(m_mutex);
+      m_stop = true;
+    }
+    m_startCond.notify_all();
+    for (auto&& thread : m_threads) {
+      thread.join();
+    }
+  }
+
+  // Calls task(i) for every i in [0, count) on the workers and the calling
+  // thread, after the calling thread has run callerWork.  Returns once every
+  // task has returned.  Neither may throw.
+  void Run(size_t count, wpi::function_ref<void(size_t)> task,
+           wpi::function_ref<void()> callerWork) {
+    Batch batch{task, count};
+    {
+      std::scoped_lock lock(m_mutex);
+      m_batch = &batch;
+      ++m_generation;
+    }
+    m_startCond.notify_all();
+
+    callerWork();
+    batch.Work();
+
+    // Workers that picked up the batch may still be running their last task
+    std::unique_lock lock(m_mutex);
+    m_doneCond.wait(lock, [&] { return m_busy == 0; });
+    m_batch = nullptr;
+  }
+
+ private:
+  struct Batch {
+    Batch(wpi::function_ref<void(size_t)> task, size_t count)
+        : task{task}, count{count} {}
+
+    void Work() {
+      for (size_t i = next++; i < count; i = next++) {
+        task(i);
+      }
+    }
+
+    wpi::function_ref<void(size_t)> task;
+    size_t count;
+    std::atomic<size_t> next{0};
+  };
+
+  void WorkerMain() {
+    wpi::SetCurrentThreadName("SubsystemPeriodic");
+    std::unique_lock lock(m_mutex);
+    uint64_t seen = 0;
+    for (;;) {
+      m_startCond.wait(
+          lock, [&] { return m_stop || (m_batch && m_generation != seen); });
+      if (m_stop) {
+        return;
+      }
+      seen = m_generation;
+      Batch* batch = m_batch;
+      ++m_busy;
+      lock.unlock();
+      batch->Work();
+      lock.lock();
+      if (--m_busy == 0) {
+        m_doneCond.notify_one();
+      }
+    }
+  }
+
+  wpi::mutex m_mutex;
+  wpi::condition_variable m_startCond;
+  wpi::condition_variable m_doneCond;
+  std::vector<std::thread> m_threads;
+  Batch* m_batch = nullptr;
+  uint64_t m_generation = 0;
+  int m_busy = 0;
+  bool m_stop = false;
+};
+}  // namespace
+
 class CommandScheduler::Impl {
  public:
-  // A map from commands to their scheduling state.  Also used as a set of the
-  // currently-running commands.
-  wpi::DenseMap<Command*, CommandState> scheduledCommands;
+  // The currently-running commands and their scheduling state, in the order
+  // they were scheduled.  Kept contiguous so that Run() is a linear walk.
+  std::vector<ScheduledCommand> scheduledCommands;
+
+  // The command currently requiring each subsystem, indexed by
+  // RequirementMask subsystem index.  Null if the subsystem is not required.
+  // Grown as subsystems with higher indices are seen.
+  std::vector<Command*> requiring;
 
-  // A map from required subsystems to their requiring commands.  Also used as a
-  // set of the currently-required subsystems.
-  wpi::DenseMap<Subsystem*, Command*> requirements;
+  // The union of the requirements of all scheduled commands.
+  RequirementMask required;
 
-  // A map from subsystems registered with the scheduler to their default
-  // commands.  Also used as a list of currently-registered subsystems.
-  wpi::DenseMap<Subsystem*, std::unique_ptr<Command>> subsystems;
+  // The subsystems registered with the scheduler and their default commands,
+  // in registration order.
+  std::vector<RegisteredSubsystem> subsystems;
 
   // The set of currently-registered buttons that will be polled every
   // iteration.
@@ -55,13 +179,125 @@ class CommandScheduler::Impl {
   // scheduled/canceled during run
 
   bool inRunLoop = false;
-  wpi::DenseMap<Command*, bool> toSchedule;
+  wpi::SmallVector<std::pair<Command*, bool>, 4> toSchedule;
   wpi::SmallVector<Command*, 4> toCancel;
+
+  // Runs independent subsystems' periodic methods concurrently; null to run
+  // every periodic method in turn.
+  std::unique_ptr<PeriodicPool> periodicPool;
+
+  unsigned GetIndex(const Subsystem* subsystem) {
+    unsigned index = RequirementMask::IndexOf(subsystem);
+    if (index >= requiring.size()) {
+      requiring.resize(index + 1, nullptr);
+    }
+    return index;
+  }
+
+  RequirementMask GetMask(const Command& command) {
+    RequirementMask mask = command.GetRequirementMask();
+    mask.ForEach([&](unsigned index) {
+      if (index >= requiring.size()) {
+        requiring.resize(index + 1, nullptr);
+      }
+    });
+    return mask;
+  }
+
+  ScheduledCommand* Find(const Command* command) {
+    auto it = std::find_if(
+        scheduledCommands.begin(), scheduledCommands.end(),
+        [=](const ScheduledCommand& s) { return s.command == command; });
+    return it == scheduledCommands.end() ? nullptr : &*it;
+  }
+
+  RegisteredSubsystem* FindSubsystem(const Subsystem* subsystem) {
+    auto it = std::find_if(
+        subsystems.begin(), subsystems.end(),
+        [=](const RegisteredSubsystem& s) { return s.subsystem == subsystem; });
+    return it == subsystems.end() ? nullptr : &*it;
+  }
+
+  // Releases the requirements of a scheduled command and removes it, keeping
+  // the remaining commands in order.
+  void Remove(ScheduledCommand* scheduled) {
+    scheduled->requirements.ForEach([&](unsigned index) {
+      if (requiring[index] == scheduled->command) {
+        requiring[index] = nullptr;
+      }
+    });
+    required.Remove(scheduled->requirements);
+    scheduledCommands.erase(scheduledCommands.begin() +
+                            (scheduled - scheduledCommands.data()));
+  }
+
+  // Runs the periodic methods of all registered subsystems.
+  void RunPeriodic();
 };
 
-template <typename TMap, typename TKey>
-static bool ContainsKey(const TMap& map, TKey keyToCheck) {
-  return map.find(keyToCheck) != map.end();
+static std::chrono::nanoseconds RunTimedPeriodic(Subsystem* subsystem) {
+  wpi::TraceScope trace{"Subsystem::Periodic"};
+  auto start = std::chrono::steady_clock::now();
+  subsystem->Periodic();
+  return std::chrono::steady_clock::now() - start;
+}
+
+void CommandScheduler::Impl::RunPeriodic() {
+  if (!periodicPool) {
+    for (size_t i = 0; i < subsystems.size(); ++i) {
+      auto time = RunTimedPeriodic(subsystems[i].subsystem);
+      // Periodic() may have registered or unregistered subsystems
+      if (i < subsystems.size()) {
+        subsystems[i].periodicTime = time;
+      }
+    }
+    return;
+  }
+
+  // Dependent subsystems may register or unregister subsystems while the
+  // independent ones are running, so work from a copy.
+  struct Task {
+    Subsystem* subsystem;
+    std::chrono::nanoseconds time;
+  };
+  wpi::SmallVector<Task, 16> independent;
+  wpi::SmallVector<Task, 16> dependent;
+  for (auto&& subsystem : subsystems) {
+    (subsystem.independent ? independent : dependent)
+        .push_back({subsystem.subsystem, std::chrono::nanoseconds{0}});
+  }
+
+  // Exceptions are rethrown once every periodic method has returned
+  wpi::mutex errorMutex;
+  std::exception_ptr error;
+  auto run = [&](Task& task) {
+    try {
+      task.time = RunTimedPeriodic(task.subsystem);
+    } catch (...) {
+      std::scoped_lock lock(errorMutex);
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+  };
+  periodicPool->Run(
+      independent.size(), [&](size_t i) { run(independent[i]); },
+      [&] {
+        for (auto&& task : dependent) {
+          run(task);
+        }
+      });
+
+  for (auto* tasks : {&independent, &dependent}) {
+    for (auto&& task : *tasks) {
+      if (auto registered = FindSubsystem(task.subsystem)) {
+        registered->periodicTime = task.time;
+      }
+    }
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
 }
 
 CommandScheduler::CommandScheduler() : m_impl(new Impl) {
@@ -96,7 +332,13 @@ void CommandScheduler::ClearButtons() { m_impl->buttons.clear(); }
 
 void CommandScheduler::Schedule(bool interruptible, Command* command) {
   if (m_impl->inRunLoop) {
-    m_impl->toSchedule.try_emplace(command, interruptible);
+    auto& toSchedule = m_impl->toSchedule;
+    if (std::none_of(toSchedule.begin(), toSchedule.end(),
+                     [=](const auto& pending) {
+                       return pending.first == command;
+                     })) {
+      toSchedule.emplace_back(command, interruptible);
+    }
     return;
   }
 
@@ -108,40 +350,36 @@ void CommandScheduler::Schedule(bool interruptible, Command* command) {
   }
   if (m_impl->disabled ||
       (frc::RobotState::IsDisabled() && !command->RunsWhenDisabled()) ||
-      ContainsKey(m_impl->scheduledCommands, command)) {
+      m_impl->Find(command)) {
     return;
   }
 
-  const auto& requirements = command->GetRequirements();
-
-  wpi::SmallVector<Command*, 8> intersection;
+  auto requirements = m_impl->GetMask(*command);
 
-  bool isDisjoint = true;
-  bool allInterruptible = true;
-  for (auto&& i1 : m_impl->requirements) {
-    if (requirements.find(i1.first) != requirements.end()) {
-      isDisjoint = false;
-      allInterruptible &=
-          m_impl->scheduledCommands[i1.second].IsInterruptible();
-      intersection.emplace_back(i1.second);
-    }
-  }
-
-  if (isDisjoint || allInterruptible) {
-    if (allInterruptible) {
-      for (auto&& cmdToCancel : intersection) {
-        Cancel(cmdToCancel);
+  if (requirements.Intersects(m_impl->required)) {
+    wpi::SmallVector<Command*, 8> intersection;
+    for (auto&& scheduled : m_impl->scheduledCommands) {
+      if (scheduled.requirements.Intersects(requirements)) {
+        if (!scheduled.state.IsInterruptible()) {
+          return;
+        }
+        intersection.emplace_back(scheduled.command);
       }
     }
-    command->Initialize();
-    m_impl->scheduledCommands[command] = CommandState{interruptible};
-    for (auto&& action : m_impl->initActions) {
-      action(*command);
-    }
-    for (auto&& requirement : requirements) {
-      m_impl->requirements[requirement] = command;
+    for (auto&& cmdToCancel : intersection) {
+      Cancel(cmdToCancel);
     }
   }
+
+  command->Initialize();
+  requirements.ForEach(
+      [&](unsigned index) { m_impl->requiring[index] = command; });
+  m_impl->required.Merge(requirements);
+  m_impl->scheduledCommands.push_back(
+      {command, CommandState{interruptible}, std::move(requirements)});
+  for (auto&& action : m_impl->initActions) {
+    action(*command);
+  }
 }
 
 void CommandScheduler::Schedule(Command* command) { Schedule(true, command); }
@@ -177,10 +415,9 @@ void CommandScheduler::Run() {
     return;
   }
 
-  // Run the periodic method of all registered subsystems.
-  for (auto&& subsystem : m_impl->subsystems) {
-    subsystem.getFirst()->Periodic();
-  }
+  wpi::TraceScope trace{"CommandScheduler::Run"};
+
+  m_impl->RunPeriodic();
 
   // Poll buttons for new commands to add.
   for (auto&& button : m_impl->buttons) {
@@ -188,13 +425,16 @@ void CommandScheduler::Run() {
   }
 
   m_impl->inRunLoop = true;
-  // Run scheduled commands, remove finished commands.
-  for (auto iterator = m_impl->scheduledCommands.begin();
-       iterator != m_impl->scheduledCommands.end(); iterator++) {
-    Command* command = iterator->getFirst();
+  // Run scheduled commands, remove finished commands.  Scheduling and
+  // canceling are deferred while in the loop, so the only modification to
+  // the command list is the removal of finished commands below.
+  auto& scheduledCommands = m_impl->scheduledCommands;
+  for (size_t i = 0; i < scheduledCommands.size();) {
+    Command* command = scheduledCommands[i].command;
 
     if (!command->RunsWhenDisabled() && frc::RobotState::IsDisabled()) {
       Cancel(command);
+      ++i;
       continue;
     }
 
@@ -209,11 +449,9 @@ void CommandScheduler::Run() {
         action(*command);
       }
 
-      for (auto&& requirement : command->GetRequirements()) {
-        m_impl->requirements.erase(requirement);
-      }
-
-      m_impl->scheduledCommands.erase(iterator);
+      m_impl->Remove(&scheduledCommands[i]);
+    } else {
+      ++i;
     }
   }
   m_impl->inRunLoop = false;
@@ -230,23 +468,55 @@ void CommandScheduler::Run() {
   m_impl->toCancel.clear();
 
   // Add default commands for un-required registered subsystems.
-  for (auto&& subsystem : m_impl->subsystems) {
-    auto s = m_impl->requirements.find(subsystem.getFirst());
-    if (s == m_impl->requirements.end() && subsystem.getSecond()) {
-      Schedule({subsystem.getSecond().get()});
+  for (size_t i = 0; i < m_impl->subsystems.size(); ++i) {
+    auto& subsystem = m_impl->subsystems[i];
+    if (!m_impl->requiring[subsystem.index] && subsystem.defaultCommand) {
+      Schedule({subsystem.defaultCommand.get()});
     }
   }
 }
 
 void CommandScheduler::RegisterSubsystem(Subsystem* subsystem) {
-  m_impl->subsystems[subsystem] = nullptr;
+  if (auto registered = m_impl->FindSubsystem(subsystem)) {
+    registered->defaultCommand = nullptr;
+    return;
+  }
+  m_impl->subsystems.push_back(
+      {subsystem, m_impl->GetIndex(subsystem), nullptr});
 }
 
 void CommandScheduler::UnregisterSubsystem(Subsystem* subsystem) {
-  auto s = m_impl->subsystems.find(subsystem);
-  if (s != m_impl->subsystems.end()) {
-    m_impl->subsystems.erase(s);
+  if (auto registered = m_impl->FindSubsystem(subsystem)) {
+    m_impl->subsystems.erase(m_impl->subsystems.begin() +
+                             (registered - m_impl->subsystems.data()));
+  }
+}
+
+void CommandScheduler::SetPeriodicThreads(int threads,
+                                          bool allowInSimulation) {
+  m_impl->periodicPool.reset();
+  if (threads > 0 && (frc::RobotBase::IsReal() || allowInSimulation)) {
+    m_impl->periodicPool = std::make_unique<PeriodicPool>(threads);
+  }
+}
+
+void CommandScheduler::SetPeriodicIndependent(Subsystem* subsystem,
+                                              bool independent) {
+  auto registered = m_impl->FindSubsystem(subsystem);
+  if (!registered) {
+    RegisterSubsystem(subsystem);
+    registered = m_impl->FindSubsystem(subsystem);
   }
+  registered->independent = independent;
+}
+
+units::second_t CommandScheduler::GetPeriodicTime(
+    const Subsystem* subsystem) const {
+  auto registered = m_impl->FindSubsystem(subsystem);
+  if (!registered) {
+    return 0_s;
+  }
+  return registered->periodicTime;
 }
 
 void CommandScheduler::RegisterSubsystem(
@@ -277,9 +547,8 @@ void CommandScheduler::UnregisterSubsystem(
 }
 
 Command* CommandScheduler::GetDefaultCommand(const Subsystem* subsystem) const {
-  auto&& find = m_impl->subsystems.find(subsystem);
-  if (find != m_impl->subsystems.end()) {
-    return find->second.get();
+  if (auto registered = m_impl->FindSubsystem(subsystem)) {
+    return registered->defaultCommand.get();
   } else {
     return nullptr;
   }
@@ -291,17 +560,15 @@ void CommandScheduler::Cancel(Command* command) {
     return;
   }
 
-  auto find = m_impl->scheduledCommands.find(command);
-  if (find == m_impl->scheduledCommands.end()) return;
+  if (!m_impl->Find(command)) return;
   command->End(true);
   for (auto&& action : m_impl->interruptActions) {
     action(*command);
   }
-  m_impl->scheduledCommands.erase(find);
-  for (auto&& requirement : m_impl->requirements) {
-    if (requirement.second == command) {
-      m_impl->requirements.erase(requirement.first);
-    }
+  // End() or the actions may have scheduled other commands, so look the
+  // command up again rather than holding on to its position.
+  if (auto scheduled = m_impl->Find(command)) {
+    m_impl->Remove(scheduled);
   }
 }
 
@@ -319,16 +586,15 @@ void CommandScheduler::Cancel(std::initializer_list<Command*> commands) {
 
 void CommandScheduler::CancelAll() {
   wpi::SmallVector<Command*, 16> commands;
-  for (auto&& command : m_impl->scheduledCommands) {
-    commands.emplace_back(command.first);
+  for (auto&& scheduled : m_impl->scheduledCommands) {
+    commands.emplace_back(scheduled.command);
   }
   Cancel(commands);
 }
 
 double CommandScheduler::TimeSinceScheduled(const Command* command) const {
-  auto find = m_impl->scheduledCommands.find(command);
-  if (find != m_impl->scheduledCommands.end()) {
-    return find->second.TimeSinceInitialized();
+  if (auto scheduled = m_impl->Find(command)) {
+    return scheduled->state.TimeSinceInitialized();
   } else {
     return -1;
   }
@@ -354,14 +620,13 @@ bool CommandScheduler::IsScheduled(
 }
 
 bool CommandScheduler::IsScheduled(const Command* command) const {
-  return m_impl->scheduledCommands.find(command) !=
-         m_impl->scheduledCommands.end();
+  return m_impl->Find(command) != nullptr;
 }
 
 Command* CommandScheduler::Requiring(const Subsystem* subsystem) const {
-  auto find = m_impl->requirements.find(subsystem);
-  if (find != m_impl->requirements.end()) {
-    return find->second;
+  int index = RequirementMask::FindIndex(subsystem);
+  if (index >= 0 && static_cast<size_t>(index) < m_impl->requiring.size()) {
+    return m_impl->requiring[index];
   } else {
     return nullptr;
   }
@@ -400,8 +665,7 @@ void CommandScheduler::InitSendable(frc::SendableBuilder& builder) {
     for (auto cancel : toCancel) {
       uintptr_t ptrTmp = static_cast<uintptr_t>(cancel);
       Command* command = reinterpret_cast<Command*>(ptrTmp);
-      if (m_impl->scheduledCommands.find(command) !=
-          m_impl->scheduledCommands.end()) {
+      if (m_impl->Find(command)) {
         Cancel(command);
       }
       nt::NetworkTableEntry(cancelEntry)
@@ -410,9 +674,9 @@ void CommandScheduler::InitSendable(frc::SendableBuilder& builder) {
 
     wpi::SmallVector<std::string, 8> names;
     wpi::SmallVector<double, 8> ids;
-    for (auto&& command : m_impl->scheduledCommands) {
-      names.emplace_back(command.first->GetName());
-      uintptr_t ptrTmp = reinterpret_cast<uintptr_t>(command.first);
+    for (auto&& scheduled : m_impl->scheduledCommands) {
+      names.emplace_back(scheduled.command->GetName());
+      uintptr_t ptrTmp = reinterpret_cast<uintptr_t>(scheduled.command);
       ids.emplace_back(static_cast<double>(ptrTmp));
     }
     nt::NetworkTableEntry(namesEntry).SetStringArray(names);
@@ -422,5 +686,10 @@ void CommandScheduler::InitSendable(frc::SendableBuilder& builder) {
 
 void CommandScheduler::SetDefaultCommandImpl(Subsystem* subsystem,
                                              std::unique_ptr<Command> command) {
-  m_impl->subsystems[subsystem] = std::move(command);
+  if (auto registered = m_impl->FindSubsystem(subsystem)) {
+    registered->defaultCommand = std::move(command);
+    return;
+  }
+  m_impl->subsystems.push_back(
+      {subsystem, m_impl->GetIndex(subsystem), std::move(command)});
 }
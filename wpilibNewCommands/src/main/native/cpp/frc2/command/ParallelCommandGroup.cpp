@@ -15,41 +15,40 @@ ParallelCommandGroup::ParallelCommandGroup(
 }
 
 void ParallelCommandGroup::Initialize() {
-  for (auto& commandRunning : m_commands) {
-    commandRunning.first->Initialize();
-    commandRunning.second = true;
+  m_running.clear();
+  for (auto& command : m_commands) {
+    command->Initialize();
+    m_running.emplace_back(command.get());
   }
   isRunning = true;
 }
 
 void ParallelCommandGroup::Execute() {
-  for (auto& commandRunning : m_commands) {
-    if (!commandRunning.second) continue;
-    commandRunning.first->Execute();
-    if (commandRunning.first->IsFinished()) {
-      commandRunning.first->End(false);
-      commandRunning.second = false;
+  // Finished commands are dropped from the running list in place, so later
+  // iterations only touch the commands that are still running.
+  auto stillRunning = m_running.begin();
+  for (auto command : m_running) {
+    command->Execute();
+    if (command->IsFinished()) {
+      command->End(false);
+    } else {
+      *stillRunning++ = command;
     }
   }
+  m_running.erase(stillRunning, m_running.end());
 }
 
 void ParallelCommandGroup::End(bool interrupted) {
   if (interrupted) {
-    for (auto& commandRunning : m_commands) {
-      if (commandRunning.second) {
-        commandRunning.first->End(true);
-      }
+    for (auto command : m_running) {
+      command->End(true);
     }
   }
+  m_running.clear();
   isRunning = false;
 }
 
-bool ParallelCommandGroup::IsFinished() {
-  for (auto& command : m_commands) {
-    if (command.second) return false;
-  }
-  return true;
-}
+bool ParallelCommandGroup::IsFinished() { return m_running.empty(); }
 
 bool ParallelCommandGroup::RunsWhenDisabled() const {
   return m_runWhenDisabled;
@@ -72,7 +71,8 @@ void ParallelCommandGroup::AddCommands(
       command->SetGrouped(true);
       AddRequirements(command->GetRequirements());
       m_runWhenDisabled &= command->RunsWhenDisabled();
-      m_commands.emplace_back(std::move(command), false);
+      m_commands.emplace_back(std::move(command));
+      m_running.reserve(m_commands.size());
     } else {
       wpi_setWPIErrorWithContext(CommandIllegalUse,
                                  "Multiple commands in a parallel group cannot "
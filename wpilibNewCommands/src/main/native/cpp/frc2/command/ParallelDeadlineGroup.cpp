@@ -17,33 +17,37 @@ ParallelDeadlineGroup::ParallelDeadlineGroup(
 }
 
 void ParallelDeadlineGroup::Initialize() {
-  for (auto& commandRunning : m_commands) {
-    commandRunning.first->Initialize();
-    commandRunning.second = true;
+  m_running.clear();
+  for (auto& command : m_commands) {
+    command->Initialize();
+    m_running.emplace_back(command.get());
   }
   m_finished = false;
 }
 
 void ParallelDeadlineGroup::Execute() {
-  for (auto& commandRunning : m_commands) {
-    if (!commandRunning.second) continue;
-    commandRunning.first->Execute();
-    if (commandRunning.first->IsFinished()) {
-      commandRunning.first->End(false);
-      commandRunning.second = false;
-      if (commandRunning.first.get() == m_deadline) {
+  // Finished commands are dropped from the running list in place, so later
+  // iterations only touch the commands that are still running.
+  auto stillRunning = m_running.begin();
+  for (auto command : m_running) {
+    command->Execute();
+    if (command->IsFinished()) {
+      command->End(false);
+      if (command == m_deadline) {
         m_finished = true;
       }
+    } else {
+      *stillRunning++ = command;
     }
   }
+  m_running.erase(stillRunning, m_running.end());
 }
 
 void ParallelDeadlineGroup::End(bool interrupted) {
-  for (auto& commandRunning : m_commands) {
-    if (commandRunning.second) {
-      commandRunning.first->End(true);
-    }
+  for (auto command : m_running) {
+    command->End(true);
   }
+  m_running.clear();
 }
 
 bool ParallelDeadlineGroup::IsFinished() { return m_finished; }
@@ -69,7 +73,8 @@ void ParallelDeadlineGroup::AddCommands(
       command->SetGrouped(true);
       AddRequirements(command->GetRequirements());
       m_runWhenDisabled &= command->RunsWhenDisabled();
-      m_commands.emplace_back(std::move(command), false);
+      m_commands.emplace_back(std::move(command));
+      m_running.reserve(m_commands.size());
     } else {
       wpi_setWPIErrorWithContext(CommandIllegalUse,
                                  "Multiple commands in a parallel group cannot "
@@ -82,7 +87,8 @@ void ParallelDeadlineGroup::AddCommands(
 void ParallelDeadlineGroup::SetDeadline(std::unique_ptr<Command>&& deadline) {
   m_deadline = deadline.get();
   m_deadline->SetGrouped(true);
-  m_commands.emplace_back(std::move(deadline), false);
+  m_commands.emplace_back(std::move(deadline));
+  m_running.reserve(m_commands.size());
   AddRequirements(m_deadline->GetRequirements());
   m_runWhenDisabled &= m_deadline->RunsWhenDisabled();
 }
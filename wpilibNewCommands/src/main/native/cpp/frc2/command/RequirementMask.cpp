@@ -0,0 +1,74 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include "frc2/command/RequirementMask.h"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include <wpi/DenseMap.h>
+
+#include "frc2/command/Subsystem.h"
+
+using namespace frc2;
+
+namespace {
+struct IndexRegistry {
+  wpi::DenseMap<const Subsystem*, unsigned> indices;
+  // Released indices, as a min-heap so the lowest is reused first
+  std::vector<unsigned> free;
+  unsigned next = 0;
+  // Incremented whenever an index is released
+  uint64_t generation = 0;
+};
+
+IndexRegistry& GetRegistry() {
+  static IndexRegistry registry;
+  return registry;
+}
+}  // namespace
+
+unsigned RequirementMask::IndexOf(const Subsystem* subsystem) {
+  auto& registry = GetRegistry();
+  auto result = registry.indices.try_emplace(subsystem, 0);
+  if (result.second) {
+    if (registry.free.empty()) {
+      result.first->second = registry.next++;
+    } else {
+      std::pop_heap(registry.free.begin(), registry.free.end(),
+                    std::greater<unsigned>());
+      result.first->second = registry.free.back();
+      registry.free.pop_back();
+    }
+  }
+  return result.first->second;
+}
+
+int RequirementMask::FindIndex(const Subsystem* subsystem) {
+  auto& registry = GetRegistry();
+  auto find = registry.indices.find(subsystem);
+  if (find == registry.indices.end()) {
+    return -1;
+  }
+  return static_cast<int>(find->second);
+}
+
+void RequirementMask::ReleaseIndex(const Subsystem* subsystem) {
+  auto& registry = GetRegistry();
+  auto find = registry.indices.find(subsystem);
+  if (find == registry.indices.end()) {
+    return;
+  }
+  registry.free.push_back(find->second);
+  std::push_heap(registry.free.begin(), registry.free.end(),
+                 std::greater<unsigned>());
+  registry.indices.erase(find);
+  ++registry.generation;
+}
+
+uint64_t RequirementMask::Generation() { return GetRegistry().generation; }
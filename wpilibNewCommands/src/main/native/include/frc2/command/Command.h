@@ -13,11 +13,12 @@
 #include <string>
 
 #include <frc/ErrorBase.h>
-#include <units/units.h>
+#include <units/time.h>
 #include <wpi/ArrayRef.h>
 #include <wpi/Demangle.h>
 #include <wpi/SmallSet.h>
 
+#include "frc2/command/RequirementMask.h"
 #include "frc2/command/Subsystem.h"
 
 namespace frc2 {
@@ -102,6 +103,16 @@ class Command : public frc::ErrorBase {
    */
   virtual wpi::SmallSet<Subsystem*, 4> GetRequirements() const = 0;
 
+  /**
+   * Gets the set of subsystems used by this command as a RequirementMask,
+   * which the scheduler and the parallel groups use to check commands for
+   * conflicts.  The default implementation builds it from GetRequirements()
+   * on every call; CommandBase keeps it up to date as requirements are added.
+   *
+   * @return the mask of subsystems that are required
+   */
+  virtual RequirementMask GetRequirementMask() const;
+
   /**
    * Decorates this command with a timeout.  If the specified timeout is
    * exceeded before the command finishes normally, the command will be
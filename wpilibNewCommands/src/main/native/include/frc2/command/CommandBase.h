@@ -44,6 +44,8 @@ class CommandBase : public Command,
 
   wpi::SmallSet<Subsystem*, 4> GetRequirements() const override;
 
+  RequirementMask GetRequirementMask() const override;
+
   /**
    * Sets the name of this Command.
    *
@@ -77,5 +79,20 @@ class CommandBase : public Command,
  protected:
   CommandBase();
   wpi::SmallSet<Subsystem*, 4> m_requirements;
+
+ private:
+  // Kept up to date by AddRequirements(); rebuilt if m_requirements was
+  // changed directly, or if a subsystem index may have been reused since
+  mutable RequirementMask m_requirementMask;
+  mutable size_t m_requirementMaskSize = 0;
+  mutable uint64_t m_requirementMaskGeneration = 0;
+
+  bool IsRequirementMaskCurrent() const {
+    return m_requirementMaskSize == m_requirements.size() &&
+           m_requirementMaskGeneration == RequirementMask::Generation();
+  }
+
+  template <typename Range>
+  void AddRequirementsImpl(const Range& requirements);
 };
 }  // namespace frc2
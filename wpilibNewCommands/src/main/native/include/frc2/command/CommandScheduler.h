@@ -15,6 +15,7 @@
 #include <frc/WPIErrors.h>
 #include <frc/smartdashboard/Sendable.h>
 #include <frc/smartdashboard/SendableHelper.h>
+#include <units/time.h>
 #include <wpi/ArrayRef.h>
 #include <wpi/FunctionExtras.h>
 
@@ -162,6 +163,45 @@ class CommandScheduler final : public frc::Sendable,
   void UnregisterSubsystem(std::initializer_list<Subsystem*> subsystems);
   void UnregisterSubsystem(wpi::ArrayRef<Subsystem*> subsystems);
 
+  /**
+   * Sets the number of worker threads used to run the periodic methods of
+   * independent subsystems (see SetPeriodicIndependent()) concurrently.  The
+   * thread calling Run() runs the other subsystems' periodic methods in turn
+   * meanwhile, and then helps with the independent ones; all periodic methods
+   * have returned before buttons are polled and commands run.
+   *
+   * <p>In simulation, periodic methods are run in turn on the calling thread
+   * regardless, so simulation stays deterministic, unless allowInSimulation is
+   * true.
+   *
+   * @param threads           the number of worker threads; 0 (the default)
+   *                          runs every periodic method in turn on the thread
+   *                          calling Run()
+   * @param allowInSimulation run concurrently in simulation too
+   */
+  void SetPeriodicThreads(int threads, bool allowInSimulation = false);
+
+  /**
+   * Declares that a subsystem's periodic method is independent: it shares no
+   * state with any other subsystem, command or button binding, so it may run
+   * concurrently with them.  It also must not schedule or cancel commands, or
+   * register subsystems.  Registers the subsystem if it is not already
+   * registered.
+   *
+   * @param subsystem   the subsystem
+   * @param independent whether the subsystem is independent
+   */
+  void SetPeriodicIndependent(Subsystem* subsystem, bool independent = true);
+
+  /**
+   * Gets how long a registered subsystem's periodic method took the last time
+   * the scheduler ran.
+   *
+   * @param subsystem the subsystem
+   * @return the time taken, or 0 if the subsystem is not registered
+   */
+  units::second_t GetPeriodicTime(const Subsystem* subsystem) const;
+
   /**
    * Sets the default command for a subsystem.  Registers that subsystem if it
    * is not already registered.  Default commands will run whenever there is no
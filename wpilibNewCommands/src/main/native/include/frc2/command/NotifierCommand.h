@@ -11,7 +11,7 @@
 #include <initializer_list>
 
 #include <frc/Notifier.h>
-#include <units/units.h>
+#include <units/time.h>
 #include <wpi/ArrayRef.h>
 
 #include "frc2/command/CommandBase.h"
@@ -88,7 +88,9 @@ class ParallelCommandGroup
  private:
   void AddCommands(std::vector<std::unique_ptr<Command>>&& commands) override;
 
-  std::vector<std::pair<std::unique_ptr<Command>, bool>> m_commands;
+  std::vector<std::unique_ptr<Command>> m_commands;
+  // The commands that have not yet finished, in the order they were added.
+  std::vector<Command*> m_running;
   bool m_runWhenDisabled{true};
   bool isRunning = false;
 };
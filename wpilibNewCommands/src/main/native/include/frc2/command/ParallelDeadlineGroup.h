@@ -98,7 +98,9 @@ class ParallelDeadlineGroup
 
   void SetDeadline(std::unique_ptr<Command>&& deadline);
 
-  std::vector<std::pair<std::unique_ptr<Command>, bool>> m_commands;
+  std::vector<std::unique_ptr<Command>> m_commands;
+  // The commands that have not yet finished, in the order they were added.
+  std::vector<Command*> m_running;
   Command* m_deadline;
   bool m_runWhenDisabled{true};
   bool m_finished{true};
@@ -8,7 +8,7 @@
 #pragma once
 
 #include <frc/controller/ProfiledPIDController.h>
-#include <units/units.h>
+#include <units/time.h>
 
 #include "frc2/command/SubsystemBase.h"
 
@@ -0,0 +1,140 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <algorithm>
+
+#include <wpi/MathExtras.h>
+#include <wpi/SmallVector.h>
+
+namespace frc2 {
+class Subsystem;
+
+/**
+ * A set of subsystems, stored as a bitmask over an index assigned to each
+ * subsystem the first time it is used as a requirement.  Checking two sets of
+ * requirements for overlap is then a word-wise AND rather than a series of set
+ * lookups.  The first 128 subsystems are stored inline.
+ *
+ * <p>Indices are shared by every scheduler.  The index of a destroyed
+ * subsystem is given to the next new one, lowest first, so masks stay short
+ * even when subsystems are created and destroyed repeatedly.  Like the rest
+ * of the command framework, this is not thread safe.
+ */
+class RequirementMask {
+ public:
+  RequirementMask() = default;
+
+  /**
+   * Adds a subsystem to the set, assigning it an index if it doesn't have one.
+   *
+   * @param subsystem the subsystem to add
+   */
+  void Add(const Subsystem* subsystem) { Set(IndexOf(subsystem)); }
+
+  /**
+   * Adds the subsystem with the given index to the set.
+   *
+   * @param index the subsystem index
+   */
+  void Set(unsigned index) {
+    unsigned word = index / 64;
+    if (word >= m_words.size()) {
+      m_words.resize(word + 1, 0);
+    }
+    m_words[word] |= uint64_t{1} << (index % 64);
+  }
+
+  /**
+   * Whether the two sets have any subsystem in common.
+   */
+  bool Intersects(const RequirementMask& other) const {
+    size_t size = (std::min)(m_words.size(), other.m_words.size());
+    for (size_t i = 0; i < size; ++i) {
+      if ((m_words[i] & other.m_words[i]) != 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * Adds every subsystem in another set to this one.
+   */
+  void Merge(const RequirementMask& other) {
+    if (other.m_words.size() > m_words.size()) {
+      m_words.resize(other.m_words.size(), 0);
+    }
+    for (size_t i = 0; i < other.m_words.size(); ++i) {
+      m_words[i] |= other.m_words[i];
+    }
+  }
+
+  /**
+   * Removes every subsystem in another set from this one.
+   */
+  void Remove(const RequirementMask& other) {
+    size_t size = (std::min)(m_words.size(), other.m_words.size());
+    for (size_t i = 0; i < size; ++i) {
+      m_words[i] &= ~other.m_words[i];
+    }
+  }
+
+  /**
+   * Calls func with the index of every subsystem in the set, in index order.
+   */
+  template <typename F>
+  void ForEach(F&& func) const {
+    for (size_t i = 0; i < m_words.size(); ++i) {
+      uint64_t word = m_words[i];
+      while (word != 0) {
+        func(static_cast<unsigned>(i * 64 + wpi::countTrailingZeros(word)));
+        word &= word - 1;
+      }
+    }
+  }
+
+  /**
+   * Gets the index of a subsystem, assigning one if it doesn't have one.
+   *
+   * @param subsystem the subsystem
+   * @return the subsystem index
+   */
+  static unsigned IndexOf(const Subsystem* subsystem);
+
+  /**
+   * Gets the index of a subsystem without assigning one.
+   *
+   * @param subsystem the subsystem
+   * @return the subsystem index, or -1 if it doesn't have one
+   */
+  static int FindIndex(const Subsystem* subsystem);
+
+  /**
+   * Frees the index of a subsystem so it can be given to another subsystem.
+   * Called when the subsystem is destroyed.
+   *
+   * @param subsystem the subsystem
+   */
+  static void ReleaseIndex(const Subsystem* subsystem);
+
+  /**
+   * Gets the number of indices released so far.  A mask built before this
+   * changes may hold the index of a destroyed subsystem that now belongs to
+   * another one, so a cached mask must be rebuilt when it does.
+   *
+   * @return the registry generation
+   */
+  static uint64_t Generation();
+
+ private:
+  wpi::SmallVector<uint64_t, 2> m_words;
+};
+}  // namespace frc2
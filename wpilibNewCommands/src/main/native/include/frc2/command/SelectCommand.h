@@ -12,9 +12,9 @@
 #pragma warning(disable : 4521)
 #endif
 
+#include <algorithm>
 #include <memory>
 #include <type_traits>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -70,7 +70,8 @@ class SelectCommand : public CommandHelper<CommandBase, SelectCommand<Key>> {
     for (auto&& command : foo) {
       this->AddRequirements(command.second->GetRequirements());
       m_runsWhenDisabled &= command.second->RunsWhenDisabled();
-      m_commands.emplace(std::move(command.first), std::move(command.second));
+      m_commands.emplace_back(std::move(command.first),
+                              std::move(command.second));
     }
   }
 
@@ -87,7 +88,8 @@ class SelectCommand : public CommandHelper<CommandBase, SelectCommand<Key>> {
     for (auto&& command : commands) {
       this->AddRequirements(command.second->GetRequirements());
       m_runsWhenDisabled &= command.second->RunsWhenDisabled();
-      m_commands.emplace(std::move(command.first), std::move(command.second));
+      m_commands.emplace_back(std::move(command.first),
+                              std::move(command.second));
     }
   }
 
@@ -124,7 +126,9 @@ class SelectCommand : public CommandHelper<CommandBase, SelectCommand<Key>> {
   }
 
  private:
-  std::unordered_map<Key, std::unique_ptr<Command>> m_commands;
+  // Selections are usually a handful of enum values, so a linear scan over a
+  // contiguous list beats hashing the key on every Initialize().
+  std::vector<std::pair<Key, std::unique_ptr<Command>>> m_commands;
   std::function<Key()> m_selector;
   std::function<Command*()> m_toRun;
   Command* m_selectedCommand;
@@ -134,7 +138,10 @@ class SelectCommand : public CommandHelper<CommandBase, SelectCommand<Key>> {
 template <typename T>
 void SelectCommand<T>::Initialize() {
   if (m_selector) {
-    auto find = m_commands.find(m_selector());
+    auto key = m_selector();
+    auto find = std::find_if(
+        m_commands.begin(), m_commands.end(),
+        [&](const auto& command) { return command.first == key; });
     if (find == m_commands.end()) {
       m_selectedCommand = new PrintCommand(
           "SelectCommand selector value does not correspond to any command!");
@@ -7,7 +7,7 @@
 
 #pragma once
 
-#include <units/units.h>
+#include <units/time.h>
 
 #include "frc2/Timer.h"
 #include "frc2/command/CommandBase.h"
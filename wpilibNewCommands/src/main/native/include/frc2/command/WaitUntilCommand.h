@@ -9,7 +9,7 @@
 
 #include <functional>
 
-#include <units/units.h>
+#include <units/time.h>
 
 #include "frc2/command/CommandBase.h"
 #include "frc2/command/CommandHelper.h"
@@ -1,10 +1,12 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2019 FIRST. All Rights Reserved.                             */
+/* Copyright (c) 2019-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
 /*----------------------------------------------------------------------------*/
 
+#include <memory>
+
 #include "CommandTestBase.h"
 #include "frc2/command/CommandScheduler.h"
 #include "frc2/command/ConditionalCommand.h"
@@ -12,6 +14,7 @@
 #include "frc2/command/ParallelCommandGroup.h"
 #include "frc2/command/ParallelDeadlineGroup.h"
 #include "frc2/command/ParallelRaceGroup.h"
+#include "frc2/command/RequirementMask.h"
 #include "frc2/command/SelectCommand.h"
 #include "frc2/command/SequentialCommandGroup.h"
 
@@ -82,3 +85,95 @@ TEST_F(CommandRequirementsTest, DefaultCommandRequirementErrorTest) {
 
   EXPECT_TRUE(requirement1.GetDefaultCommand() == NULL);
 }
+
+TEST_F(CommandRequirementsTest, ManySubsystemsRequirementTest) {
+  CommandScheduler scheduler = GetScheduler();
+
+  std::vector<TestSubsystem> subsystems(130);
+  for (auto& subsystem : subsystems) {
+    scheduler.RegisterSubsystem(&subsystem);
+  }
+
+  MockCommand command1({&subsystems[3], &subsystems[129]});
+  MockCommand command2({&subsystems[64]});
+  MockCommand command3({&subsystems[128], &subsystems[129]});
+
+  scheduler.Schedule(&command1);
+  scheduler.Schedule(&command2);
+  EXPECT_TRUE(scheduler.IsScheduled({&command1, &command2}));
+  EXPECT_EQ(&command1, scheduler.Requiring(&subsystems[129]));
+  EXPECT_EQ(&command2, scheduler.Requiring(&subsystems[64]));
+
+  scheduler.Schedule(&command3);
+  EXPECT_FALSE(scheduler.IsScheduled(&command1));
+  EXPECT_TRUE(scheduler.IsScheduled({&command2, &command3}));
+  EXPECT_EQ(nullptr, scheduler.Requiring(&subsystems[3]));
+  EXPECT_EQ(&command3, scheduler.Requiring(&subsystems[128]));
+  EXPECT_EQ(&command3, scheduler.Requiring(&subsystems[129]));
+}
+
+TEST_F(CommandRequirementsTest, SubsystemIndexReuseTest) {
+  CommandScheduler scheduler = GetScheduler();
+
+  int first = -1;
+  for (int i = 0; i < 10; ++i) {
+    TestSubsystem requirement;
+    int index = RequirementMask::FindIndex(&requirement);
+    ASSERT_GE(index, 0);
+    if (first < 0) first = index;
+    EXPECT_EQ(first, index);
+
+    MockCommand command({&requirement});
+    EXPECT_EQ(nullptr, scheduler.Requiring(&requirement));
+    scheduler.Schedule(&command);
+    EXPECT_EQ(&command, scheduler.Requiring(&requirement));
+    scheduler.Cancel(&command);
+  }
+}
+
+TEST_F(CommandRequirementsTest, ReusedIndexNoFalseConflictTest) {
+  CommandScheduler scheduler = GetScheduler();
+
+  auto destroyed = std::make_unique<TestSubsystem>();
+  InstantCommand command([] {}, {destroyed.get()});
+  // caches the mask
+  command.GetRequirementMask();
+  int index = RequirementMask::FindIndex(destroyed.get());
+  ASSERT_GE(index, 0);
+  uint64_t generation = RequirementMask::Generation();
+
+  // the command outlives its subsystem, whose index goes to the next one
+  destroyed.reset();
+  EXPECT_NE(generation, RequirementMask::Generation());
+  TestSubsystem requirement;
+  EXPECT_EQ(index, RequirementMask::FindIndex(&requirement));
+
+  InstantCommand other([] {}, {&requirement});
+  EXPECT_TRUE(RequirementsDisjoint(&command, &other));
+  scheduler.Schedule(&other);
+  EXPECT_EQ(&other, scheduler.Requiring(&requirement));
+  scheduler.Cancel(&other);
+}
+
+TEST_F(CommandRequirementsTest, GroupRequirementMaskTest) {
+  TestSubsystem requirement1;
+  TestSubsystem requirement2;
+  TestSubsystem requirement3;
+
+  ParallelCommandGroup group(InstantCommand([] {}, {&requirement1}),
+                             InstantCommand([] {}, {&requirement2}));
+
+  RequirementMask mask1;
+  mask1.Add(&requirement1);
+  RequirementMask mask2;
+  mask2.Add(&requirement2);
+  RequirementMask mask3;
+  mask3.Add(&requirement3);
+
+  EXPECT_TRUE(group.GetRequirementMask().Intersects(mask1));
+  EXPECT_TRUE(group.GetRequirementMask().Intersects(mask2));
+  EXPECT_FALSE(group.GetRequirementMask().Intersects(mask3));
+
+  InstantCommand command([] {}, {&requirement2});
+  EXPECT_FALSE(RequirementsDisjoint(&group, &command));
+}
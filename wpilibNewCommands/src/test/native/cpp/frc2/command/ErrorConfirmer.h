@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2019 FIRST. All Rights Reserved.                             */
+/* Copyright (c) 2019-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -9,6 +9,7 @@
 
 #include <regex>
 
+#include <frc/ErrorReporter.h>
 #include <mockdata/MockHooks.h>
 
 #include "gmock/gmock.h"
@@ -18,12 +19,16 @@ class ErrorConfirmer {
  public:
   explicit ErrorConfirmer(const char* msg) : m_msg(msg) {
     if (instance != nullptr) return;
+    // Errors are sent asynchronously and repeats are suppressed, so start
+    // fresh here and wait for the send on destruction
+    frc::ErrorReporter::GetInstance().Reset();
     HALSIM_SetSendError(HandleError);
     EXPECT_CALL(*this, ConfirmError());
     instance = this;
   }
 
   ~ErrorConfirmer() {
+    frc::ErrorReporter::GetInstance().Flush();
     HALSIM_SetSendError(nullptr);
     instance = nullptr;
   }
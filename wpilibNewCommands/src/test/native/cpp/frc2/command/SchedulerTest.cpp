@@ -5,12 +5,42 @@
 /* the project.                                                               */
 /*----------------------------------------------------------------------------*/
 
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include <wpi/mutex.h>
+
 #include "CommandTestBase.h"
 #include "frc2/command/InstantCommand.h"
 #include "frc2/command/RunCommand.h"
 
 using namespace frc2;
-class SchedulerTest : public CommandTestBase {};
+class SchedulerTest : public CommandTestBase {
+ protected:
+  // Records the thread each Periodic() call ran on.
+  class ThreadSubsystem : public Subsystem {
+   public:
+    explicit ThreadSubsystem(std::chrono::milliseconds delay = {})
+        : m_delay{delay} {}
+
+    void Periodic() override {
+      std::this_thread::sleep_for(m_delay);
+      std::scoped_lock lock(m_mutex);
+      m_threads.push_back(std::this_thread::get_id());
+    }
+
+    std::vector<std::thread::id> GetThreads() {
+      std::scoped_lock lock(m_mutex);
+      return m_threads;
+    }
+
+   private:
+    std::chrono::milliseconds m_delay;
+    wpi::mutex m_mutex;
+    std::vector<std::thread::id> m_threads;
+  };
+};
 
 TEST_F(SchedulerTest, SchedulerLambdaTestNoInterrupt) {
   CommandScheduler scheduler = GetScheduler();
@@ -72,3 +102,82 @@ TEST_F(SchedulerTest, SchedulerCancelAllTest) {
 
   EXPECT_EQ(counter, 2);
 }
+
+TEST_F(SchedulerTest, SchedulerRunsCommandsInOrderTest) {
+  CommandScheduler scheduler = GetScheduler();
+
+  std::string order;
+
+  RunCommand command1([&order] { order += '1'; }, {});
+  RunCommand command2([&order] { order += '2'; }, {});
+  RunCommand command3([&order] { order += '3'; }, {});
+
+  scheduler.Schedule({&command2, &command1, &command3});
+  scheduler.Run();
+  scheduler.Cancel(&command1);
+  scheduler.Schedule(&command1);
+  scheduler.Run();
+
+  EXPECT_EQ(order, "213231");
+}
+
+TEST_F(SchedulerTest, ParallelPeriodicTest) {
+  CommandScheduler scheduler = GetScheduler();
+  scheduler.SetPeriodicThreads(2, true);
+
+  ThreadSubsystem system1{std::chrono::milliseconds(100)};
+  ThreadSubsystem system2{std::chrono::milliseconds(100)};
+  ThreadSubsystem system3{std::chrono::milliseconds(100)};
+  ThreadSubsystem dependent;
+  scheduler.SetPeriodicIndependent(&system1);
+  scheduler.SetPeriodicIndependent(&system2);
+  scheduler.SetPeriodicIndependent(&system3);
+  scheduler.RegisterSubsystem(&dependent);
+
+  auto start = std::chrono::steady_clock::now();
+  scheduler.Run();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+
+  // Three workers (two threads and the caller) share three subsystems
+  EXPECT_LT(elapsed, std::chrono::milliseconds(250));
+  for (auto* system : {&system1, &system2, &system3, &dependent}) {
+    EXPECT_EQ(system->GetThreads().size(), 1u);
+  }
+  EXPECT_EQ(dependent.GetThreads()[0], std::this_thread::get_id());
+  EXPECT_GE(scheduler.GetPeriodicTime(&system1), 100_ms);
+  EXPECT_LT(scheduler.GetPeriodicTime(&dependent), 100_ms);
+
+  scheduler.Run();
+  EXPECT_EQ(system1.GetThreads().size(), 2u);
+}
+
+TEST_F(SchedulerTest, SequentialPeriodicInSimulationTest) {
+  CommandScheduler scheduler = GetScheduler();
+  scheduler.SetPeriodicThreads(2);
+
+  ThreadSubsystem system1;
+  ThreadSubsystem system2;
+  scheduler.SetPeriodicIndependent(&system1);
+  scheduler.SetPeriodicIndependent(&system2);
+  scheduler.Run();
+
+  EXPECT_EQ(system1.GetThreads().at(0), std::this_thread::get_id());
+  EXPECT_EQ(system2.GetThreads().at(0), std::this_thread::get_id());
+}
+
+TEST_F(SchedulerTest, ParallelPeriodicExceptionTest) {
+  CommandScheduler scheduler = GetScheduler();
+  scheduler.SetPeriodicThreads(1, true);
+
+  class ThrowingSubsystem : public Subsystem {
+   public:
+    void Periodic() override { throw std::runtime_error("periodic"); }
+  };
+  ThrowingSubsystem throwing;
+  ThreadSubsystem system;
+  scheduler.SetPeriodicIndependent(&throwing);
+  scheduler.SetPeriodicIndependent(&system);
+
+  EXPECT_THROW(scheduler.Run(), std::runtime_error);
+  EXPECT_EQ(system.GetThreads().size(), 1u);
+}
@@ -0,0 +1,86 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include <vector>
+
+#include <units/acceleration.h>
+#include <units/length.h>
+#include <units/velocity.h>
+#include <wpi/math>
+
+#include "Benchmark.h"
+#include "frc/controller/ArmFeedforward.h"
+#include "frc/controller/PIDController.h"
+#include "frc/controller/PIDControllerBank.h"
+#include "frc/controller/SimpleMotorFeedforward.h"
+
+using namespace frc;
+
+// A robot's worth of loops: mostly drive/elevator style motors plus a few
+// arms, which pay for a cos() in their feedforward.
+static constexpr int kLoops = 16;
+static constexpr int kArms = 4;
+
+void frc::bench::RunControllerBenchmarks() {
+  SimpleMotorFeedforward<units::meters> motor{0.2_V, 2_V / 1_mps,
+                                              0.3_V / 1_mps_sq};
+  ArmFeedforward arm{0.2_V, 1.1_V, 0.8_V * 1_s / 1_rad,
+                     0.1_V * 1_s * 1_s / 1_rad};
+
+  std::vector<frc2::PIDController> controllers;
+  controllers.reserve(kLoops);
+  frc2::PIDControllerBank bank;
+  for (int i = 0; i < kLoops; ++i) {
+    controllers.emplace_back(1.5, 0.2, 0.05);
+    controllers.back().EnableContinuousInput(-wpi::math::pi, wpi::math::pi);
+    controllers.back().SetSetpoint(0.5);
+    bank.Add(1.5, 0.2, 0.05);
+    bank.EnableContinuousInput(i, -wpi::math::pi, wpi::math::pi);
+    if (i < kArms) {
+      bank.SetFeedforward(i, arm);
+    } else {
+      bank.SetFeedforward(i, motor);
+    }
+    bank.SetReference(i, 0.5, 1.0, 0.1);
+  }
+
+  std::vector<double> measurements(kLoops);
+  std::vector<double> outputs(kLoops);
+  double t = 0;
+
+  bench::Run("16 PIDController + feedforward", 100000, [&] {
+    t += 1e-4;
+    double sum = 0;
+    for (int i = 0; i < kLoops; ++i) {
+      double pid = controllers[i].Calculate(0.4 + t);
+      if (i < kArms) {
+        sum += pid + arm.Calculate(0.5_rad, 1_rad_per_s,
+                                   units::unit_t<ArmFeedforward::Acceleration>(
+                                       0.1))
+                         .to<double>();
+      } else {
+        sum += pid + motor.Calculate(1_mps, 0.1_mps_sq).to<double>();
+      }
+    }
+    return sum;
+  });
+
+  bench::Run("PIDControllerBank (16 loops)", 100000, [&] {
+    t += 1e-4;
+    for (auto& measurement : measurements) measurement = 0.4 + t;
+    bank.Calculate(measurements, outputs);
+    return outputs[0];
+  });
+
+  bank.SetCosineTableEnabled(true);
+  bench::Run("PIDControllerBank (16 loops, cos table)", 100000, [&] {
+    t += 1e-4;
+    for (auto& measurement : measurements) measurement = 0.4 + t;
+    bank.Calculate(measurements, outputs);
+    return outputs[0];
+  });
+}
@@ -0,0 +1,91 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include <cmath>
+#include <vector>
+
+#include "Benchmark.h"
+#include "frc/geometry/Pose2d.h"
+#include "frc/geometry/Pose2dBatch.h"
+#include "frc/trajectory/Trajectory.h"
+
+using namespace frc;
+
+static Trajectory MakeTrajectory(int numStates) {
+  std::vector<Trajectory::State> states;
+  states.reserve(numStates);
+  for (int i = 0; i < numStates; ++i) {
+    units::radian_t heading{0.001 * i};
+    states.push_back({units::second_t{0.01 * i}, 1_mps, 0_mps_sq,
+                      Pose2d{units::meter_t{std::cos(heading.to<double>())},
+                             units::meter_t{std::sin(heading.to<double>())},
+                             Rotation2d{heading}},
+                      curvature_t{1.0}});
+  }
+  return Trajectory{states};
+}
+
+void frc::bench::RunGeometryBenchmarks() {
+  const Transform2d step{Translation2d{0.01_m, 0.002_m}, Rotation2d{0.5_deg}};
+
+  Pose2d pose;
+  bench::Run("Pose2d composition", 1000000, [&] {
+    pose = pose + step;
+    return pose.Rotation().Cos();
+  });
+
+  bench::Run("Pose2d Exp/Log", 1000000, [&] {
+    auto twist = Pose2d{}.Log(pose);
+    pose = pose.Exp(twist);
+    return twist.dx.to<double>();
+  });
+
+  auto trajectory = MakeTrajectory(2000);
+  bench::Run("Trajectory::TransformBy (2000 states)", 1000, [&] {
+    auto transformed = trajectory.TransformBy(step);
+    return transformed.States().back().pose.Translation().X().to<double>();
+  });
+
+  bench::Run("Trajectory::RelativeTo (2000 states)", 1000, [&] {
+    auto relative = trajectory.RelativeTo(pose);
+    return relative.States().back().pose.Translation().X().to<double>();
+  });
+
+  std::vector<Pose2d> poses;
+  for (auto&& state : trajectory.States()) {
+    poses.push_back(state.pose);
+  }
+  Pose2dBatch batch{poses};
+
+  bench::Run("Pose2d + Transform2d loop (2000 poses)", 1000, [&] {
+    for (auto& p : poses) {
+      p = p + step;
+    }
+    return poses.back().Rotation().Cos();
+  });
+
+  bench::Run("Pose2dBatch::TransformBy (2000 poses)", 1000, [&] {
+    batch.TransformBy(step);
+    return batch.Cos().back();
+  });
+
+  Pose2dBatch ends{poses};
+  ends.TransformBy(step);
+  bench::Run("Pose2d Log/Exp loop (2000 poses)", 1000, [&] {
+    double sum = 0;
+    for (size_t i = 0; i < poses.size(); ++i) {
+      auto end = ends.Get(i);
+      sum += poses[i].Exp(poses[i].Log(end)).Rotation().Cos();
+    }
+    return sum;
+  });
+
+  bench::Run("Pose2dBatch Log/Exp (2000 poses)", 1000, [&] {
+    auto exp = batch.Exp(batch.Log(ends));
+    return exp.Cos().back();
+  });
+}
@@ -0,0 +1,72 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include <Eigen/Core>
+#include <units/acceleration.h>
+#include <units/length.h>
+#include <units/velocity.h>
+
+#include "Benchmark.h"
+#include "frc/system/LinearSystemId.h"
+#include "frc/system/LinearSystemLoop.h"
+
+using namespace frc;
+
+void frc::bench::RunStateSpaceBenchmarks() {
+  auto plant = LinearSystemId<units::meters>::IdentifyPositionSystem(
+      1.98_V / 1_mps, 0.2_V / 1_mps_sq);
+
+  // Offline cost, paid once at construction
+  bench::Run("LinearQuadraticRegulator<2, 1> construct", 1000, [&] {
+    LinearQuadraticRegulator<2, 1> controller{plant, {0.02, 0.4}, {12.0},
+                                              5_ms};
+    return controller.K(0, 0);
+  });
+  bench::Run("KalmanFilter<2, 1, 1> construct", 1000, [&] {
+    KalmanFilter<2, 1, 1> observer{plant, {0.05, 1.0}, {0.001}, 5_ms};
+    return observer.K(0, 0);
+  });
+
+  LinearQuadraticRegulator<2, 1> controller{plant, {0.02, 0.4}, {12.0}, 5_ms};
+  KalmanFilter<2, 1, 1> observer{plant, {0.05, 1.0}, {0.001}, 5_ms};
+  LinearSystemLoop<2, 1, 1> loop{plant, controller, observer, 12_V};
+
+  Eigen::Matrix<double, 2, 1> r;
+  r << 1.0, 0.0;
+  loop.SetNextR(r);
+  Eigen::Matrix<double, 1, 1> y;
+  y << 0.0;
+
+  bench::Run("LinearSystemLoop<2, 1, 1> Correct + Predict", 1000000, [&] {
+    y(0) += 1e-6;
+    loop.Correct(y);
+    loop.Predict();
+    return loop.U(0);
+  });
+
+  // The same update with dynamically sized matrices, as hand-written loops
+  // typically do, for comparison
+  Eigen::MatrixXd discA(2, 2), discB(2, 1), C = plant.C(), K = controller.K(),
+                  L = observer.K();
+  {
+    Eigen::Matrix<double, 2, 2> A;
+    Eigen::Matrix<double, 2, 1> B;
+    DiscretizeAB<2, 1>(plant.A(), plant.B(), 5_ms, &A, &B);
+    discA = A;
+    discB = B;
+  }
+  Eigen::VectorXd xHat = Eigen::VectorXd::Zero(2), rDyn = r,
+                  u = Eigen::VectorXd::Zero(1), yDyn = y;
+
+  bench::Run("Eigen::MatrixXd Correct + Predict", 1000000, [&] {
+    yDyn(0) += 1e-6;
+    xHat += L * (yDyn - C * xHat);
+    u = (K * (rDyn - xHat)).cwiseMax(-12.0).cwiseMin(12.0);
+    xHat = discA * xHat + discB * u;
+    return u(0);
+  });
+}
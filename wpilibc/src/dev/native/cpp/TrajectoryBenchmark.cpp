@@ -0,0 +1,54 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include <vector>
+
+#include "Benchmark.h"
+#include "frc/trajectory/TrajectoryGenerator.h"
+#include "frc/trajectory/TrajectoryReplanner.h"
+
+using namespace frc;
+
+void frc::bench::RunTrajectoryBenchmarks() {
+  TrajectoryConfig config{3_mps, 2_mps_sq};
+
+  // A typical autonomous path, and a retarget partway along it that moves
+  // the first remaining waypoint
+  std::vector<Pose2d> waypoints{Pose2d(0_m, 0_m, Rotation2d(0_deg)),
+                                Pose2d(2_m, 1_m, Rotation2d(30_deg)),
+                                Pose2d(4_m, 2_m, Rotation2d(0_deg)),
+                                Pose2d(6_m, 1_m, Rotation2d(-45_deg)),
+                                Pose2d(7_m, -1_m, Rotation2d(-90_deg))};
+  std::vector<Pose2d> newWaypoints{Pose2d(4_m, 2.5_m, Rotation2d(0_deg)),
+                                   Pose2d(6_m, 1_m, Rotation2d(-45_deg)),
+                                   Pose2d(7_m, -1_m, Rotation2d(-90_deg))};
+  auto current = TrajectoryGenerator::GenerateTrajectory(waypoints, config);
+
+  bench::Run("GenerateTrajectory (5 waypoints)", 200, [&] {
+    return TrajectoryGenerator::GenerateTrajectory(waypoints, config)
+        .TotalTime()
+        .to<double>();
+  });
+
+  TrajectoryReplanner replanner;
+  Trajectory replanned;
+  units::second_t t = 1_s;
+
+  bench::Run("TrajectoryReplanner::Replan (cold)", 200, [&] {
+    replanner.ClearCache();
+    replanner.Replan(current, t, newWaypoints, config, 1_s, &replanned);
+    return replanned.TotalTime().to<double>();
+  });
+
+  // Each call splices from a slightly later point, as a robot retargeting
+  // every loop would
+  bench::Run("TrajectoryReplanner::Replan (cached)", 200, [&] {
+    t += 1_ms;
+    replanner.Replan(current, t, newWaypoints, config, 1_s, &replanned);
+    return replanned.TotalTime().to<double>();
+  });
+}
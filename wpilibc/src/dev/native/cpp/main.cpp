@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2017-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2017-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -9,11 +9,16 @@
 
 #include <hal/HALBase.h>
 
+#include "Benchmark.h"
 #include "WPILibVersion.h"
 
 int main() {
   std::cout << "Hello World" << std::endl;
   std::cout << HAL_GetRuntimeType() << std::endl;
   std::cout << GetWPILibVersion() << std::endl;
+  frc::bench::RunGeometryBenchmarks();
+  frc::bench::RunControllerBenchmarks();
+  frc::bench::RunStateSpaceBenchmarks();
+  frc::bench::RunTrajectoryBenchmarks();
   return 0;
 }
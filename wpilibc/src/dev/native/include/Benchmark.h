@@ -0,0 +1,51 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <wpi/Format.h>
+#include <wpi/Twine.h>
+#include <wpi/raw_ostream.h>
+#include <wpi/timestamp.h>
+
+namespace frc::bench {
+
+/**
+ * Runs func the given number of times and prints the average time per call.
+ *
+ * The result of each call is written to a volatile sink so the compiler
+ * can't optimize the loop away.
+ *
+ * @param name       The name to print alongside the timing.
+ * @param iterations The number of times to call func.
+ * @param func       The function to time.
+ */
+template <typename F>
+void Run(const wpi::Twine& name, int iterations, F&& func) {
+  static volatile double sink;
+  uint64_t start = wpi::Now();
+  for (int i = 0; i < iterations; ++i) {
+    sink = func();
+  }
+  uint64_t elapsed = wpi::Now() - start;
+  wpi::outs() << name << ": "
+              << wpi::format("%.1f", elapsed * 1000.0 / iterations)
+              << " ns/iter\n";
+  wpi::outs().flush();
+}
+
+void RunGeometryBenchmarks();
+
+void RunControllerBenchmarks();
+
+void RunStateSpaceBenchmarks();
+
+void RunTrajectoryBenchmarks();
+
+}  // namespace frc::bench
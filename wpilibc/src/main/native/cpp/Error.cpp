@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2008-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2008-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -7,10 +7,7 @@
 
 #include "frc/Error.h"
 
-#include <wpi/Path.h>
-#include <wpi/StackTrace.h>
-
-#include "frc/DriverStation.h"
+#include "frc/ErrorReporter.h"
 #include "frc/Timer.h"
 #include "frc/Utility.h"
 
@@ -61,31 +58,21 @@ double Error::GetTimestamp() const { return m_timestamp; }
 void Error::Set(Code code, const wpi::Twine& contextMessage,
                 wpi::StringRef filename, wpi::StringRef function,
                 int lineNumber, const ErrorBase* originatingObject) {
-  bool report = true;
-
-  if (code == m_code && GetTime() - m_timestamp < 1) {
-    report = false;
-  }
-
   m_code = code;
   m_message = contextMessage.str();
   m_filename = filename;
   m_function = function;
   m_lineNumber = lineNumber;
   m_originatingObject = originatingObject;
+  m_timestamp = GetTime();
 
-  if (report) {
-    m_timestamp = GetTime();
-    Report();
-  }
+  // Repeats are suppressed by the reporter
+  Report();
 }
 
 void Error::Report() {
-  DriverStation::ReportError(
-      true, m_code, m_message,
-      m_function + wpi::Twine(" [") + wpi::sys::path::filename(m_filename) +
-          wpi::Twine(':') + wpi::Twine(m_lineNumber) + wpi::Twine(']'),
-      wpi::GetStackTrace(4));
+  ErrorReporter::GetInstance().Report(true, m_code, m_message, m_filename,
+                                      m_function, m_lineNumber, 4);
 }
 
 void Error::Clear() {
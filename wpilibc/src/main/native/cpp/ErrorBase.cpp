@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2008-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2008-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -7,10 +7,11 @@
 
 #include "frc/ErrorBase.h"
 
+#include <algorithm>
 #include <cerrno>
 #include <cstdio>
 #include <cstring>
-#include <set>
+#include <deque>
 
 #include <hal/FRCUsageReporting.h>
 #include <hal/HALBase.h>
@@ -24,13 +25,18 @@ using namespace frc;
 
 namespace {
 struct GlobalErrors {
+  // Only the latest error from each code and location is kept, oldest first
+  static constexpr size_t kMaxErrors = 100;
+
   wpi::mutex mutex;
-  std::set<Error> errors;
-  const Error* lastError{nullptr};
+  std::deque<Error> errors;
 
   static GlobalErrors& GetInstance();
   static void Insert(const Error& error);
   static void Insert(Error&& error);
+
+ private:
+  void InsertLocked(Error&& error);
 };
 }  // namespace
 
@@ -39,16 +45,26 @@ GlobalErrors& GlobalErrors::GetInstance() {
   return inst;
 }
 
-void GlobalErrors::Insert(const Error& error) {
-  GlobalErrors& inst = GetInstance();
-  std::scoped_lock lock(inst.mutex);
-  inst.lastError = &(*inst.errors.insert(error).first);
-}
+void GlobalErrors::Insert(const Error& error) { Insert(Error{error}); }
 
 void GlobalErrors::Insert(Error&& error) {
   GlobalErrors& inst = GetInstance();
   std::scoped_lock lock(inst.mutex);
-  inst.lastError = &(*inst.errors.insert(std::move(error)).first);
+  inst.InsertLocked(std::move(error));
+}
+
+void GlobalErrors::InsertLocked(Error&& error) {
+  auto it = std::find_if(errors.begin(), errors.end(), [&](const Error& e) {
+    return e.GetCode() == error.GetCode() &&
+           e.GetLineNumber() == error.GetLineNumber() &&
+           e.GetFilename() == error.GetFilename();
+  });
+  if (it != errors.end()) {
+    errors.erase(it);
+  } else if (errors.size() >= kMaxErrors) {
+    errors.pop_front();
+  }
+  errors.emplace_back(std::move(error));
 }
 
 ErrorBase::ErrorBase() { HAL_Initialize(500, 0); }
@@ -167,21 +183,18 @@ void ErrorBase::SetGlobalWPIError(const wpi::Twine& errorMessage,
 Error ErrorBase::GetGlobalError() {
   auto& inst = GlobalErrors::GetInstance();
   std::scoped_lock mutex(inst.mutex);
-  if (!inst.lastError) return Error{};
-  return *inst.lastError;
+  if (inst.errors.empty()) return Error{};
+  return inst.errors.back();
 }
 
 std::vector<Error> ErrorBase::GetGlobalErrors() {
   auto& inst = GlobalErrors::GetInstance();
   std::scoped_lock mutex(inst.mutex);
-  std::vector<Error> rv;
-  for (auto&& error : inst.errors) rv.push_back(error);
-  return rv;
+  return std::vector<Error>(inst.errors.begin(), inst.errors.end());
 }
 
 void ErrorBase::ClearGlobalErrors() {
   auto& inst = GlobalErrors::GetInstance();
   std::scoped_lock mutex(inst.mutex);
   inst.errors.clear();
-  inst.lastError = nullptr;
 }
@@ -0,0 +1,272 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include "frc/ErrorReporter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <wpi/Path.h>
+#include <wpi/SmallString.h>
+#include <wpi/StackTrace.h>
+#include <wpi/StringMap.h>
+#include <wpi/ThreadHooks.h>
+#include <wpi/condition_variable.h>
+#include <wpi/raw_ostream.h>
+#include <wpi/timestamp.h>
+
+#include "frc/DriverStation.h"
+
+using namespace frc;
+
+namespace {
+struct Location {
+  std::shared_ptr<const std::string> stack;
+  uint64_t lastReport;
+  uint64_t suppressed = 0;
+};
+
+struct Pending {
+  bool isError;
+  int32_t code;
+  std::string message;
+  std::string filename;
+  std::string function;
+  int lineNumber;
+  uint64_t repeats;
+  std::shared_ptr<const std::string> stack;
+};
+}  // namespace
+
+class ErrorReporter::Thread : public wpi::SafeThread {
+ public:
+  explicit Thread(SendFunc send) : m_send(std::move(send)) {}
+
+  // Adds a report to the send queue.  Called with the mutex held.
+  bool Enqueue(Pending&& pending);
+
+  SendFunc m_send;
+
+  // Keyed by code, line number and filename
+  wpi::StringMap<Location> m_locations;
+  std::deque<Pending> m_pending;
+  uint64_t m_repeatPeriod = 1000000;  // in microseconds
+
+  // Token bucket rate limiter
+  double m_rate = 10;
+  double m_burst = 20;
+  double m_tokens = 20;
+  uint64_t m_lastRefill = wpi::Now();
+
+  uint64_t m_suppressed = 0;
+  uint64_t m_dropped = 0;
+  uint64_t m_droppedReported = 0;
+
+  // Signaled when the queue has drained and nothing is being sent
+  bool m_sending = false;
+  wpi::condition_variable m_idle;
+
+ private:
+  void Main() override;
+  void Send(const Pending& pending);
+};
+
+bool ErrorReporter::Thread::Enqueue(Pending&& pending) {
+  if (m_pending.size() >= kMaxPending) {
+    ++m_dropped;
+    return false;
+  }
+  m_pending.emplace_back(std::move(pending));
+  m_cond.notify_one();
+  return true;
+}
+
+void ErrorReporter::Thread::Main() {
+  wpi::SetCurrentThreadName("ErrorReporter");
+
+  std::unique_lock lock(m_mutex);
+
+  while (m_active) {
+    if (m_pending.empty() && m_dropped == m_droppedReported) {
+      m_idle.notify_all();
+      m_cond.wait(lock);
+      continue;
+    }
+
+    uint64_t now = wpi::Now();
+    m_tokens =
+        std::min(m_burst, m_tokens + (now - m_lastRefill) * 1.0e-6 * m_rate);
+    m_lastRefill = now;
+    if (m_tokens < 1) {
+      // Wait for the next token (or a change to the rate limit)
+      m_cond.wait_for(lock, std::chrono::microseconds(static_cast<int64_t>(
+                                (1 - m_tokens) / m_rate * 1.0e6) +
+                            1));
+      continue;
+    }
+    m_tokens -= 1;
+
+    if (!m_pending.empty()) {
+      Pending pending = std::move(m_pending.front());
+      m_pending.pop_front();
+      m_sending = true;
+      lock.unlock();
+      Send(pending);
+      lock.lock();
+      m_sending = false;
+    } else {
+      // Once the queue has drained, say how much was lost
+      uint64_t dropped = m_dropped - m_droppedReported;
+      m_droppedReported = m_dropped;
+      m_sending = true;
+      lock.unlock();
+      m_send(false, 0, wpi::Twine(dropped) + " error reports dropped",
+             "ErrorReporter", "");
+      lock.lock();
+      m_sending = false;
+    }
+  }
+}
+
+void ErrorReporter::Thread::Send(const Pending& pending) {
+  wpi::SmallString<128> details;
+  wpi::raw_svector_ostream os(details);
+  os << pending.message;
+  if (pending.repeats > 0) os << " (repeated " << pending.repeats << " times)";
+
+  m_send(pending.isError, pending.code, os.str(),
+         pending.function + wpi::Twine(" [") +
+             wpi::sys::path::filename(pending.filename) + wpi::Twine(':') +
+             wpi::Twine(pending.lineNumber) + wpi::Twine(']'),
+         *pending.stack);
+}
+
+ErrorReporter& ErrorReporter::GetInstance() {
+  static ErrorReporter inst(
+      [](bool isError, int32_t code, const wpi::Twine& details,
+         const wpi::Twine& location, const wpi::Twine& callStack) {
+        DriverStation::ReportError(isError, code, details, location,
+                                   callStack);
+      });
+  return inst;
+}
+
+ErrorReporter::ErrorReporter(SendFunc send) { m_owner.Start(std::move(send)); }
+
+ErrorReporter::~ErrorReporter() = default;
+
+bool ErrorReporter::Report(bool isError, int32_t code,
+                           const wpi::Twine& message, wpi::StringRef filename,
+                           wpi::StringRef function, int lineNumber,
+                           int stackOffset) {
+  wpi::SmallString<128> key;
+  wpi::raw_svector_ostream keyOs(key);
+  keyOs << code << ':' << lineNumber << ':' << filename;
+  uint64_t now = wpi::Now();
+
+  Pending pending{isError, code, {}, {}, {}, lineNumber, 0, nullptr};
+
+  {
+    auto thr = m_owner.GetThread();
+    if (!thr) return false;
+    auto it = thr->m_locations.find(keyOs.str());
+    if (it != thr->m_locations.end()) {
+      auto& location = it->getValue();
+      if (now - location.lastReport < thr->m_repeatPeriod ||
+          thr->m_pending.size() >= kMaxPending) {
+        // Nothing but the count is touched for a repeat
+        ++location.suppressed;
+        ++thr->m_suppressed;
+        return false;
+      }
+      location.lastReport = now;
+      pending.repeats = location.suppressed;
+      location.suppressed = 0;
+      pending.stack = location.stack;
+      pending.message = message.str();
+      pending.filename = filename;
+      pending.function = function;
+      return thr->Enqueue(std::move(pending));
+    }
+  }
+
+  // First occurrence; capture the stack trace without holding the lock
+  pending.stack = std::make_shared<const std::string>(
+      wpi::GetStackTrace(stackOffset + 1));
+  pending.message = message.str();
+  pending.filename = filename;
+  pending.function = function;
+
+  auto thr = m_owner.GetThread();
+  if (!thr) return false;
+  auto& locations = thr->m_locations;
+  if (locations.count(keyOs.str()) != 0) {
+    // Another thread reported the same error first
+    ++locations[keyOs.str()].suppressed;
+    ++thr->m_suppressed;
+    return false;
+  }
+  if (locations.size() >= kMaxLocations) {
+    // Forget the location that was reported longest ago
+    auto oldest = std::min_element(
+        locations.begin(), locations.end(), [](const auto& a, const auto& b) {
+          return a.getValue().lastReport < b.getValue().lastReport;
+        });
+    locations.erase(oldest);
+  }
+  auto& location = locations[keyOs.str()];
+  location.stack = pending.stack;
+  location.lastReport = now;
+  return thr->Enqueue(std::move(pending));
+}
+
+void ErrorReporter::SetRepeatPeriod(units::second_t period) {
+  auto thr = m_owner.GetThread();
+  if (!thr) return;
+  thr->m_repeatPeriod = static_cast<uint64_t>(period.to<double>() * 1.0e6);
+}
+
+void ErrorReporter::SetRateLimit(double rate, int burst) {
+  auto thr = m_owner.GetThread();
+  if (!thr) return;
+  thr->m_rate = std::max(rate, 1.0e-3);
+  thr->m_burst = std::max(burst, 1);
+  thr->m_tokens = std::min(thr->m_tokens, thr->m_burst);
+  thr->m_cond.notify_one();
+}
+
+void ErrorReporter::Flush() {
+  auto thr = m_owner.GetThread();
+  if (!thr) return;
+  thr->m_idle.wait(thr.GetLock(), [&] {
+    return !thr->m_active ||
+           (thr->m_pending.empty() && !thr->m_sending &&
+            thr->m_dropped == thr->m_droppedReported);
+  });
+}
+
+void ErrorReporter::Reset() {
+  auto thr = m_owner.GetThread();
+  if (!thr) return;
+  thr->m_locations.clear();
+}
+
+uint64_t ErrorReporter::GetSuppressedCount() const {
+  auto thr = m_owner.GetThread();
+  if (!thr) return 0;
+  return thr->m_suppressed;
+}
+
+uint64_t ErrorReporter::GetDroppedCount() const {
+  auto thr = m_owner.GetThread();
+  if (!thr) return 0;
+  return thr->m_dropped;
+}
@@ -13,6 +13,7 @@
 #include <hal/FRCUsageReporting.h>
 #include <wpi/Format.h>
 #include <wpi/SmallString.h>
+#include <wpi/Trace.h>
 #include <wpi/raw_ostream.h>
 
 #include "frc/DriverStation.h"
@@ -91,6 +92,7 @@ void IterativeRobotBase::TestPeriodic() {
 }
 
 void IterativeRobotBase::LoopFunc() {
+  wpi::TraceScope trace{"IterativeRobotBase::LoopFunc"};
   m_watchdog.Reset();
 
   // Call the appropriate function depending upon the current robot mode
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2008-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2008-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -12,6 +12,8 @@
 #include <hal/FRCUsageReporting.h>
 #include <hal/Notifier.h>
 #include <wpi/SmallString.h>
+#include <wpi/ThreadHooks.h>
+#include <wpi/Trace.h>
 
 #include "frc/Timer.h"
 #include "frc/Utility.h"
@@ -28,6 +30,7 @@ Notifier::Notifier(std::function<void()> handler) {
   wpi_setHALError(status);
 
   m_thread = std::thread([=] {
+    wpi::SetCurrentThreadName("Notifier");
     for (;;) {
       int32_t status = 0;
       HAL_NotifierHandle notifier = m_notifier.load();
@@ -49,7 +52,10 @@ Notifier::Notifier(std::function<void()> handler) {
       }
 
       // call callback
-      if (handler) handler();
+      if (handler) {
+        wpi::TraceScope trace{"Notifier"};
+        handler();
+      }
     }
   });
 }
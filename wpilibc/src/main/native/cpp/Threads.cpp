@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -7,8 +7,12 @@
 
 #include "frc/Threads.h"
 
+#include <utility>
+
 #include <hal/FRCUsageReporting.h>
 #include <hal/Threads.h>
+#include <wpi/SmallVector.h>
+#include <wpi/ThreadHooks.h>
 
 #include "frc/ErrorBase.h"
 
@@ -48,4 +52,34 @@ bool SetCurrentThreadPriority(bool realTime, int priority) {
   return ret;
 }
 
+bool SetThreadAffinity(std::thread& thread, wpi::ArrayRef<int> cpus) {
+  int32_t status = 0;
+  wpi::SmallVector<int32_t, 8> halCpus(cpus.begin(), cpus.end());
+  auto native = thread.native_handle();
+  auto ret = HAL_SetThreadAffinity(&native, halCpus.data(), halCpus.size(),
+                                   &status);
+  wpi_setGlobalHALError(status);
+  return ret;
+}
+
+bool SetCurrentThreadAffinity(wpi::ArrayRef<int> cpus) {
+  int32_t status = 0;
+  wpi::SmallVector<int32_t, 8> halCpus(cpus.begin(), cpus.end());
+  auto ret =
+      HAL_SetCurrentThreadAffinity(halCpus.data(), halCpus.size(), &status);
+  wpi_setGlobalHALError(status);
+  return ret;
+}
+
+bool LockMemory(int stackSize) {
+  int32_t status = 0;
+  auto ret = HAL_LockMemory(stackSize, &status);
+  wpi_setGlobalHALError(status);
+  return ret;
+}
+
+void SetThreadPlacementPolicy(std::function<void(wpi::StringRef name)> policy) {
+  wpi::SetThreadStartHook(std::move(policy));
+}
+
 }  // namespace frc
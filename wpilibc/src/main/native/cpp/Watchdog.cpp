@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2018-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2018-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -9,6 +9,7 @@
 
 #include <wpi/Format.h>
 #include <wpi/PriorityQueue.h>
+#include <wpi/ThreadHooks.h>
 #include <wpi/raw_ostream.h>
 
 using namespace frc;
@@ -32,6 +33,8 @@ class Watchdog::Thread : public wpi::SafeThread {
 };
 
 void Watchdog::Thread::Main() {
+  wpi::SetCurrentThreadName("Watchdog");
+
   std::unique_lock lock(m_mutex);
 
   while (m_active) {
@@ -0,0 +1,237 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include "frc/controller/PIDControllerBank.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include <wpi/MathExtras.h>
+#include <wpi/math>
+
+using namespace frc2;
+
+namespace {
+
+// cos() sampled over one turn; the extra entry lets the last interval
+// interpolate without wrapping the index.
+class CosineTable {
+ public:
+  static constexpr int kSize = 1024;
+
+  CosineTable() {
+    for (int i = 0; i <= kSize; ++i) {
+      m_table[i] = std::cos(i * 2 * wpi::math::pi / kSize);
+    }
+  }
+
+  double operator()(double radians) const {
+    double turns = radians * (kSize / (2 * wpi::math::pi));
+    double floor = std::floor(turns);
+    double frac = turns - floor;
+    // kSize is a power of two, so masking wraps negative angles as well
+    int i = static_cast<int>(static_cast<int64_t>(floor) & (kSize - 1));
+    return m_table[i] + frac * (m_table[i + 1] - m_table[i]);
+  }
+
+ private:
+  std::array<double, kSize + 1> m_table;
+};
+
+// std::round() is a libm call on baseline x86-64 and ARMv7; a truncating
+// conversion compiles to a single instruction.
+inline double RoundToInt(double x) {
+  return static_cast<double>(static_cast<int64_t>(x + (x < 0 ? -0.5 : 0.5)));
+}
+
+// Throws if an array passed to Calculate() doesn't have one element per loop.
+void CheckSize(const char* name, size_t expected, size_t actual) {
+  if (expected != actual) {
+    throw std::invalid_argument(
+        std::string{"PIDControllerBank::Calculate: "} + name + " has " +
+        std::to_string(actual) + " elements, expected " +
+        std::to_string(expected));
+  }
+}
+
+const CosineTable& GetCosineTable() {
+  static const CosineTable table;
+  return table;
+}
+
+}  // namespace
+
+PIDControllerBank::PIDControllerBank(units::second_t period)
+    : m_period(period), m_invPeriod(1.0 / period.to<double>()) {}
+
+size_t PIDControllerBank::Add(double Kp, double Ki, double Kd) {
+  size_t index = m_Kp.size();
+  m_Kp.push_back(Kp);
+  m_Ki.push_back(Ki);
+  m_Kd.push_back(Kd);
+  m_kS.push_back(0);
+  m_kV.push_back(0);
+  m_kA.push_back(0);
+  m_kCos.push_back(0);
+  m_minimumIntegral.push_back(-1.0);
+  m_maximumIntegral.push_back(1.0);
+  m_integralLower.push_back(0);
+  m_integralUpper.push_back(0);
+  m_minimumInput.push_back(0);
+  m_maximumInput.push_back(0);
+  m_inputRange.push_back(0);
+  m_invInputRange.push_back(0);
+  m_positionTolerance.push_back(0.05);
+  m_velocityTolerance.push_back(std::numeric_limits<double>::infinity());
+  m_setpoint.push_back(0);
+  m_velocity.push_back(0);
+  m_acceleration.push_back(0);
+  m_positionError.push_back(0);
+  m_velocityError.push_back(0);
+  m_totalError.push_back(0);
+  UpdateIntegralBounds(index);
+  return index;
+}
+
+void PIDControllerBank::SetPID(size_t index, double Kp, double Ki, double Kd) {
+  m_Kp[index] = Kp;
+  m_Ki[index] = Ki;
+  m_Kd[index] = Kd;
+  UpdateIntegralBounds(index);
+}
+
+void PIDControllerBank::SetFeedforward(size_t index,
+                                       const frc::ArmFeedforward& feedforward) {
+  SetFeedforward(index, feedforward.kS.to<double>(),
+                 feedforward.kV.to<double>(), feedforward.kA.to<double>(),
+                 feedforward.kCos.to<double>());
+}
+
+void PIDControllerBank::SetFeedforward(size_t index, double kS, double kV,
+                                       double kA, double kCos) {
+  m_kS[index] = kS;
+  m_kV[index] = kV;
+  m_kA[index] = kA;
+  m_kCos[index] = kCos;
+}
+
+void PIDControllerBank::EnableContinuousInput(size_t index,
+                                              double minimumInput,
+                                              double maximumInput) {
+  m_minimumInput[index] = minimumInput;
+  m_maximumInput[index] = maximumInput;
+  double range = maximumInput - minimumInput;
+  if (range > 0) {
+    m_inputRange[index] = range;
+    m_invInputRange[index] = 1.0 / range;
+    m_setpoint[index] =
+        std::clamp(m_setpoint[index], minimumInput, maximumInput);
+  }
+}
+
+void PIDControllerBank::DisableContinuousInput(size_t index) {
+  m_inputRange[index] = 0;
+  m_invInputRange[index] = 0;
+}
+
+void PIDControllerBank::SetIntegratorRange(size_t index,
+                                           double minimumIntegral,
+                                           double maximumIntegral) {
+  m_minimumIntegral[index] = minimumIntegral;
+  m_maximumIntegral[index] = maximumIntegral;
+  UpdateIntegralBounds(index);
+}
+
+void PIDControllerBank::SetTolerance(size_t index, double positionTolerance,
+                                     double velocityTolerance) {
+  m_positionTolerance[index] = positionTolerance;
+  m_velocityTolerance[index] = velocityTolerance;
+}
+
+void PIDControllerBank::SetReference(size_t index, double position,
+                                     double velocity, double acceleration) {
+  if (m_inputRange[index] > 0) {
+    position =
+        std::clamp(position, m_minimumInput[index], m_maximumInput[index]);
+  }
+  m_setpoint[index] = position;
+  m_velocity[index] = velocity;
+  m_acceleration[index] = acceleration;
+}
+
+bool PIDControllerBank::AtSetpoint(size_t index) const {
+  return std::abs(m_positionError[index]) < m_positionTolerance[index] &&
+         std::abs(m_velocityError[index]) < m_velocityTolerance[index];
+}
+
+void PIDControllerBank::Calculate(wpi::ArrayRef<double> measurements,
+                                  wpi::MutableArrayRef<double> outputs) {
+  size_t size = Size();
+  CheckSize("measurements", size, measurements.size());
+  CheckSize("outputs", size, outputs.size());
+  double period = m_period.to<double>();
+
+  for (size_t i = 0; i < size; ++i) {
+    // Wrap into [-range/2, range/2]; a no-op when the input isn't continuous
+    double error = m_setpoint[i] - measurements[i];
+    double turns = error * m_invInputRange[i];
+    error -= m_inputRange[i] * RoundToInt(turns);
+
+    double velocityError = (error - m_positionError[i]) * m_invPeriod;
+    m_positionError[i] = error;
+    m_velocityError[i] = velocityError;
+
+    // The bounds collapse to zero when Ki is zero, so the term drops out
+    double totalError = m_totalError[i] + error * period;
+    totalError = std::max(m_integralLower[i],
+                          std::min(totalError, m_integralUpper[i]));
+    m_totalError[i] = totalError;
+
+    double velocity = m_velocity[i];
+    outputs[i] = m_Kp[i] * error + m_Ki[i] * totalError +
+                 m_Kd[i] * velocityError + m_kS[i] * wpi::sgn(velocity) +
+                 m_kV[i] * velocity + m_kA[i] * m_acceleration[i];
+  }
+
+  // The gravity term is the only transcendental one; most banks have few arm
+  // loops, so it's applied in a separate pass that skips the others.
+  if (m_useCosineTable) {
+    const auto& table = GetCosineTable();
+    for (size_t i = 0; i < size; ++i) {
+      if (m_kCos[i] != 0) outputs[i] += m_kCos[i] * table(m_setpoint[i]);
+    }
+  } else {
+    for (size_t i = 0; i < size; ++i) {
+      if (m_kCos[i] != 0) outputs[i] += m_kCos[i] * std::cos(m_setpoint[i]);
+    }
+  }
+}
+
+void PIDControllerBank::Reset() {
+  std::fill(m_positionError.begin(), m_positionError.end(), 0.0);
+  std::fill(m_totalError.begin(), m_totalError.end(), 0.0);
+}
+
+void PIDControllerBank::Reset(size_t index) {
+  m_positionError[index] = 0;
+  m_totalError[index] = 0;
+}
+
+void PIDControllerBank::UpdateIntegralBounds(size_t index) {
+  double Ki = m_Ki[index];
+  if (Ki != 0) {
+    m_integralLower[index] = m_minimumIntegral[index] / Ki;
+    m_integralUpper[index] = m_maximumIntegral[index] / Ki;
+  } else {
+    m_integralLower[index] = 0;
+    m_integralUpper[index] = 0;
+  }
+}
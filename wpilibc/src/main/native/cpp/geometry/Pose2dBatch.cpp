@@ -0,0 +1,285 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include "frc/geometry/Pose2dBatch.h"
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+using namespace frc;
+
+namespace {
+
+// Throws if two batches that are processed pairwise differ in size.
+void CheckSize(const char* func, size_t expected, size_t actual) {
+  if (expected != actual) {
+    throw std::invalid_argument(std::string{"Pose2dBatch::"} + func +
+                                ": batch sizes differ (" +
+                                std::to_string(expected) + " and " +
+                                std::to_string(actual) + ")");
+  }
+}
+
+// One Newton step of 1/sqrt(x) around x = 1, as in Rotation2d::RotateBy(), so
+// rounding error doesn't accumulate when a batch is transformed repeatedly.
+inline double UnitScale(double c, double s) {
+  return 1.5 - 0.5 * (c * c + s * s);
+}
+
+}  // namespace
+
+void Twist2dBatch::Resize(size_t size) {
+  dx.resize(size, 0.0);
+  dy.resize(size, 0.0);
+  dtheta.resize(size, 0.0);
+}
+
+Twist2d Twist2dBatch::Get(size_t i) const {
+  return {units::meter_t{dx[i]}, units::meter_t{dy[i]},
+          units::radian_t{dtheta[i]}};
+}
+
+void Twist2dBatch::Set(size_t i, const Twist2d& twist) {
+  dx[i] = twist.dx.to<double>();
+  dy[i] = twist.dy.to<double>();
+  dtheta[i] = twist.dtheta.to<double>();
+}
+
+Pose2dBatch::Pose2dBatch(size_t size) { Resize(size); }
+
+Pose2dBatch::Pose2dBatch(wpi::ArrayRef<Pose2d> poses) {
+  Resize(poses.size());
+  for (size_t i = 0; i < poses.size(); ++i) {
+    Set(i, poses[i]);
+  }
+}
+
+void Pose2dBatch::Resize(size_t size) {
+  m_x.resize(size, 0.0);
+  m_y.resize(size, 0.0);
+  m_cos.resize(size, 1.0);
+  m_sin.resize(size, 0.0);
+}
+
+Pose2d Pose2dBatch::Get(size_t i) const {
+  return {units::meter_t{m_x[i]}, units::meter_t{m_y[i]},
+          Rotation2d{m_cos[i], m_sin[i]}};
+}
+
+void Pose2dBatch::Set(size_t i, const Pose2d& pose) {
+  m_x[i] = pose.Translation().X().to<double>();
+  m_y[i] = pose.Translation().Y().to<double>();
+  m_cos[i] = pose.Rotation().Cos();
+  m_sin[i] = pose.Rotation().Sin();
+}
+
+void Pose2dBatch::TransformBy(const Transform2d& transform) {
+  const double tx = transform.Translation().X().to<double>();
+  const double ty = transform.Translation().Y().to<double>();
+  const double tc = transform.Rotation().Cos();
+  const double ts = transform.Rotation().Sin();
+
+  double* x = m_x.data();
+  double* y = m_y.data();
+  double* c = m_cos.data();
+  double* s = m_sin.data();
+  const size_t size = Size();
+  for (size_t i = 0; i < size; ++i) {
+    const double ci = c[i];
+    const double si = s[i];
+    const double cn = ci * tc - si * ts;
+    const double sn = ci * ts + si * tc;
+    const double scale = UnitScale(cn, sn);
+    x[i] += tx * ci - ty * si;
+    y[i] += tx * si + ty * ci;
+    c[i] = cn * scale;
+    s[i] = sn * scale;
+  }
+}
+
+void Pose2dBatch::RelativeTo(const Pose2d& origin) {
+  const double ox = origin.Translation().X().to<double>();
+  const double oy = origin.Translation().Y().to<double>();
+  const double oc = origin.Rotation().Cos();
+  const double os = origin.Rotation().Sin();
+
+  double* x = m_x.data();
+  double* y = m_y.data();
+  double* c = m_cos.data();
+  double* s = m_sin.data();
+  const size_t size = Size();
+  for (size_t i = 0; i < size; ++i) {
+    // Rotate the global delta clockwise by the origin's rotation.
+    const double dx = x[i] - ox;
+    const double dy = y[i] - oy;
+    const double ci = c[i];
+    const double si = s[i];
+    const double cn = ci * oc + si * os;
+    const double sn = si * oc - ci * os;
+    const double scale = UnitScale(cn, sn);
+    x[i] = dx * oc + dy * os;
+    y[i] = dy * oc - dx * os;
+    c[i] = cn * scale;
+    s[i] = sn * scale;
+  }
+}
+
+void Pose2dBatch::FromRelative(const Pose2d& origin) {
+  const double ox = origin.Translation().X().to<double>();
+  const double oy = origin.Translation().Y().to<double>();
+  const double oc = origin.Rotation().Cos();
+  const double os = origin.Rotation().Sin();
+
+  double* x = m_x.data();
+  double* y = m_y.data();
+  double* c = m_cos.data();
+  double* s = m_sin.data();
+  const size_t size = Size();
+  for (size_t i = 0; i < size; ++i) {
+    const double xi = x[i];
+    const double yi = y[i];
+    const double ci = c[i];
+    const double si = s[i];
+    const double cn = oc * ci - os * si;
+    const double sn = os * ci + oc * si;
+    const double scale = UnitScale(cn, sn);
+    x[i] = ox + xi * oc - yi * os;
+    y[i] = oy + xi * os + yi * oc;
+    c[i] = cn * scale;
+    s[i] = sn * scale;
+  }
+}
+
+Pose2dBatch Pose2dBatch::Exp(const Twist2dBatch& twists) const {
+  CheckSize("Exp", Size(), twists.Size());
+
+  Pose2dBatch result(Size());
+
+  const double* x = m_x.data();
+  const double* y = m_y.data();
+  const double* c = m_cos.data();
+  const double* s = m_sin.data();
+  const double* dx = twists.dx.data();
+  const double* dy = twists.dy.data();
+  const double* dtheta = twists.dtheta.data();
+  double* outX = result.m_x.data();
+  double* outY = result.m_y.data();
+  double* outC = result.m_cos.data();
+  double* outS = result.m_sin.data();
+  const size_t size = Size();
+  for (size_t i = 0; i < size; ++i) {
+    const double theta = dtheta[i];
+    const double sinTheta = std::sin(theta);
+    const double cosTheta = std::cos(theta);
+
+    // Same small-angle handling as Pose2d::Exp().
+    const bool small = std::abs(theta) < 1E-9;
+    const double sFactor =
+        small ? 1.0 - 1.0 / 6.0 * theta * theta : sinTheta / theta;
+    const double cFactor = small ? 0.5 * theta : (1 - cosTheta) / theta;
+
+    // The transform in the frame of the pose.
+    const double tx = dx[i] * sFactor - dy[i] * cFactor;
+    const double ty = dx[i] * cFactor + dy[i] * sFactor;
+
+    outX[i] = x[i] + tx * c[i] - ty * s[i];
+    outY[i] = y[i] + tx * s[i] + ty * c[i];
+    outC[i] = c[i] * cosTheta - s[i] * sinTheta;
+    outS[i] = c[i] * sinTheta + s[i] * cosTheta;
+  }
+
+  return result;
+}
+
+Twist2dBatch Pose2dBatch::Log(const Pose2dBatch& end) const {
+  CheckSize("Log", Size(), end.Size());
+
+  Twist2dBatch result;
+  result.Resize(Size());
+
+  const double* x = m_x.data();
+  const double* y = m_y.data();
+  const double* c = m_cos.data();
+  const double* s = m_sin.data();
+  const double* endX = end.m_x.data();
+  const double* endY = end.m_y.data();
+  const double* endC = end.m_cos.data();
+  const double* endS = end.m_sin.data();
+  double* outDx = result.dx.data();
+  double* outDy = result.dy.data();
+  double* outDtheta = result.dtheta.data();
+  const size_t size = Size();
+  for (size_t i = 0; i < size; ++i) {
+    // The end pose relative to this pose.
+    const double deltaX = endX[i] - x[i];
+    const double deltaY = endY[i] - y[i];
+    const double tx = deltaX * c[i] + deltaY * s[i];
+    const double ty = deltaY * c[i] - deltaX * s[i];
+    const double tc = endC[i] * c[i] + endS[i] * s[i];
+    const double ts = endS[i] * c[i] - endC[i] * s[i];
+
+    const double theta = std::atan2(ts, tc);
+    const double halfTheta = theta / 2.0;
+    const double cosMinusOne = tc - 1;
+
+    // Same small-angle handling as Pose2d::Log().
+    const double halfThetaByTanOfHalfTheta =
+        std::abs(cosMinusOne) < 1E-9 ? 1.0 - 1.0 / 12.0 * theta * theta
+                                     : -(halfTheta * ts) / cosMinusOne;
+
+    // Rotating by {halfThetaByTanOfHalfTheta, -halfTheta} and scaling by its
+    // magnitude is the same as multiplying by the unnormalized vector.
+    outDx[i] = tx * halfThetaByTanOfHalfTheta + ty * halfTheta;
+    outDy[i] = ty * halfThetaByTanOfHalfTheta - tx * halfTheta;
+    outDtheta[i] = theta;
+  }
+
+  return result;
+}
+
+Pose2dBatch Pose2dBatch::Interpolate(const Pose2dBatch& start,
+                                     const Pose2dBatch& end, double t) {
+  CheckSize("Interpolate", start.Size(), end.Size());
+
+  Pose2dBatch result(start.Size());
+
+  const double* x = start.m_x.data();
+  const double* y = start.m_y.data();
+  const double* c = start.m_cos.data();
+  const double* s = start.m_sin.data();
+  const double* endX = end.m_x.data();
+  const double* endY = end.m_y.data();
+  const double* endC = end.m_cos.data();
+  const double* endS = end.m_sin.data();
+  double* outX = result.m_x.data();
+  double* outY = result.m_y.data();
+  double* outC = result.m_cos.data();
+  double* outS = result.m_sin.data();
+  const size_t size = start.Size();
+  for (size_t i = 0; i < size; ++i) {
+    // The end pose relative to the start pose, with its translation scaled.
+    const double deltaX = endX[i] - x[i];
+    const double deltaY = endY[i] - y[i];
+    const double tx = (deltaX * c[i] + deltaY * s[i]) * t;
+    const double ty = (deltaY * c[i] - deltaX * s[i]) * t;
+
+    // Scale the relative rotation's angle.
+    const double theta = std::atan2(endS[i] * c[i] - endC[i] * s[i],
+                                    endC[i] * c[i] + endS[i] * s[i]) *
+                         t;
+    const double tc = std::cos(theta);
+    const double ts = std::sin(theta);
+
+    outX[i] = x[i] + tx * c[i] - ty * s[i];
+    outY[i] = y[i] + tx * s[i] + ty * c[i];
+    outC[i] = c[i] * tc - s[i] * ts;
+    outS[i] = c[i] * ts + s[i] * tc;
+  }
+
+  return result;
+}
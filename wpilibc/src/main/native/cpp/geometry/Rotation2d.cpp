@@ -9,6 +9,7 @@
 
 #include <cmath>
 
+#include <units/math.h>
 #include <wpi/json.h>
 
 using namespace frc;
@@ -18,7 +19,7 @@ Rotation2d::Rotation2d(units::radian_t value)
       m_cos(units::math::cos(value)),
       m_sin(units::math::sin(value)) {}
 
-Rotation2d::Rotation2d(double x, double y) {
+Rotation2d::Rotation2d(double x, double y) : m_hasValue(false) {
   const auto magnitude = std::hypot(x, y);
   if (magnitude > 1e-6) {
     m_sin = y / magnitude;
@@ -27,48 +28,25 @@ Rotation2d::Rotation2d(double x, double y) {
     m_sin = 0.0;
     m_cos = 1.0;
   }
-  m_value = units::radian_t(std::atan2(m_sin, m_cos));
 }
 
-Rotation2d Rotation2d::operator+(const Rotation2d& other) const {
-  return RotateBy(other);
-}
-
-Rotation2d& Rotation2d::operator+=(const Rotation2d& other) {
-  double cos = Cos() * other.Cos() - Sin() * other.Sin();
-  double sin = Cos() * other.Sin() + Sin() * other.Cos();
-  m_cos = cos;
-  m_sin = sin;
-  m_value = units::radian_t(std::atan2(m_sin, m_cos));
-  return *this;
-}
-
-Rotation2d Rotation2d::operator-(const Rotation2d& other) const {
-  return *this + -other;
-}
-
-Rotation2d& Rotation2d::operator-=(const Rotation2d& other) {
-  *this += -other;
-  return *this;
-}
-
-Rotation2d Rotation2d::operator-() const { return Rotation2d(-m_value); }
-
 Rotation2d Rotation2d::operator*(double scalar) const {
-  return Rotation2d(m_value * scalar);
+  return Rotation2d(Radians() * scalar);
 }
 
 bool Rotation2d::operator==(const Rotation2d& other) const {
-  return units::math::abs(m_value - other.m_value) < 1E-9_rad;
+  return units::math::abs(Radians() - other.Radians()) < 1E-9_rad;
 }
 
 bool Rotation2d::operator!=(const Rotation2d& other) const {
   return !operator==(other);
 }
 
-Rotation2d Rotation2d::RotateBy(const Rotation2d& other) const {
-  return {Cos() * other.Cos() - Sin() * other.Sin(),
-          Cos() * other.Sin() + Sin() * other.Cos()};
+units::radian_t Rotation2d::Radians() const {
+  if (m_hasValue) {
+    return m_value;
+  }
+  return units::radian_t(std::atan2(m_sin, m_cos));
 }
 
 void frc::to_json(wpi::json& json, const Rotation2d& rotation) {
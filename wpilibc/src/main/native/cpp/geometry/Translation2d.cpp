@@ -7,6 +7,7 @@
 
 #include "frc/geometry/Translation2d.h"
 
+#include <units/math.h>
 #include <wpi/json.h>
 
 using namespace frc;
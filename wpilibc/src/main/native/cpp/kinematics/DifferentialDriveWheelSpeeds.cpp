@@ -7,6 +7,8 @@
 
 #include "frc/kinematics/DifferentialDriveWheelSpeeds.h"
 
+#include <units/math.h>
+
 using namespace frc;
 
 void DifferentialDriveWheelSpeeds::Normalize(
@@ -11,6 +11,8 @@
 #include <array>
 #include <cmath>
 
+#include <units/math.h>
+
 using namespace frc;
 
 void MecanumDriveWheelSpeeds::Normalize(
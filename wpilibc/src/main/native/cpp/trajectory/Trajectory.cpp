@@ -7,8 +7,11 @@
 
 #include "frc/trajectory/Trajectory.h"
 
+#include <units/math.h>
 #include <wpi/json.h>
 
+#include "frc/geometry/Pose2dBatch.h"
+
 using namespace frc;
 
 bool Trajectory::State::operator==(const Trajectory::State& other) const {
@@ -113,25 +116,42 @@ Trajectory Trajectory::TransformBy(const Transform2d& transform) {
 
   // Calculate the transformed first pose.
   auto newFirstPose = firstPose + transform;
-  auto newStates = m_states;
-  newStates[0].pose = newFirstPose;
 
-  for (unsigned int i = 1; i < newStates.size(); i++) {
-    auto& state = newStates[i];
-    // We are transforming relative to the coordinate frame of the new initial
-    // pose.
-    state.pose = newFirstPose + (state.pose - firstPose);
+  // Every state is transformed relative to the coordinate frame of the new
+  // initial pose, i.e. newFirstPose + (state.pose - firstPose). That is the
+  // same as re-expressing each pose relative to the pose that maps firstPose
+  // onto newFirstPose, which lets the whole path go through one batch pass.
+  auto poses = GetPoses();
+  poses.FromRelative(newFirstPose + (Pose2d{} - firstPose));
+
+  Trajectory transformed = *this;
+  auto& newStates = transformed.m_states;
+  newStates[0].pose = newFirstPose;
+  for (size_t i = 1; i < newStates.size(); i++) {
+    newStates[i].pose = poses.Get(i);
   }
 
-  return Trajectory(newStates);
+  return transformed;
 }
 
 Trajectory Trajectory::RelativeTo(const Pose2d& pose) {
-  auto newStates = m_states;
-  for (auto& state : newStates) {
-    state.pose = state.pose.RelativeTo(pose);
+  auto poses = GetPoses();
+  poses.RelativeTo(pose);
+
+  Trajectory transformed = *this;
+  auto& newStates = transformed.m_states;
+  for (size_t i = 0; i < newStates.size(); i++) {
+    newStates[i].pose = poses.Get(i);
+  }
+  return transformed;
+}
+
+Pose2dBatch Trajectory::GetPoses() const {
+  Pose2dBatch poses(m_states.size());
+  for (size_t i = 0; i < m_states.size(); i++) {
+    poses.Set(i, m_states[i].pose);
   }
-  return Trajectory(newStates);
+  return poses;
 }
 
 void frc::to_json(wpi::json& json, const Trajectory::State& state) {
@@ -31,6 +31,8 @@
 
 #include "frc/trajectory/TrajectoryParameterizer.h"
 
+#include <units/math.h>
+
 using namespace frc;
 
 Trajectory TrajectoryParameterizer::TimeParameterizeTrajectory(
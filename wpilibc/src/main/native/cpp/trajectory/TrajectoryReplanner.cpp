@@ -0,0 +1,184 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include "frc/trajectory/TrajectoryReplanner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#include <units/math.h>
+#include <wpi/timestamp.h>
+
+#include "frc/spline/SplineHelper.h"
+#include "frc/spline/SplineParameterizer.h"
+#include "frc/trajectory/TrajectoryParameterizer.h"
+
+using namespace frc;
+
+TrajectoryReplanner::TrajectoryReplanner(size_t cacheSize)
+    : m_cacheSize(std::max(cacheSize, size_t{1})) {
+  m_cache.reserve(m_cacheSize);
+}
+
+bool TrajectoryReplanner::Replan(const Trajectory& current, units::second_t t,
+                                 const std::vector<Pose2d>& waypoints,
+                                 const TrajectoryConfig& config,
+                                 units::second_t budget, Trajectory* result) {
+  uint64_t deadline =
+      wpi::Now() + static_cast<int64_t>(budget.to<double>() * 1.0e6);
+  const Transform2d flip{Translation2d(), Rotation2d(180_deg)};
+  const bool reversed = config.IsReversed();
+
+  if (current.States().empty()) return false;
+  auto sample = current.Sample(t);
+
+  // Waypoints the robot is already sitting on would make a degenerate spline
+  auto first = std::find_if(
+      waypoints.begin(), waypoints.end(), [&](const Pose2d& waypoint) {
+        return waypoint.Translation() != sample.pose.Translation();
+      });
+  if (first == waypoints.end()) return false;
+
+  // Appends spline points to the new tail, removing the first point of each
+  // segment after the first because it duplicates the last point of the
+  // previous one.
+  std::vector<PoseWithCurvature> points;
+  auto append = [&](const std::vector<PoseWithCurvature>& segment) {
+    auto begin = points.empty() ? segment.begin() : segment.begin() + 1;
+    for (auto it = begin; it != segment.end(); ++it) {
+      if (reversed) {
+        points.emplace_back(it->first + flip, -it->second);
+      } else {
+        points.emplace_back(*it);
+      }
+    }
+  };
+
+  // Parameterizes a segment the same way TrajectoryGenerator does, with the
+  // headings flipped if the path is reversed.
+  auto parameterize = [&](std::vector<Spline<5>::ControlVector> vectors) {
+    if (reversed) {
+      for (auto& vector : vectors) {
+        vector.x[1] *= -1;
+        vector.y[1] *= -1;
+      }
+    }
+    return SplineParameterizer::Parameterize(
+        SplineHelper::QuinticSplinesFromControlVectors(vectors).front());
+  };
+
+  ++m_useCount;
+
+  // The segment from the robot to the first waypoint depends on the sampled
+  // state, so it is never cached.  It starts with the sampled curvature: for
+  // a tangent of (x', y') the second derivative that gives curvature k is
+  // k|v|(-y', x').
+  auto headVectors = SplineHelper::QuinticControlVectorsFromWaypoints(
+      {sample.pose, *first});
+  {
+    auto& start = headVectors.front();
+    double k = sample.curvature.to<double>();
+    double speed = std::hypot(start.x[1], start.y[1]);
+    start.x[2] = -k * speed * start.y[1];
+    start.y[2] = k * speed * start.x[1];
+  }
+
+  std::vector<PoseWithCurvature> head;
+  // The segments after the first waypoint, in the order driven
+  std::vector<PoseWithCurvature> rest;
+  auto extendRest = [&](const std::vector<PoseWithCurvature>& segment) {
+    rest.insert(rest.end(), segment.begin() + (rest.empty() ? 0 : 1),
+                segment.end());
+  };
+
+  try {
+    // Do the cacheable segments first, so a replan that runs out of time
+    // still leaves them for the next attempt
+    for (auto it = first; it + 1 != waypoints.end(); ++it) {
+      const auto& start = *it;
+      const auto& end = *(it + 1);
+      if (auto segment = FindSegment(start, end, reversed)) {
+        ++m_hits;
+        extendRest(segment->points);
+        continue;
+      }
+      if (wpi::Now() >= deadline) return false;
+      ++m_misses;
+      auto segmentPoints = parameterize(
+          SplineHelper::QuinticControlVectorsFromWaypoints({start, end}));
+      extendRest(
+          AddSegment(start, end, reversed, std::move(segmentPoints)).points);
+    }
+
+    if (wpi::Now() >= deadline) return false;
+    ++m_misses;
+    head = parameterize(std::move(headVectors));
+  } catch (SplineParameterizer::MalformedSplineException&) {
+    return false;
+  }
+
+  append(head);
+  if (!rest.empty()) append(rest);
+
+  Trajectory newTail;
+  try {
+    newTail = TrajectoryParameterizer::TimeParameterizeTrajectory(
+        points, config.Constraints(), units::math::abs(sample.velocity),
+        config.EndVelocity(), config.MaxVelocity(), config.MaxAcceleration(),
+        reversed);
+  } catch (std::runtime_error&) {
+    return false;
+  }
+
+  // Keep what has already been driven, then continue from the splice
+  std::vector<Trajectory::State> states;
+  states.reserve(current.States().size() + newTail.States().size());
+  for (const auto& state : current.States()) {
+    if (state.t >= sample.t) break;
+    states.push_back(state);
+  }
+  for (auto state : newTail.States()) {
+    state.t += sample.t;
+    states.push_back(state);
+  }
+
+  *result = Trajectory(states);
+  return true;
+}
+
+void TrajectoryReplanner::ClearCache() { m_cache.clear(); }
+
+const TrajectoryReplanner::Segment* TrajectoryReplanner::FindSegment(
+    const Pose2d& start, const Pose2d& end, bool reversed) {
+  for (auto& segment : m_cache) {
+    if (segment.reversed == reversed && segment.start == start &&
+        segment.end == end) {
+      segment.lastUse = m_useCount;
+      return &segment;
+    }
+  }
+  return nullptr;
+}
+
+const TrajectoryReplanner::Segment& TrajectoryReplanner::AddSegment(
+    const Pose2d& start, const Pose2d& end, bool reversed,
+    std::vector<PoseWithCurvature>&& points) {
+  if (m_cache.size() < m_cacheSize) {
+    m_cache.push_back({start, end, reversed, m_useCount, std::move(points)});
+    return m_cache.back();
+  }
+
+  // Replace the segment that was used longest ago
+  auto& segment = *std::min_element(
+      m_cache.begin(), m_cache.end(), [](const auto& a, const auto& b) {
+        return a.lastUse < b.lastUse;
+      });
+  segment = {start, end, reversed, m_useCount, std::move(points)};
+  return segment;
+}
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2008-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2008-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -228,7 +228,10 @@ class ErrorBase {
   static Error GetGlobalError();
 
   /**
-   * Retrieve all global errors.
+   * Retrieve all global errors, oldest first.
+   *
+   * Only the latest error for each code and location is kept, and only the
+   * 100 most recent of those.
    */
   static std::vector<Error> GetGlobalErrors();
 
@@ -0,0 +1,123 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <functional>
+
+#include <units/time.h>
+#include <wpi/SafeThread.h>
+#include <wpi/StringRef.h>
+#include <wpi/Twine.h>
+
+namespace frc {
+
+/**
+ * Reports library errors to the Driver Station without stalling the caller.
+ *
+ * Reports are deduplicated by error code and source location: the first
+ * occurrence captures a stack trace and is sent, and repeats within the repeat
+ * period are only counted.  The next report from that location after the
+ * period has elapsed says how many were suppressed and reuses the stack trace
+ * captured the first time.
+ *
+ * Formatting and sending happen on a background thread, which is rate limited
+ * so that a fault inside a loop can't flood the Driver Station.  Reports that
+ * don't fit in the send queue are dropped and counted.
+ */
+class ErrorReporter {
+ public:
+  using SendFunc = std::function<void(
+      bool isError, int32_t code, const wpi::Twine& details,
+      const wpi::Twine& location, const wpi::Twine& callStack)>;
+
+  /// Maximum number of distinct (code, location) pairs remembered.
+  static constexpr size_t kMaxLocations = 256;
+
+  /// Maximum number of reports waiting to be sent.
+  static constexpr size_t kMaxPending = 64;
+
+  /**
+   * Gets the reporter used by Error, which sends through
+   * DriverStation::ReportError().
+   */
+  static ErrorReporter& GetInstance();
+
+  /**
+   * Constructs a reporter with its own sending thread.
+   *
+   * @param send Called on the sending thread for each report.
+   */
+  explicit ErrorReporter(SendFunc send);
+
+  ~ErrorReporter();
+
+  ErrorReporter(const ErrorReporter&) = delete;
+  ErrorReporter& operator=(const ErrorReporter&) = delete;
+
+  /**
+   * Reports an error or warning.
+   *
+   * @param isError     True for an error, false for a warning.
+   * @param code        The error code.
+   * @param message     The error message.
+   * @param filename    The source file the error occurred in.
+   * @param function    The function the error occurred in.
+   * @param lineNumber  The source line the error occurred on.
+   * @param stackOffset Stack frames above the caller to leave out of the
+   *                    stack trace.
+   * @return False if the report was suppressed or dropped.
+   */
+  bool Report(bool isError, int32_t code, const wpi::Twine& message,
+              wpi::StringRef filename, wpi::StringRef function,
+              int lineNumber, int stackOffset = 0);
+
+  /**
+   * Sets how long repeats of an error are suppressed for.  Defaults to 1
+   * second.
+   */
+  void SetRepeatPeriod(units::second_t period);
+
+  /**
+   * Sets the send rate limit.  Defaults to 10 reports per second, with bursts
+   * of up to 20.
+   *
+   * @param rate  Sustained reports per second.
+   * @param burst Reports that may be sent back to back.
+   */
+  void SetRateLimit(double rate, int burst);
+
+  /**
+   * Waits until every queued report has been sent.  Reports are still subject
+   * to the rate limit, so this may take a while after a burst of errors.
+   */
+  void Flush();
+
+  /**
+   * Forgets all locations, so the next report from each is sent with a fresh
+   * stack trace.
+   */
+  void Reset();
+
+  /**
+   * Returns the number of reports suppressed as repeats.
+   */
+  uint64_t GetSuppressedCount() const;
+
+  /**
+   * Returns the number of reports dropped because the send queue was full.
+   */
+  uint64_t GetDroppedCount() const;
+
+ private:
+  class Thread;
+  wpi::SafeThreadOwner<Thread> m_owner;
+};
+
+}  // namespace frc
@@ -7,7 +7,7 @@
 
 #pragma once
 
-#include <units/units.h>
+#include <units/time.h>
 #include <wpi/deprecated.h>
 
 #include "frc/RobotBase.h"
@@ -161,6 +161,12 @@ class IterativeRobotBase : public RobotBase {
 
   void LoopFunc();
 
+  /**
+   * Returns the watchdog that times LoopFunc(). Its epochs break the most
+   * recent loop down by the functions it called.
+   */
+  const Watchdog& GetLoopWatchdog() const { return m_watchdog; }
+
   units::second_t m_period;
 
  private:
@@ -13,7 +13,7 @@
 #include <vector>
 
 #include <hal/FRCUsageReporting.h>
-#include <units/units.h>
+#include <units/time.h>
 #include <wpi/ArrayRef.h>
 #include <wpi/circular_buffer.h>
 
@@ -11,7 +11,14 @@
 
 #include <algorithm>
 
-#include <units/units.h>
+// The limiter is generic over the unit; include the dimensions it is most
+// often used with so callers don't have to.
+#include <units/acceleration.h>
+#include <units/angle.h>
+#include <units/angular_velocity.h>
+#include <units/length.h>
+#include <units/time.h>
+#include <units/velocity.h>
 
 namespace frc {
 /**
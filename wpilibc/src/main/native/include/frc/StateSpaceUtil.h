@@ -0,0 +1,61 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <array>
+
+#include <Eigen/Core>
+
+namespace frc {
+
+/**
+ * Creates a cost matrix from the given vector for use with LQR.
+ *
+ * The cost matrix is constructed using Bryson's rule.  The inverse square of
+ * each element in the input is taken and placed on the cost matrix diagonal.
+ *
+ * @param costs An array.  For a Q matrix, its elements are the maximum allowed
+ *              excursions of the states from the reference.  For an R matrix,
+ *              its elements are the maximum allowed excursions of the control
+ *              inputs from no actuation.
+ * @return State excursion or control effort cost matrix.
+ */
+template <size_t N>
+Eigen::Matrix<double, N, N> MakeCostMatrix(const std::array<double, N>& costs) {
+  Eigen::Matrix<double, N, N> result;
+  result.setZero();
+  for (size_t i = 0; i < N; ++i) {
+    result(i, i) = 1.0 / (costs[i] * costs[i]);
+  }
+  return result;
+}
+
+/**
+ * Creates a covariance matrix from the given vector for use with Kalman
+ * filters.
+ *
+ * Each element is squared and placed on the covariance matrix diagonal.
+ *
+ * @param stdDevs An array.  For a Q matrix, its elements are the standard
+ *                deviations of each state from how the model behaves.  For
+ *                an R matrix, its elements are the standard deviations for
+ *                each output measurement.
+ * @return Process noise or measurement noise covariance matrix.
+ */
+template <size_t N>
+Eigen::Matrix<double, N, N> MakeCovarianceMatrix(
+    const std::array<double, N>& stdDevs) {
+  Eigen::Matrix<double, N, N> result;
+  result.setZero();
+  for (size_t i = 0; i < N; ++i) {
+    result(i, i) = stdDevs[i] * stdDevs[i];
+  }
+  return result;
+}
+
+}  // namespace frc
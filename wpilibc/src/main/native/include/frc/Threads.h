@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2016-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2016-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -7,8 +7,12 @@
 
 #pragma once
 
+#include <functional>
 #include <thread>
 
+#include <wpi/ArrayRef.h>
+#include <wpi/StringRef.h>
+
 namespace frc {
 
 /**
@@ -55,4 +59,60 @@ bool SetThreadPriority(std::thread& thread, bool realTime, int priority);
  */
 bool SetCurrentThreadPriority(bool realTime, int priority);
 
+/**
+ * Sets the CPUs the specified thread may run on. Ignored in simulation.
+ *
+ * @param thread Reference to the thread to set the affinity of.
+ * @param cpus   The CPU numbers, starting from 0. Empty to allow all CPUs.
+ *
+ * @return The success state of setting the affinity
+ */
+bool SetThreadAffinity(std::thread& thread, wpi::ArrayRef<int> cpus);
+
+/**
+ * Sets the CPUs the current thread may run on. Ignored in simulation.
+ *
+ * @param cpus The CPU numbers, starting from 0. Empty to allow all CPUs.
+ *
+ * @return The success state of setting the affinity
+ */
+bool SetCurrentThreadAffinity(wpi::ArrayRef<int> cpus);
+
+/**
+ * Locks all current and future process memory into RAM, so real-time threads
+ * never wait on a page fault, and prefaults the current thread's stack.
+ * Ignored in simulation.
+ *
+ * Call this from the main robot thread before starting the robot, along with
+ * SetCurrentThreadPriority() and SetCurrentThreadAffinity().
+ *
+ * @param stackSize Bytes of the current thread's stack to prefault.
+ *
+ * @return The success state of locking memory
+ */
+bool LockMemory(int stackSize = 256 * 1024);
+
+/**
+ * Sets a policy applied to threads started by the library (NetworkTables,
+ * cameras, Notifier and the like) as each starts. It is called on the new
+ * thread with the thread's name, and may set the thread's affinity and
+ * priority with SetCurrentThreadAffinity() and SetCurrentThreadPriority().
+ *
+ * Names are prefixed "NT" for NetworkTables threads and "CS" for camera
+ * threads, so, for example, telemetry and vision can be kept off the CPU used
+ * by control loops:
+ * @code{.cpp}
+ * frc::SetThreadPlacementPolicy([](wpi::StringRef name) {
+ *   if (name.startswith("NT") || name.startswith("CS"))
+ *     frc::SetCurrentThreadAffinity({0});
+ * });
+ * @endcode
+ *
+ * Threads that have already started are not affected, so this should be
+ * called before anything else.
+ *
+ * @param policy The policy, or nullptr for none.
+ */
+void SetThreadPlacementPolicy(std::function<void(wpi::StringRef name)> policy);
+
 }  // namespace frc
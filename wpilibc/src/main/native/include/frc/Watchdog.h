@@ -12,7 +12,7 @@
 #include <utility>
 
 #include <hal/cpp/fpga_clock.h>
-#include <units/units.h>
+#include <units/time.h>
 #include <wpi/SafeThread.h>
 #include <wpi/StringMap.h>
 #include <wpi/StringRef.h>
@@ -113,6 +113,13 @@ class Watchdog {
    */
   void PrintEpochs();
 
+  /**
+   * Returns the epochs added since the watchdog was last reset, keyed by name.
+   */
+  const wpi::StringMap<std::chrono::nanoseconds>& GetEpochs() const {
+    return m_epochs;
+  }
+
   /**
    * Resets the watchdog timer.
    *
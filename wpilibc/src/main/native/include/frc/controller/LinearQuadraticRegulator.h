@@ -0,0 +1,179 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <array>
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+#include <units/time.h>
+
+#include "frc/StateSpaceUtil.h"
+#include "frc/system/DiscreteAlgebraicRiccatiEquation.h"
+#include "frc/system/Discretization.h"
+#include "frc/system/LinearSystem.h"
+
+namespace frc {
+
+/**
+ * Contains the controller coefficients and logic for a linear-quadratic
+ * regulator (LQR).
+ *
+ * LQRs use the control law u = K(r - x).  The gain matrix K is computed once
+ * at construction by discretizing the plant and solving the discrete
+ * algebraic Riccati equation, so Calculate() is only a fixed-size
+ * matrix-vector product and never allocates.
+ *
+ * @tparam States The number of states.
+ * @tparam Inputs The number of inputs.
+ */
+template <int States, int Inputs>
+class LinearQuadraticRegulator {
+ public:
+  /**
+   * Constructs a controller with the given coefficients and plant.
+   *
+   * @param plant  The plant being controlled.
+   * @param Qelems The maximum desired error tolerance for each state.
+   * @param Relems The maximum desired control effort for each input.
+   * @param dt     Discretization timestep.
+   */
+  template <int Outputs>
+  LinearQuadraticRegulator(const LinearSystem<States, Inputs, Outputs>& plant,
+                           const std::array<double, States>& Qelems,
+                           const std::array<double, Inputs>& Relems,
+                           units::second_t dt)
+      : LinearQuadraticRegulator(plant.A(), plant.B(), Qelems, Relems, dt) {}
+
+  /**
+   * Constructs a controller with the given coefficients and plant.
+   *
+   * @param A      Continuous system matrix of the plant being controlled.
+   * @param B      Continuous input matrix of the plant being controlled.
+   * @param Qelems The maximum desired error tolerance for each state.
+   * @param Relems The maximum desired control effort for each input.
+   * @param dt     Discretization timestep.
+   */
+  LinearQuadraticRegulator(const Eigen::Matrix<double, States, States>& A,
+                           const Eigen::Matrix<double, States, Inputs>& B,
+                           const std::array<double, States>& Qelems,
+                           const std::array<double, Inputs>& Relems,
+                           units::second_t dt)
+      : LinearQuadraticRegulator(A, B, MakeCostMatrix(Qelems),
+                                 MakeCostMatrix(Relems), dt) {}
+
+  /**
+   * Constructs a controller with the given coefficients and plant.
+   *
+   * @param A  Continuous system matrix of the plant being controlled.
+   * @param B  Continuous input matrix of the plant being controlled.
+   * @param Q  The state cost matrix.
+   * @param R  The input cost matrix.
+   * @param dt Discretization timestep.
+   */
+  LinearQuadraticRegulator(const Eigen::Matrix<double, States, States>& A,
+                           const Eigen::Matrix<double, States, Inputs>& B,
+                           const Eigen::Matrix<double, States, States>& Q,
+                           const Eigen::Matrix<double, Inputs, Inputs>& R,
+                           units::second_t dt) {
+    Eigen::Matrix<double, States, States> discA;
+    Eigen::Matrix<double, States, Inputs> discB;
+    DiscretizeAB<States, Inputs>(A, B, dt, &discA, &discB);
+
+    Eigen::Matrix<double, States, States> S =
+        DiscreteAlgebraicRiccatiEquation<States, Inputs>(discA, discB, Q, R);
+
+    // K = (BᵀSB + R)⁻¹BᵀSA
+    Eigen::Matrix<double, Inputs, Inputs> tmp =
+        discB.transpose() * S * discB + R;
+    m_K = tmp.partialPivLu().solve(discB.transpose() * S * discA);
+
+    Reset();
+  }
+
+  /**
+   * Returns the controller matrix K.
+   */
+  const Eigen::Matrix<double, Inputs, States>& K() const { return m_K; }
+
+  /**
+   * Returns an element of the controller matrix K.
+   *
+   * @param i Row of K.
+   * @param j Column of K.
+   */
+  double K(int i, int j) const { return m_K(i, j); }
+
+  /**
+   * Returns the reference vector r.
+   */
+  const Eigen::Matrix<double, States, 1>& R() const { return m_r; }
+
+  /**
+   * Returns an element of the reference vector r.
+   *
+   * @param i Row of r.
+   */
+  double R(int i) const { return m_r(i); }
+
+  /**
+   * Returns the control input vector u.
+   */
+  const Eigen::Matrix<double, Inputs, 1>& U() const { return m_u; }
+
+  /**
+   * Returns an element of the control input vector u.
+   *
+   * @param i Row of u.
+   */
+  double U(int i) const { return m_u(i); }
+
+  /**
+   * Resets the controller.
+   */
+  void Reset() {
+    m_r.setZero();
+    m_u.setZero();
+  }
+
+  /**
+   * Returns the next output of the controller.
+   *
+   * @param x The current state x.
+   */
+  const Eigen::Matrix<double, Inputs, 1>& Calculate(
+      const Eigen::Matrix<double, States, 1>& x) {
+    m_u.noalias() = m_K * (m_r - x);
+    return m_u;
+  }
+
+  /**
+   * Returns the next output of the controller.
+   *
+   * @param x     The current state x.
+   * @param nextR The next reference vector r.
+   */
+  const Eigen::Matrix<double, Inputs, 1>& Calculate(
+      const Eigen::Matrix<double, States, 1>& x,
+      const Eigen::Matrix<double, States, 1>& nextR) {
+    m_r = nextR;
+    return Calculate(x);
+  }
+
+ private:
+  // Current reference
+  Eigen::Matrix<double, States, 1> m_r;
+
+  // Computed controller output
+  Eigen::Matrix<double, Inputs, 1> m_u;
+
+  // Controller gain
+  Eigen::Matrix<double, Inputs, States> m_K;
+};
+
+}  // namespace frc
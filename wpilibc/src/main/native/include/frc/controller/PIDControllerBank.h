@@ -0,0 +1,275 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include <units/time.h>
+#include <wpi/ArrayRef.h>
+
+#include "frc/controller/ArmFeedforward.h"
+#include "frc/controller/SimpleMotorFeedforward.h"
+
+namespace frc2 {
+
+/**
+ * Evaluates many PID loops, each with an optional feedforward, in one call.
+ *
+ * Every loop behaves like a PIDController paired with a SimpleMotorFeedforward
+ * or ArmFeedforward evaluated at the loop's reference, but the state of all
+ * loops is stored as parallel arrays and the per-loop configuration (input
+ * wrapping, integrator bounds, the inverse of the period) is folded into
+ * precomputed coefficients, so Calculate() runs a short branch-free kernel
+ * over all loops instead of one controller object per loop.
+ *
+ * Positions, velocities and accelerations are raw doubles in the units the
+ * loop's gains were given in; arm loops use radians.
+ */
+class PIDControllerBank {
+ public:
+  /**
+   * Creates an empty bank.
+   *
+   * @param period The period between calls to Calculate(). Defaults to 20 ms.
+   */
+  explicit PIDControllerBank(units::second_t period = 20_ms);
+
+  /**
+   * Adds a PID loop to the bank.
+   *
+   * @param Kp The proportional coefficient.
+   * @param Ki The integral coefficient.
+   * @param Kd The derivative coefficient.
+   * @return The index of the new loop.
+   */
+  size_t Add(double Kp, double Ki, double Kd);
+
+  /**
+   * Returns the number of loops in the bank.
+   */
+  size_t Size() const { return m_Kp.size(); }
+
+  /**
+   * Returns the period between calls to Calculate().
+   */
+  units::second_t GetPeriod() const { return m_period; }
+
+  /**
+   * Sets the PID coefficients of a loop.
+   *
+   * @param index The loop index.
+   * @param Kp    The proportional coefficient.
+   * @param Ki    The integral coefficient.
+   * @param Kd    The derivative coefficient.
+   */
+  void SetPID(size_t index, double Kp, double Ki, double Kd);
+
+  /**
+   * Sets the feedforward of a loop from a simple motor model.
+   *
+   * @param index       The loop index.
+   * @param feedforward The feedforward whose gains to use.
+   */
+  template <class Distance>
+  void SetFeedforward(
+      size_t index, const frc::SimpleMotorFeedforward<Distance>& feedforward) {
+    SetFeedforward(index, feedforward.kS.template to<double>(),
+                   feedforward.kV.template to<double>(),
+                   feedforward.kA.template to<double>(), 0.0);
+  }
+
+  /**
+   * Sets the feedforward of a loop from an arm model. The gravity term is
+   * evaluated at the loop's position setpoint, in radians.
+   *
+   * @param index       The loop index.
+   * @param feedforward The feedforward whose gains to use.
+   */
+  void SetFeedforward(size_t index, const frc::ArmFeedforward& feedforward);
+
+  /**
+   * Sets the raw feedforward gains of a loop.
+   *
+   * @param index The loop index.
+   * @param kS    The static gain, in volts.
+   * @param kV    The velocity gain, in volts per velocity unit.
+   * @param kA    The acceleration gain, in volts per acceleration unit.
+   * @param kCos  The gravity gain, in volts, applied to the cosine of the
+   *              position setpoint.
+   */
+  void SetFeedforward(size_t index, double kS, double kV, double kA,
+                      double kCos);
+
+  /**
+   * Sets whether the arm gravity term uses a lookup table instead of
+   * std::cos. The table interpolates linearly and is accurate to about 5e-6,
+   * far below the resolution of a motor controller's voltage output.
+   *
+   * @param enabled True to use the lookup table.
+   */
+  void SetCosineTableEnabled(bool enabled) { m_useCosineTable = enabled; }
+
+  /**
+   * Enables continuous input for a loop, as
+   * PIDController::EnableContinuousInput().
+   *
+   * @param index        The loop index.
+   * @param minimumInput The minimum value expected from the input.
+   * @param maximumInput The maximum value expected from the input.
+   */
+  void EnableContinuousInput(size_t index, double minimumInput,
+                             double maximumInput);
+
+  /**
+   * Disables continuous input for a loop.
+   *
+   * @param index The loop index.
+   */
+  void DisableContinuousInput(size_t index);
+
+  /**
+   * Sets the minimum and maximum contribution of the integral term of a loop,
+   * as PIDController::SetIntegratorRange().
+   *
+   * @param index           The loop index.
+   * @param minimumIntegral The minimum contribution of the integral term.
+   * @param maximumIntegral The maximum contribution of the integral term.
+   */
+  void SetIntegratorRange(size_t index, double minimumIntegral,
+                          double maximumIntegral);
+
+  /**
+   * Sets the error tolerance of a loop, as PIDController::SetTolerance().
+   *
+   * @param index             The loop index.
+   * @param positionTolerance Position error which is tolerable.
+   * @param velocityTolerance Velocity error which is tolerable.
+   */
+  void SetTolerance(
+      size_t index, double positionTolerance,
+      double velocityTolerance = std::numeric_limits<double>::infinity());
+
+  /**
+   * Sets the position setpoint of a loop and clears its feedforward
+   * velocity and acceleration.
+   *
+   * @param index    The loop index.
+   * @param setpoint The desired position.
+   */
+  void SetSetpoint(size_t index, double setpoint) {
+    SetReference(index, setpoint, 0.0, 0.0);
+  }
+
+  /**
+   * Sets the reference a loop tracks.
+   *
+   * @param index        The loop index.
+   * @param position     The position setpoint of the PID loop.
+   * @param velocity     The velocity setpoint of the feedforward.
+   * @param acceleration The acceleration setpoint of the feedforward.
+   */
+  void SetReference(size_t index, double position, double velocity,
+                    double acceleration = 0.0);
+
+  /**
+   * Returns the position setpoint of a loop.
+   *
+   * @param index The loop index.
+   */
+  double GetSetpoint(size_t index) const { return m_setpoint[index]; }
+
+  /**
+   * Returns true if the error of a loop is within its tolerances.
+   *
+   * @param index The loop index.
+   */
+  bool AtSetpoint(size_t index) const;
+
+  /**
+   * Returns the position error of a loop from the last Calculate().
+   *
+   * @param index The loop index.
+   */
+  double GetPositionError(size_t index) const {
+    return m_positionError[index];
+  }
+
+  /**
+   * Returns the velocity error of a loop from the last Calculate().
+   *
+   * @param index The loop index.
+   */
+  double GetVelocityError(size_t index) const {
+    return m_velocityError[index];
+  }
+
+  /**
+   * Computes the output of every loop.
+   *
+   * @param measurements The current measurement of each loop, indexed like
+   *                     the loops.
+   * @param outputs      Receives the PID plus feedforward output of each
+   *                     loop.
+   * @throws std::invalid_argument if measurements or outputs doesn't have
+   *         one element per loop.
+   */
+  void Calculate(wpi::ArrayRef<double> measurements,
+                 wpi::MutableArrayRef<double> outputs);
+
+  /**
+   * Resets the previous error and the integral term of every loop.
+   */
+  void Reset();
+
+  /**
+   * Resets the previous error and the integral term of a loop.
+   *
+   * @param index The loop index.
+   */
+  void Reset(size_t index);
+
+ private:
+  void UpdateIntegralBounds(size_t index);
+
+  units::second_t m_period;
+  double m_invPeriod;
+  bool m_useCosineTable = false;
+
+  // Gains
+  std::vector<double> m_Kp;
+  std::vector<double> m_Ki;
+  std::vector<double> m_Kd;
+  std::vector<double> m_kS;
+  std::vector<double> m_kV;
+  std::vector<double> m_kA;
+  std::vector<double> m_kCos;
+
+  // Configuration; m_inputRange and m_invInputRange are zero unless the
+  // input is continuous, which makes the wrap in Calculate() a no-op.
+  std::vector<double> m_minimumIntegral;
+  std::vector<double> m_maximumIntegral;
+  std::vector<double> m_integralLower;
+  std::vector<double> m_integralUpper;
+  std::vector<double> m_minimumInput;
+  std::vector<double> m_maximumInput;
+  std::vector<double> m_inputRange;
+  std::vector<double> m_invInputRange;
+  std::vector<double> m_positionTolerance;
+  std::vector<double> m_velocityTolerance;
+
+  // Reference and state
+  std::vector<double> m_setpoint;
+  std::vector<double> m_velocity;
+  std::vector<double> m_acceleration;
+  std::vector<double> m_positionError;
+  std::vector<double> m_velocityError;
+  std::vector<double> m_totalError;
+};
+
+}  // namespace frc2
@@ -0,0 +1,163 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <array>
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+#include <units/time.h>
+
+#include "frc/StateSpaceUtil.h"
+#include "frc/system/DiscreteAlgebraicRiccatiEquation.h"
+#include "frc/system/Discretization.h"
+#include "frc/system/LinearSystem.h"
+
+namespace frc {
+
+/**
+ * A steady-state discrete-time Kalman filter.
+ *
+ * Kalman filters combine predictions from a model and measurements to give
+ * an estimate of the true system state.  For a time-invariant plant with
+ * constant noise covariances the error covariance converges, so the gain is
+ * computed once at construction from the discrete algebraic Riccati equation
+ * along with the discretized plant.  Predict() and Correct() are then only
+ * fixed-size matrix-vector products and never allocate.
+ *
+ * Because the discretization is cached, Predict() must be called at the
+ * timestep passed to the constructor.
+ *
+ * @tparam States  The number of states.
+ * @tparam Inputs  The number of inputs.
+ * @tparam Outputs The number of outputs.
+ */
+template <int States, int Inputs, int Outputs>
+class KalmanFilter {
+ public:
+  /**
+   * Constructs a Kalman filter with the given plant.
+   *
+   * @param plant              The plant used for the prediction step.
+   * @param stateStdDevs       Standard deviations of model states.
+   * @param measurementStdDevs Standard deviations of measurements.
+   * @param dt                 Nominal discretization timestep.
+   */
+  KalmanFilter(const LinearSystem<States, Inputs, Outputs>& plant,
+               const std::array<double, States>& stateStdDevs,
+               const std::array<double, Outputs>& measurementStdDevs,
+               units::second_t dt)
+      : m_C(plant.C()), m_D(plant.D()) {
+    DiscretizeAB<States, Inputs>(plant.A(), plant.B(), dt, &m_discA,
+                                 &m_discB);
+
+    Eigen::Matrix<double, States, States> discA;
+    Eigen::Matrix<double, States, States> discQ;
+    DiscretizeAQ<States>(plant.A(), MakeCovarianceMatrix(stateStdDevs), dt,
+                         &discA, &discQ);
+
+    Eigen::Matrix<double, Outputs, Outputs> discR =
+        DiscretizeR<Outputs>(MakeCovarianceMatrix(measurementStdDevs), dt);
+
+    // The steady-state prior error covariance solves the dual of the LQR
+    // problem
+    Eigen::Matrix<double, States, States> P =
+        DiscreteAlgebraicRiccatiEquation<States, Outputs>(
+            discA.transpose(), m_C.transpose(), discQ, discR);
+
+    // K = PCᵀ(CPCᵀ + R)⁻¹, found by solving (CPCᵀ + R)ᵀKᵀ = CPᵀ
+    Eigen::Matrix<double, Outputs, Outputs> S =
+        m_C * P * m_C.transpose() + discR;
+    m_K = S.transpose()
+              .partialPivLu()
+              .solve(m_C * P.transpose())
+              .transpose();
+
+    Reset();
+  }
+
+  /**
+   * Returns the steady-state Kalman gain matrix K.
+   */
+  const Eigen::Matrix<double, States, Outputs>& K() const { return m_K; }
+
+  /**
+   * Returns an element of the steady-state Kalman gain matrix K.
+   *
+   * @param i Row of K.
+   * @param j Column of K.
+   */
+  double K(int i, int j) const { return m_K(i, j); }
+
+  /**
+   * Returns the state estimate x-hat.
+   */
+  const Eigen::Matrix<double, States, 1>& Xhat() const { return m_xHat; }
+
+  /**
+   * Returns an element of the state estimate x-hat.
+   *
+   * @param i Row of x-hat.
+   */
+  double Xhat(int i) const { return m_xHat(i); }
+
+  /**
+   * Set initial state estimate x-hat.
+   *
+   * @param xHat The state estimate x-hat.
+   */
+  void SetXhat(const Eigen::Matrix<double, States, 1>& xHat) { m_xHat = xHat; }
+
+  /**
+   * Set an element of the initial state estimate x-hat.
+   *
+   * @param i     Row of x-hat.
+   * @param value Value for element of x-hat.
+   */
+  void SetXhat(int i, double value) { m_xHat(i) = value; }
+
+  /**
+   * Resets the observer.
+   */
+  void Reset() { m_xHat.setZero(); }
+
+  /**
+   * Project the model into the future with a new control input u.
+   *
+   * @param u New control input from controller.
+   */
+  void Predict(const Eigen::Matrix<double, Inputs, 1>& u) {
+    m_xHat = m_discA * m_xHat + m_discB * u;
+  }
+
+  /**
+   * Correct the state estimate x-hat using the measurements in y.
+   *
+   * @param u Same control input used in the last predict step.
+   * @param y Measurement vector.
+   */
+  void Correct(const Eigen::Matrix<double, Inputs, 1>& u,
+               const Eigen::Matrix<double, Outputs, 1>& y) {
+    m_xHat += m_K * (y - (m_C * m_xHat + m_D * u));
+  }
+
+ private:
+  // Discretized plant, cached for the prediction step
+  Eigen::Matrix<double, States, States> m_discA;
+  Eigen::Matrix<double, States, Inputs> m_discB;
+  Eigen::Matrix<double, Outputs, States> m_C;
+  Eigen::Matrix<double, Outputs, Inputs> m_D;
+
+  // The steady-state Kalman gain matrix
+  Eigen::Matrix<double, States, Outputs> m_K;
+
+  // The state estimate
+  Eigen::Matrix<double, States, 1> m_xHat;
+};
+
+}  // namespace frc
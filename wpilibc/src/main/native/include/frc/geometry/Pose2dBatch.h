@@ -0,0 +1,216 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <wpi/ArrayRef.h>
+
+#include "Pose2d.h"
+
+namespace frc {
+
+/**
+ * A set of twists stored as a structure of arrays. Each component is a
+ * contiguous array of raw values (meters and radians).
+ */
+struct Twist2dBatch {
+  /**
+   * Linear "dx" components, in meters.
+   */
+  std::vector<double> dx;
+
+  /**
+   * Linear "dy" components, in meters.
+   */
+  std::vector<double> dy;
+
+  /**
+   * Angular "dtheta" components, in radians.
+   */
+  std::vector<double> dtheta;
+
+  /**
+   * Returns the number of twists in the batch.
+   *
+   * @return The number of twists in the batch.
+   */
+  size_t Size() const { return dx.size(); }
+
+  /**
+   * Resizes the batch. New twists are zero.
+   *
+   * @param size The new number of twists.
+   */
+  void Resize(size_t size);
+
+  /**
+   * Returns one twist of the batch.
+   *
+   * @param i The index of the twist.
+   * @return The twist.
+   */
+  Twist2d Get(size_t i) const;
+
+  /**
+   * Sets one twist of the batch.
+   *
+   * @param i     The index of the twist.
+   * @param twist The new value of the twist.
+   */
+  void Set(size_t i, const Twist2d& twist);
+};
+
+/**
+ * A set of poses stored as a structure of arrays: the x and y components of
+ * the translations and the cosines and sines of the rotations each live in
+ * their own contiguous array.
+ *
+ * Operations apply the same transformation to every pose of the batch in
+ * plain loops over those arrays, which avoids the per-pose unit conversions
+ * and temporaries of the Pose2d member functions and lets the compiler
+ * vectorize the arithmetic.
+ */
+class Pose2dBatch {
+ public:
+  /**
+   * Constructs an empty batch.
+   */
+  Pose2dBatch() = default;
+
+  /**
+   * Constructs a batch of poses at the origin.
+   *
+   * @param size The number of poses.
+   */
+  explicit Pose2dBatch(size_t size);
+
+  /**
+   * Constructs a batch from a list of poses.
+   *
+   * @param poses The poses.
+   */
+  explicit Pose2dBatch(wpi::ArrayRef<Pose2d> poses);
+
+  /**
+   * Returns the number of poses in the batch.
+   *
+   * @return The number of poses in the batch.
+   */
+  size_t Size() const { return m_x.size(); }
+
+  /**
+   * Resizes the batch. New poses are at the origin.
+   *
+   * @param size The new number of poses.
+   */
+  void Resize(size_t size);
+
+  /**
+   * Returns one pose of the batch.
+   *
+   * @param i The index of the pose.
+   * @return The pose.
+   */
+  Pose2d Get(size_t i) const;
+
+  /**
+   * Sets one pose of the batch.
+   *
+   * @param i    The index of the pose.
+   * @param pose The new value of the pose.
+   */
+  void Set(size_t i, const Pose2d& pose);
+
+  /**
+   * Returns the x components of the translations, in meters.
+   */
+  wpi::ArrayRef<double> X() const { return m_x; }
+
+  /**
+   * Returns the y components of the translations, in meters.
+   */
+  wpi::ArrayRef<double> Y() const { return m_y; }
+
+  /**
+   * Returns the cosines of the rotations.
+   */
+  wpi::ArrayRef<double> Cos() const { return m_cos; }
+
+  /**
+   * Returns the sines of the rotations.
+   */
+  wpi::ArrayRef<double> Sin() const { return m_sin; }
+
+  /**
+   * Transforms every pose by the same transform. Equivalent to replacing each
+   * pose with pose + transform.
+   *
+   * @param transform The transform to apply, relative to each pose.
+   */
+  void TransformBy(const Transform2d& transform);
+
+  /**
+   * Expresses every pose relative to another pose. Equivalent to replacing
+   * each pose with pose.RelativeTo(origin).
+   *
+   * @param origin The pose that becomes the origin of the new frame.
+   */
+  void RelativeTo(const Pose2d& origin);
+
+  /**
+   * The inverse of RelativeTo(): treats every pose as relative to origin and
+   * expresses it in the frame origin is in. Equivalent to replacing each pose
+   * with origin + Transform2d{pose.Translation(), pose.Rotation()}.
+   *
+   * @param origin The pose the poses are currently relative to.
+   */
+  void FromRelative(const Pose2d& origin);
+
+  /**
+   * Applies a twist to each pose, as Pose2d::Exp() does.
+   *
+   * @param twists The twists, one per pose.
+   * @return The poses after the twists are applied.
+   * @throws std::invalid_argument if twists is not the size of this batch.
+   */
+  Pose2dBatch Exp(const Twist2dBatch& twists) const;
+
+  /**
+   * Computes the twist that maps each pose to the corresponding end pose, as
+   * Pose2d::Log() does.
+   *
+   * @param end The end poses, one per pose.
+   * @return The twists from each pose to its end pose.
+   * @throws std::invalid_argument if end is not the size of this batch.
+   */
+  Twist2dBatch Log(const Pose2dBatch& end) const;
+
+  /**
+   * Interpolates between corresponding poses of two batches, with the same
+   * interpolation as Trajectory::State::Lerp(): the relative transform between
+   * the poses is scaled by t and applied to the start pose.
+   *
+   * @param start The start poses.
+   * @param end   The end poses.
+   * @param t     The interpolation fraction, from 0 (start) to 1 (end).
+   * @return The interpolated poses.
+   * @throws std::invalid_argument if start and end differ in size.
+   */
+  static Pose2dBatch Interpolate(const Pose2dBatch& start,
+                                 const Pose2dBatch& end, double t);
+
+ private:
+  std::vector<double> m_x;
+  std::vector<double> m_y;
+  std::vector<double> m_cos;
+  std::vector<double> m_sin;
+};
+
+}  // namespace frc
@@ -7,7 +7,7 @@
 
 #pragma once
 
-#include <units/units.h>
+#include <units/angle.h>
 
 namespace wpi {
 class json;
@@ -53,7 +53,9 @@ class Rotation2d {
    *
    * @return The sum of the two rotations.
    */
-  Rotation2d operator+(const Rotation2d& other) const;
+  constexpr Rotation2d operator+(const Rotation2d& other) const {
+    return RotateBy(other);
+  }
 
   /**
    * Adds a rotation to the current rotation.
@@ -65,7 +67,10 @@ class Rotation2d {
    *
    * @return The reference to the new mutated object.
    */
-  Rotation2d& operator+=(const Rotation2d& other);
+  constexpr Rotation2d& operator+=(const Rotation2d& other) {
+    *this = RotateBy(other);
+    return *this;
+  }
 
   /**
    * Subtracts the new rotation from the current rotation and returns the new
@@ -78,7 +83,9 @@ class Rotation2d {
    *
    * @return The difference between the two rotations.
    */
-  Rotation2d operator-(const Rotation2d& other) const;
+  constexpr Rotation2d operator-(const Rotation2d& other) const {
+    return RotateBy(-other);
+  }
 
   /**
    * Subtracts the new rotation from the current rotation.
@@ -90,7 +97,10 @@ class Rotation2d {
    *
    * @return The reference to the new mutated object.
    */
-  Rotation2d& operator-=(const Rotation2d& other);
+  constexpr Rotation2d& operator-=(const Rotation2d& other) {
+    *this = RotateBy(-other);
+    return *this;
+  }
 
   /**
    * Takes the inverse of the current rotation. This is simply the negative of
@@ -98,7 +108,10 @@ class Rotation2d {
    *
    * @return The inverse of the current rotation.
    */
-  Rotation2d operator-() const;
+  constexpr Rotation2d operator-() const {
+    return Rotation2d{m_cos, -m_sin, units::radian_t{-m_value.to<double>()},
+                      m_hasValue};
+  }
 
   /**
    * Multiplies the current rotation by a scalar.
@@ -130,53 +143,69 @@ class Rotation2d {
    * [cos_new]   [other.cos, -other.sin][cos]
    * [sin_new] = [other.sin,  other.cos][sin]
    *
-   * value_new = std::atan2(cos_new, sin_new)
+   * The angle of the result is only computed (with std::atan2) if Radians() or
+   * Degrees() is later called on it.
    *
    * @param other The rotation to rotate by.
    *
    * @return The new rotated Rotation2d.
    */
-  Rotation2d RotateBy(const Rotation2d& other) const;
+  constexpr Rotation2d RotateBy(const Rotation2d& other) const {
+    double cos = m_cos * other.m_cos - m_sin * other.m_sin;
+    double sin = m_cos * other.m_sin + m_sin * other.m_cos;
+    // One Newton step of 1/sqrt(x) around x = 1 pulls the result back onto
+    // the unit circle, so rounding error doesn't accumulate over long chains
+    // of compositions.
+    double scale = 1.5 - 0.5 * (cos * cos + sin * sin);
+    return Rotation2d{cos * scale, sin * scale, units::radian_t{0}, false};
+  }
 
   /**
    * Returns the radian value of the rotation.
    *
    * @return The radian value of the rotation.
    */
-  units::radian_t Radians() const { return m_value; }
+  units::radian_t Radians() const;
 
   /**
    * Returns the degree value of the rotation.
    *
    * @return The degree value of the rotation.
    */
-  units::degree_t Degrees() const { return m_value; }
+  units::degree_t Degrees() const { return Radians(); }
 
   /**
    * Returns the cosine of the rotation.
    *
    * @return The cosine of the rotation.
    */
-  double Cos() const { return m_cos; }
+  constexpr double Cos() const { return m_cos; }
 
   /**
    * Returns the sine of the rotation.
    *
    * @return The sine of the rotation.
    */
-  double Sin() const { return m_sin; }
+  constexpr double Sin() const { return m_sin; }
 
   /**
    * Returns the tangent of the rotation.
    *
    * @return The tangent of the rotation.
    */
-  double Tan() const { return m_sin / m_cos; }
+  constexpr double Tan() const { return m_sin / m_cos; }
 
  private:
+  constexpr Rotation2d(double cos, double sin, units::radian_t value,
+                       bool hasValue)
+      : m_value(value), m_cos(cos), m_sin(sin), m_hasValue(hasValue) {}
+
   units::radian_t m_value = 0_deg;
   double m_cos = 1;
   double m_sin = 0;
+  // Whether m_value holds the angle.  Rotations built by composition only
+  // track cosine and sine; their angle is computed when it is asked for.
+  bool m_hasValue = true;
 };
 
 void to_json(wpi::json& json, const Rotation2d& rotation);
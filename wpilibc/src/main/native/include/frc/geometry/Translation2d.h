@@ -7,7 +7,7 @@
 
 #pragma once
 
-#include <units/units.h>
+#include <units/length.h>
 
 #include "Rotation2d.h"
 
@@ -6,7 +6,9 @@
 /*----------------------------------------------------------------------------*/
 
 #pragma once
-#include <units/units.h>
+#include <units/angle.h>
+#include <units/length.h>
+#include <units/math.h>
 
 namespace frc {
 /**
@@ -8,7 +8,9 @@
 #pragma once
 
 #include <hal/FRCUsageReporting.h>
-#include <units/units.h>
+#include <units/angle.h>
+#include <units/length.h>
+#include <units/velocity.h>
 
 #include "frc/kinematics/ChassisSpeeds.h"
 #include "frc/kinematics/DifferentialDriveWheelSpeeds.h"
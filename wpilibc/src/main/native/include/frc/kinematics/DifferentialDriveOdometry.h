@@ -7,7 +7,7 @@
 
 #pragma once
 
-#include <units/units.h>
+#include <units/length.h>
 
 #include "DifferentialDriveKinematics.h"
 #include "frc/geometry/Pose2d.h"
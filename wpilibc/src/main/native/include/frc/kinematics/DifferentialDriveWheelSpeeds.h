@@ -7,7 +7,7 @@
 
 #pragma once
 
-#include <units/units.h>
+#include <units/velocity.h>
 
 namespace frc {
 /**
@@ -11,7 +11,7 @@
 #include <cstddef>
 #include <ctime>
 
-#include <units/units.h>
+#include <units/time.h>
 
 #include "SwerveDriveKinematics.h"
 #include "SwerveModuleState.h"
@@ -0,0 +1,65 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <Eigen/Cholesky>
+#include <Eigen/Core>
+#include <Eigen/LU>
+
+namespace frc {
+
+/**
+ * Solves the discrete algebraic Riccati equation
+ *
+ *   AᵀSA − S − AᵀSB(BᵀSB + R)⁻¹BᵀSA + Q = 0
+ *
+ * for S using the structure-preserving doubling algorithm.  The pair (A, B)
+ * must be stabilizable, Q must be positive semidefinite and R must be
+ * positive definite.
+ *
+ * @param A             System matrix.
+ * @param B             Input matrix.
+ * @param Q             State cost matrix.
+ * @param R             Input cost matrix.
+ * @param maxIterations Iteration limit.
+ * @param tolerance     Convergence tolerance, relative to the size of S.
+ * @return The solution S.
+ */
+template <int States, int Inputs>
+Eigen::Matrix<double, States, States> DiscreteAlgebraicRiccatiEquation(
+    const Eigen::Matrix<double, States, States>& A,
+    const Eigen::Matrix<double, States, Inputs>& B,
+    const Eigen::Matrix<double, States, States>& Q,
+    const Eigen::Matrix<double, Inputs, Inputs>& R, int maxIterations = 100,
+    double tolerance = 1e-10) {
+  using StateMatrix = Eigen::Matrix<double, States, States>;
+  const StateMatrix I = StateMatrix::Identity();
+
+  StateMatrix Ak = A;
+  StateMatrix Gk = B * R.llt().solve(B.transpose());
+  StateMatrix Hk = Q;
+
+  for (int i = 0; i < maxIterations; ++i) {
+    // W = I + GH; each step doubles the horizon of the Riccati recursion
+    Eigen::PartialPivLU<StateMatrix> W(I + Gk * Hk);
+    StateMatrix V1 = W.solve(Ak);
+    StateMatrix V2 = W.solve(Gk);
+
+    StateMatrix Hnext = Hk + Ak.transpose() * Hk * V1;
+    Gk += Ak * V2 * Ak.transpose();
+    Ak *= V1;
+
+    double delta = (Hnext - Hk).norm();
+    Hk = Hnext;
+    if (delta <= tolerance * Hk.norm()) break;
+  }
+
+  return Hk;
+}
+
+}  // namespace frc
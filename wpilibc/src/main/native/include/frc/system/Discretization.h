@@ -0,0 +1,104 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <Eigen/Core>
+#include <units/time.h>
+#include <unsupported/Eigen/MatrixFunctions>
+
+namespace frc {
+
+/**
+ * Discretizes the given continuous A and B matrices.
+ *
+ * @param contA Continuous system matrix.
+ * @param contB Continuous input matrix.
+ * @param dt    Discretization timestep.
+ * @param discA Storage for discrete system matrix.
+ * @param discB Storage for discrete input matrix.
+ */
+template <int States, int Inputs>
+void DiscretizeAB(const Eigen::Matrix<double, States, States>& contA,
+                  const Eigen::Matrix<double, States, Inputs>& contB,
+                  units::second_t dt,
+                  Eigen::Matrix<double, States, States>* discA,
+                  Eigen::Matrix<double, States, Inputs>* discB) {
+  // M = [A  B]
+  //     [0  0]
+  Eigen::Matrix<double, States + Inputs, States + Inputs> M;
+  M.setZero();
+  M.template block<States, States>(0, 0) = contA;
+  M.template block<States, Inputs>(0, States) = contB;
+
+  // phi = e^(MT) = [A_d  B_d]
+  //                [ 0    I ]
+  Eigen::Matrix<double, States + Inputs, States + Inputs> phi =
+      (M * dt.to<double>()).exp();
+
+  *discA = phi.template block<States, States>(0, 0);
+  *discB = phi.template block<States, Inputs>(0, States);
+}
+
+/**
+ * Discretizes the given continuous A matrix and process noise covariance
+ * matrix Q using Van Loan's method.
+ *
+ * @param contA Continuous system matrix.
+ * @param contQ Continuous process noise covariance matrix.
+ * @param dt    Discretization timestep.
+ * @param discA Storage for discrete system matrix.
+ * @param discQ Storage for discrete process noise covariance matrix.
+ */
+template <int States>
+void DiscretizeAQ(const Eigen::Matrix<double, States, States>& contA,
+                  const Eigen::Matrix<double, States, States>& contQ,
+                  units::second_t dt,
+                  Eigen::Matrix<double, States, States>* discA,
+                  Eigen::Matrix<double, States, States>* discQ) {
+  // Make continuous Q symmetric if it isn't already
+  Eigen::Matrix<double, States, States> Q = (contQ + contQ.transpose()) / 2.0;
+
+  // M = [-A  Q ]
+  //     [ 0  Aᵀ]
+  Eigen::Matrix<double, 2 * States, 2 * States> M;
+  M.template block<States, States>(0, 0) = -contA;
+  M.template block<States, States>(0, States) = Q;
+  M.template block<States, States>(States, 0).setZero();
+  M.template block<States, States>(States, States) = contA.transpose();
+
+  // phi = e^(MT) = [−  A_d⁻¹Q_d]
+  //                [0     A_dᵀ ]
+  Eigen::Matrix<double, 2 * States, 2 * States> phi =
+      (M * dt.to<double>()).exp();
+
+  Eigen::Matrix<double, States, States> phi12 =
+      phi.template block<States, States>(0, States);
+  Eigen::Matrix<double, States, States> phi22 =
+      phi.template block<States, States>(States, States);
+
+  *discA = phi22.transpose();
+
+  // Q_d = A_d (A_d⁻¹Q_d), made symmetric to remove rounding error
+  Q = *discA * phi12;
+  *discQ = (Q + Q.transpose()) / 2.0;
+}
+
+/**
+ * Returns a discretized version of the provided continuous measurement noise
+ * covariance matrix.
+ *
+ * @param R  Continuous measurement noise covariance matrix.
+ * @param dt Discretization timestep.
+ */
+template <int Outputs>
+Eigen::Matrix<double, Outputs, Outputs> DiscretizeR(
+    const Eigen::Matrix<double, Outputs, Outputs>& R, units::second_t dt) {
+  return R / dt.to<double>();
+}
+
+}  // namespace frc
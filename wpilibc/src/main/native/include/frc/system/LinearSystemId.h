@@ -0,0 +1,74 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <units/voltage.h>
+
+#include "frc/system/LinearSystem.h"
+
+namespace frc {
+
+/**
+ * Constructs the state-space model of a DC motor mechanism from its
+ * feedforward gains, as measured by the characterization tool.
+ *
+ * The gains have the same units as those of SimpleMotorFeedforward.
+ */
+template <class Distance>
+class LinearSystemId {
+ public:
+  using Velocity =
+      units::compound_unit<Distance, units::inverse<units::seconds>>;
+  using Acceleration =
+      units::compound_unit<Velocity, units::inverse<units::seconds>>;
+  using kv_unit = units::compound_unit<units::volts, units::inverse<Velocity>>;
+  using ka_unit =
+      units::compound_unit<units::volts, units::inverse<Acceleration>>;
+
+  /**
+   * Constructs a velocity system with the state [velocity], the input
+   * [voltage] and the output [velocity].
+   *
+   * @param kV The velocity gain, in volt seconds per distance.
+   * @param kA The acceleration gain, in volt seconds^2 per distance.
+   */
+  static LinearSystem<1, 1, 1> IdentifyVelocitySystem(
+      units::unit_t<kv_unit> kV, units::unit_t<ka_unit> kA) {
+    Eigen::Matrix<double, 1, 1> A;
+    A << -kV.template to<double>() / kA.template to<double>();
+    Eigen::Matrix<double, 1, 1> B;
+    B << 1.0 / kA.template to<double>();
+    Eigen::Matrix<double, 1, 1> C;
+    C << 1.0;
+    Eigen::Matrix<double, 1, 1> D;
+    D << 0.0;
+    return LinearSystem<1, 1, 1>(A, B, C, D);
+  }
+
+  /**
+   * Constructs a position system with the states [position, velocity], the
+   * input [voltage] and the output [position].
+   *
+   * @param kV The velocity gain, in volt seconds per distance.
+   * @param kA The acceleration gain, in volt seconds^2 per distance.
+   */
+  static LinearSystem<2, 1, 1> IdentifyPositionSystem(
+      units::unit_t<kv_unit> kV, units::unit_t<ka_unit> kA) {
+    Eigen::Matrix<double, 2, 2> A;
+    A << 0.0, 1.0, 0.0, -kV.template to<double>() / kA.template to<double>();
+    Eigen::Matrix<double, 2, 1> B;
+    B << 0.0, 1.0 / kA.template to<double>();
+    Eigen::Matrix<double, 1, 2> C;
+    C << 1.0, 0.0;
+    Eigen::Matrix<double, 1, 1> D;
+    D << 0.0;
+    return LinearSystem<2, 1, 1>(A, B, C, D);
+  }
+};
+
+}  // namespace frc
@@ -0,0 +1,196 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <Eigen/Core>
+#include <units/voltage.h>
+
+#include "frc/controller/LinearQuadraticRegulator.h"
+#include "frc/estimator/KalmanFilter.h"
+#include "frc/system/LinearSystem.h"
+
+namespace frc {
+
+/**
+ * Combines a plant, controller and observer for controlling a mechanism with
+ * full state feedback.
+ *
+ * For everything in this class, "inputs" are the control inputs to the plant
+ * and "outputs" are the measurements.  Call Correct() with the latest
+ * measurement and then Predict() once per loop; the voltage to apply is then
+ * available from U().  None of these allocate.
+ *
+ * @tparam States  The number of states.
+ * @tparam Inputs  The number of inputs.
+ * @tparam Outputs The number of outputs.
+ */
+template <int States, int Inputs, int Outputs>
+class LinearSystemLoop {
+ public:
+  /**
+   * Constructs a state-space loop with the given plant, controller and
+   * observer.  The loop keeps references to all three, so they must outlive
+   * it.
+   *
+   * @param plant      State-space plant.
+   * @param controller State-space controller.
+   * @param observer   State-space observer.
+   * @param maxVoltage The maximum magnitude of each control input.
+   */
+  LinearSystemLoop(LinearSystem<States, Inputs, Outputs>& plant,
+                   LinearQuadraticRegulator<States, Inputs>& controller,
+                   KalmanFilter<States, Inputs, Outputs>& observer,
+                   units::volt_t maxVoltage)
+      : m_plant(plant),
+        m_controller(controller),
+        m_observer(observer),
+        m_maxVoltage(maxVoltage.to<double>()) {
+    Reset();
+  }
+
+  LinearSystemLoop(const LinearSystemLoop&) = delete;
+  LinearSystemLoop& operator=(const LinearSystemLoop&) = delete;
+
+  /**
+   * Returns the observer's state estimate x-hat.
+   */
+  const Eigen::Matrix<double, States, 1>& Xhat() const {
+    return m_observer.Xhat();
+  }
+
+  /**
+   * Returns an element of the observer's state estimate x-hat.
+   *
+   * @param i Row of x-hat.
+   */
+  double Xhat(int i) const { return m_observer.Xhat(i); }
+
+  /**
+   * Returns the controller's next reference r.
+   */
+  const Eigen::Matrix<double, States, 1>& NextR() const { return m_nextR; }
+
+  /**
+   * Returns an element of the controller's next reference r.
+   *
+   * @param i Row of r.
+   */
+  double NextR(int i) const { return m_nextR(i); }
+
+  /**
+   * Returns the clamped control input u.
+   */
+  const Eigen::Matrix<double, Inputs, 1>& U() const { return m_u; }
+
+  /**
+   * Returns an element of the clamped control input u.
+   *
+   * @param i Row of u.
+   */
+  double U(int i) const { return m_u(i); }
+
+  /**
+   * Set the initial state estimate x-hat.
+   *
+   * @param xHat The initial state estimate x-hat.
+   */
+  void SetXhat(const Eigen::Matrix<double, States, 1>& xHat) {
+    m_observer.SetXhat(xHat);
+  }
+
+  /**
+   * Set an element of the initial state estimate x-hat.
+   *
+   * @param i     Row of x-hat.
+   * @param value Value for element of x-hat.
+   */
+  void SetXhat(int i, double value) { m_observer.SetXhat(i, value); }
+
+  /**
+   * Set the next reference r.
+   *
+   * @param nextR Next reference.
+   */
+  void SetNextR(const Eigen::Matrix<double, States, 1>& nextR) {
+    m_nextR = nextR;
+  }
+
+  /**
+   * Returns the plant used internally.
+   */
+  const LinearSystem<States, Inputs, Outputs>& Plant() const { return m_plant; }
+
+  /**
+   * Returns the controller used internally.
+   */
+  const LinearQuadraticRegulator<States, Inputs>& Controller() const {
+    return m_controller;
+  }
+
+  /**
+   * Returns the observer used internally.
+   */
+  const KalmanFilter<States, Inputs, Outputs>& Observer() const {
+    return m_observer;
+  }
+
+  /**
+   * Zeroes reference r, controller output u and the observer's state
+   * estimate.
+   */
+  void Reset() {
+    m_controller.Reset();
+    m_observer.Reset();
+    m_nextR.setZero();
+    m_u.setZero();
+  }
+
+  /**
+   * Returns the difference between reference r and the state estimate x-hat.
+   */
+  Eigen::Matrix<double, States, 1> Error() const {
+    return m_controller.R() - m_observer.Xhat();
+  }
+
+  /**
+   * Correct the state estimate x-hat using the measurements in y.
+   *
+   * @param y Measurement vector.
+   */
+  void Correct(const Eigen::Matrix<double, Outputs, 1>& y) {
+    m_observer.Correct(m_u, y);
+  }
+
+  /**
+   * Sets new controller output, projects model forward, and runs observer
+   * prediction.
+   *
+   * After calling this, the user should send the elements of u to the
+   * actuators.
+   */
+  void Predict() {
+    m_u = m_controller.Calculate(m_observer.Xhat(), m_nextR)
+              .cwiseMax(-m_maxVoltage)
+              .cwiseMin(m_maxVoltage);
+    m_observer.Predict(m_u);
+  }
+
+ private:
+  LinearSystem<States, Inputs, Outputs>& m_plant;
+  LinearQuadraticRegulator<States, Inputs>& m_controller;
+  KalmanFilter<States, Inputs, Outputs>& m_observer;
+  double m_maxVoltage;
+
+  // Reference to go to in the next cycle (used by the controller)
+  Eigen::Matrix<double, States, 1> m_nextR;
+
+  // Clamped control input applied in the last cycle
+  Eigen::Matrix<double, Inputs, 1> m_u;
+};
+
+}  // namespace frc
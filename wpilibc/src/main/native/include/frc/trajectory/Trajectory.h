@@ -9,7 +9,11 @@
 
 #include <vector>
 
-#include <units/units.h>
+#include <units/acceleration.h>
+#include <units/angle.h>
+#include <units/length.h>
+#include <units/time.h>
+#include <units/velocity.h>
 
 #include "frc/geometry/Pose2d.h"
 #include "frc/geometry/Transform2d.h"
@@ -20,6 +24,8 @@ class json;
 
 namespace frc {
 
+class Pose2dBatch;
+
 /**
  * Define a unit for curvature.
  */
@@ -134,6 +140,14 @@ class Trajectory {
    */
   Pose2d InitialPose() const { return Sample(0_s).pose; }
 
+  /**
+   * Returns the poses of all the states in the trajectory as a batch, for
+   * transforming or visualizing the whole path at once.
+   *
+   * @return The poses of the trajectory, in order.
+   */
+  Pose2dBatch GetPoses() const;
+
  private:
   std::vector<State> m_states;
   units::second_t m_totalTime;
@@ -11,7 +11,8 @@
 #include <utility>
 #include <vector>
 
-#include <units/units.h>
+#include <units/acceleration.h>
+#include <units/velocity.h>
 
 #include "frc/kinematics/DifferentialDriveKinematics.h"
 #include "frc/kinematics/MecanumDriveKinematics.h"
@@ -0,0 +1,112 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <utility>
+#include <vector>
+
+#include <units/time.h>
+
+#include "frc/geometry/Pose2d.h"
+#include "frc/trajectory/Trajectory.h"
+#include "frc/trajectory/TrajectoryConfig.h"
+
+namespace frc {
+
+/**
+ * Replans a trajectory while it is being followed.
+ *
+ * Replan() keeps the part of the current trajectory that has already been
+ * driven and splices a new tail onto it, starting from the state sampled at
+ * the current time.  The new tail starts with the sampled pose, heading,
+ * curvature and speed, so a follower sees no jump at the splice.  Timestamps
+ * continue from the current trajectory, so the follower's timer doesn't need
+ * to be reset.
+ *
+ * Parameterizing the splines is the expensive part of trajectory generation.
+ * Segments between two fixed waypoints are cached and reused by later
+ * replans, so typically only the segment leading from the robot to the first
+ * waypoint is parameterized again.  The work is bounded by a time budget that
+ * is checked between segments; if it runs out, Replan() fails without a
+ * result but keeps the segments finished so far, so calling it again on the
+ * next loop continues where it left off.
+ */
+class TrajectoryReplanner {
+ public:
+  using PoseWithCurvature = std::pair<Pose2d, curvature_t>;
+
+  /**
+   * Constructs a replanner.
+   *
+   * @param cacheSize Maximum number of parameterized segments to keep.
+   */
+  explicit TrajectoryReplanner(size_t cacheSize = 32);
+
+  /**
+   * Replans the remainder of a trajectory through new waypoints.
+   *
+   * Segments are quintic splines, as with the waypoint overload of
+   * TrajectoryGenerator::GenerateTrajectory().  The speed at the splice is
+   * kept as long as the constraints in config allow it there.
+   *
+   * @param current   The trajectory being followed.
+   * @param t         The time along current to splice at.
+   * @param waypoints The waypoints to drive through after the splice,
+   *                  ending with the goal.
+   * @param config    The configuration for the new tail.  Its start velocity
+   *                  is ignored in favor of the sampled velocity.
+   * @param budget    How long to spend parameterizing splines.
+   * @param result    Set to the replanned trajectory on success.
+   * @return False if waypoints is empty, a spline is malformed or the budget
+   *         ran out before the tail was finished.
+   */
+  bool Replan(const Trajectory& current, units::second_t t,
+              const std::vector<Pose2d>& waypoints,
+              const TrajectoryConfig& config, units::second_t budget,
+              Trajectory* result);
+
+  /**
+   * Forgets all cached segments.
+   */
+  void ClearCache();
+
+  /**
+   * Returns the number of segments reused from the cache.
+   */
+  uint64_t GetCacheHits() const { return m_hits; }
+
+  /**
+   * Returns the number of segments that had to be parameterized.
+   */
+  uint64_t GetCacheMisses() const { return m_misses; }
+
+ private:
+  struct Segment {
+    Pose2d start;
+    Pose2d end;
+    bool reversed;
+    uint64_t lastUse;
+    std::vector<PoseWithCurvature> points;
+  };
+
+  const Segment* FindSegment(const Pose2d& start, const Pose2d& end,
+                             bool reversed);
+  const Segment& AddSegment(const Pose2d& start, const Pose2d& end,
+                            bool reversed,
+                            std::vector<PoseWithCurvature>&& points);
+
+  size_t m_cacheSize;
+  std::vector<Segment> m_cache;
+  uint64_t m_useCount = 0;
+  uint64_t m_hits = 0;
+  uint64_t m_misses = 0;
+};
+
+}  // namespace frc
@@ -8,7 +8,15 @@
 #pragma once
 
 #include <hal/FRCUsageReporting.h>
-#include <units/units.h>
+// The profile is generic over the unit; include the dimensions it is most
+// often used with so callers don't have to.
+#include <units/acceleration.h>
+#include <units/angle.h>
+#include <units/angular_velocity.h>
+#include <units/length.h>
+#include <units/math.h>
+#include <units/time.h>
+#include <units/velocity.h>
 
 namespace frc {
 
@@ -7,7 +7,9 @@
 
 #pragma once
 
-#include <units/units.h>
+#include <units/length.h>
+#include <units/velocity.h>
+#include <units/voltage.h>
 
 #include "frc/controller/SimpleMotorFeedforward.h"
 #include "frc/kinematics/DifferentialDriveKinematics.h"
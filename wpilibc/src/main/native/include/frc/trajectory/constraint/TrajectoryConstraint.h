@@ -9,7 +9,8 @@
 
 #include <limits>
 
-#include <units/units.h>
+#include <units/acceleration.h>
+#include <units/velocity.h>
 
 #include "frc/geometry/Pose2d.h"
 #include "frc/spline/Spline.h"
@@ -0,0 +1,126 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include "frc/ErrorReporter.h"  // NOLINT(build/include_order)
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <wpi/mutex.h>
+
+#include "gtest/gtest.h"
+
+using namespace frc;
+
+namespace {
+struct Sent {
+  int32_t code;
+  std::string details;
+  std::string location;
+  std::string callStack;
+};
+
+class ErrorReporterTest : public testing::Test {
+ protected:
+  std::vector<Sent> GetSent() {
+    std::scoped_lock lock(m_mutex);
+    return m_sent;
+  }
+
+  // Waits for the sending thread to send count reports
+  std::vector<Sent> WaitForSent(size_t count) {
+    for (int i = 0; i < 100 && GetSent().size() < count; ++i)
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    return GetSent();
+  }
+
+  wpi::mutex m_mutex;
+  std::vector<Sent> m_sent;
+  ErrorReporter m_reporter{
+      [this](bool isError, int32_t code, const wpi::Twine& details,
+             const wpi::Twine& location, const wpi::Twine& callStack) {
+        std::scoped_lock lock(m_mutex);
+        m_sent.push_back(
+            {code, details.str(), location.str(), callStack.str()});
+      }};
+};
+}  // namespace
+
+TEST_F(ErrorReporterTest, Deduplicate) {
+  EXPECT_TRUE(
+      m_reporter.Report(true, -5, "fault", "dir/Device.cpp", "Get", 10));
+  for (int i = 0; i < 100; ++i)
+    EXPECT_FALSE(
+        m_reporter.Report(true, -5, "fault", "dir/Device.cpp", "Get", 10));
+
+  auto sent = WaitForSent(1);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  ASSERT_EQ(1u, GetSent().size());
+  EXPECT_EQ(-5, sent[0].code);
+  EXPECT_EQ("fault", sent[0].details);
+  EXPECT_EQ("Get [Device.cpp:10]", sent[0].location);
+  EXPECT_EQ(100u, m_reporter.GetSuppressedCount());
+}
+
+TEST_F(ErrorReporterTest, DistinctLocations) {
+  EXPECT_TRUE(m_reporter.Report(true, -5, "fault", "Device.cpp", "Get", 10));
+  EXPECT_TRUE(m_reporter.Report(true, -5, "fault", "Device.cpp", "Get", 11));
+  EXPECT_TRUE(m_reporter.Report(true, -6, "fault", "Device.cpp", "Get", 10));
+  EXPECT_TRUE(m_reporter.Report(true, -5, "fault", "Other.cpp", "Get", 10));
+  EXPECT_EQ(4u, WaitForSent(4).size());
+  EXPECT_EQ(0u, m_reporter.GetSuppressedCount());
+}
+
+TEST_F(ErrorReporterTest, RepeatAfterPeriod) {
+  m_reporter.SetRepeatPeriod(50_ms);
+  EXPECT_TRUE(m_reporter.Report(true, -5, "fault", "Device.cpp", "Get", 10));
+  EXPECT_FALSE(m_reporter.Report(true, -5, "fault", "Device.cpp", "Get", 10));
+  EXPECT_FALSE(m_reporter.Report(true, -5, "fault", "Device.cpp", "Get", 10));
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_TRUE(m_reporter.Report(true, -5, "again", "Device.cpp", "Get", 10));
+
+  auto sent = WaitForSent(2);
+  ASSERT_EQ(2u, sent.size());
+  EXPECT_EQ("again (repeated 2 times)", sent[1].details);
+  // the stack trace is only captured the first time
+  EXPECT_EQ(sent[0].callStack, sent[1].callStack);
+}
+
+TEST_F(ErrorReporterTest, Reset) {
+  EXPECT_TRUE(m_reporter.Report(true, -5, "fault", "Device.cpp", "Get", 10));
+  m_reporter.Reset();
+  EXPECT_TRUE(m_reporter.Report(true, -5, "fault", "Device.cpp", "Get", 10));
+  EXPECT_EQ(2u, WaitForSent(2).size());
+}
+
+TEST_F(ErrorReporterTest, Flush) {
+  m_reporter.SetRateLimit(100, 1);
+  for (int i = 0; i < 5; ++i)
+    EXPECT_TRUE(m_reporter.Report(true, -5, "fault", "Device.cpp", "Get", i));
+  m_reporter.Flush();
+  EXPECT_EQ(5u, GetSent().size());
+}
+
+TEST_F(ErrorReporterTest, RateLimit) {
+  m_reporter.SetRateLimit(0.001, 3);
+  for (int i = 0; i < 5; ++i)
+    EXPECT_TRUE(m_reporter.Report(true, -5, "fault", "Device.cpp", "Get", i));
+  WaitForSent(3);
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(3u, GetSent().size());
+}
+
+TEST_F(ErrorReporterTest, DropWhenFull) {
+  m_reporter.SetRateLimit(0.001, 1);
+  int sent = 0;
+  for (int i = 0; i < 100; ++i)
+    sent += m_reporter.Report(true, -5, "fault", "Device.cpp", "Get", i);
+  EXPECT_LE(sent, static_cast<int>(ErrorReporter::kMaxPending) + 1);
+  EXPECT_EQ(100u - sent, m_reporter.GetDroppedCount());
+}
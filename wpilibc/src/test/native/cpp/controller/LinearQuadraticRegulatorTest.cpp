@@ -0,0 +1,101 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include <cmath>
+
+#include <Eigen/Eigenvalues>
+#include <units/acceleration.h>
+#include <units/length.h>
+#include <units/velocity.h>
+
+#include "frc/controller/LinearQuadraticRegulator.h"
+#include "frc/system/DiscreteAlgebraicRiccatiEquation.h"
+#include "frc/system/LinearSystemId.h"
+#include "gtest/gtest.h"
+
+using namespace frc;
+
+TEST(LinearQuadraticRegulatorTest, RiccatiResidual) {
+  Eigen::Matrix<double, 2, 2> A;
+  A << 1.0, 0.02, 0.0, 0.9;
+  Eigen::Matrix<double, 2, 1> B;
+  B << 0.0, 0.05;
+  Eigen::Matrix<double, 2, 2> Q;
+  Q << 1.0, 0.0, 0.0, 0.1;
+  Eigen::Matrix<double, 1, 1> R;
+  R << 0.01;
+
+  Eigen::Matrix<double, 2, 2> S =
+      DiscreteAlgebraicRiccatiEquation<2, 1>(A, B, Q, R);
+
+  // AᵀSA − S − AᵀSB(BᵀSB + R)⁻¹BᵀSA + Q = 0
+  Eigen::Matrix<double, 2, 2> residual =
+      A.transpose() * S * A - S -
+      A.transpose() * S * B * (B.transpose() * S * B + R).inverse() *
+          B.transpose() * S * A +
+      Q;
+  EXPECT_LT(residual.norm(), 1e-8 * S.norm());
+}
+
+TEST(LinearQuadraticRegulatorTest, ScalarGain) {
+  // dx/dt = -x + 2u, discretized by hand
+  Eigen::Matrix<double, 1, 1> contA, contB;
+  contA << -1.0;
+  contB << 2.0;
+  double a = std::exp(-0.02);
+  double b = (1.0 - a) * 2.0;
+  double q = 1.0 / (0.1 * 0.1), r = 1.0 / (12.0 * 12.0);
+
+  // For x[k+1] = ax + bu, the Riccati equation is a quadratic in s
+  double c = q * b * b + a * a * r - r;
+  double s = (c + std::sqrt(c * c + 4 * b * b * q * r)) / (2 * b * b);
+  double k = b * s * a / (b * s * b + r);
+
+  Eigen::Matrix<double, 1, 1> A, B, Q, R;
+  A << a;
+  B << b;
+  Q << q;
+  R << r;
+  EXPECT_NEAR(s, (DiscreteAlgebraicRiccatiEquation<1, 1>(A, B, Q, R)(0, 0)),
+              1e-9 * s);
+
+  LinearQuadraticRegulator<1, 1> controller{contA, contB, {0.1}, {12.0}, 20_ms};
+  EXPECT_NEAR(k, controller.K(0, 0), 1e-9 * k);
+}
+
+TEST(LinearQuadraticRegulatorTest, StabilizesPositionSystem) {
+  auto plant = LinearSystemId<units::meters>::IdentifyPositionSystem(
+      1.98_V / 1_mps, 0.2_V / 1_mps_sq);
+  LinearQuadraticRegulator<2, 1> controller{plant, {0.02, 0.4}, {12.0}, 5_ms};
+
+  EXPECT_GT(controller.K(0, 0), 0.0);
+  EXPECT_GT(controller.K(0, 1), 0.0);
+
+  Eigen::Matrix<double, 2, 2> discA;
+  Eigen::Matrix<double, 2, 1> discB;
+  DiscretizeAB<2, 1>(plant.A(), plant.B(), 5_ms, &discA, &discB);
+  Eigen::Matrix<double, 2, 2> closedLoop = discA - discB * controller.K();
+  auto eigenvalues = closedLoop.eigenvalues();
+  for (int i = 0; i < 2; ++i) EXPECT_LT(std::abs(eigenvalues(i)), 1.0);
+}
+
+TEST(LinearQuadraticRegulatorTest, Calculate) {
+  auto plant = LinearSystemId<units::meters>::IdentifyVelocitySystem(
+      1.98_V / 1_mps, 0.2_V / 1_mps_sq);
+  LinearQuadraticRegulator<1, 1> controller{plant, {0.1}, {12.0}, 20_ms};
+
+  Eigen::Matrix<double, 1, 1> x, r;
+  x << 1.0;
+  r << 3.0;
+  EXPECT_DOUBLE_EQ(2.0 * controller.K(0, 0), controller.Calculate(x, r)(0));
+  EXPECT_DOUBLE_EQ(3.0, controller.R(0));
+  EXPECT_DOUBLE_EQ(2.0 * controller.K(0, 0), controller.U(0));
+
+  controller.Reset();
+  EXPECT_DOUBLE_EQ(0.0, controller.R(0));
+  EXPECT_DOUBLE_EQ(0.0, controller.U(0));
+}
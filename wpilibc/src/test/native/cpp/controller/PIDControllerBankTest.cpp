@@ -0,0 +1,134 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include <units/acceleration.h>
+#include <units/length.h>
+#include <units/velocity.h>
+#include <wpi/math>
+
+#include "frc/controller/ArmFeedforward.h"
+#include "frc/controller/PIDController.h"
+#include "frc/controller/PIDControllerBank.h"
+#include "frc/controller/SimpleMotorFeedforward.h"
+#include "gtest/gtest.h"
+
+TEST(PIDControllerBankTest, MatchesIndividualControllers) {
+  frc2::PIDControllerBank bank;
+  std::vector<frc2::PIDController> controllers;
+  controllers.reserve(8);
+
+  for (int i = 0; i < 8; ++i) {
+    double Kp = 0.5 + i, Ki = 0.1 * i, Kd = 0.01 * i;
+    bank.Add(Kp, Ki, Kd);
+    controllers.emplace_back(Kp, Ki, Kd);
+    if (i % 2 == 1) {
+      bank.EnableContinuousInput(i, -180, 180);
+      controllers.back().EnableContinuousInput(-180, 180);
+    }
+    bank.SetIntegratorRange(i, -0.5, 0.5);
+    controllers.back().SetIntegratorRange(-0.5, 0.5);
+    bank.SetSetpoint(i, 10.0 * i);
+    controllers.back().SetSetpoint(10.0 * i);
+  }
+
+  std::vector<double> measurements(8);
+  std::vector<double> outputs(8);
+  for (int step = 0; step < 50; ++step) {
+    for (int i = 0; i < 8; ++i) {
+      measurements[i] = 7.3 * i - 3.1 * step + 0.25;
+    }
+    bank.Calculate(measurements, outputs);
+    for (int i = 0; i < 8; ++i) {
+      EXPECT_NEAR(controllers[i].Calculate(measurements[i]), outputs[i], 1e-9)
+          << "loop " << i << " step " << step;
+    }
+  }
+}
+
+TEST(PIDControllerBankTest, ContinuousInput) {
+  frc2::PIDControllerBank bank;
+  bank.Add(1, 0, 0);
+  bank.EnableContinuousInput(0, -180, 180);
+  bank.SetSetpoint(0, 179);
+
+  double output = 0;
+  bank.Calculate({-179.0}, output);
+  EXPECT_LT(output, 0);
+  EXPECT_NEAR(-2.0, bank.GetPositionError(0), 1e-9);
+}
+
+TEST(PIDControllerBankTest, Feedforward) {
+  frc::SimpleMotorFeedforward<units::meters> motor{1_V, 2_V / 1_mps,
+                                                   0.5_V / 1_mps_sq};
+  frc::ArmFeedforward arm{0.5_V, 1.5_V, 0.75_V * 1_s / 1_rad,
+                          0.2_V * 1_s * 1_s / 1_rad};
+
+  frc2::PIDControllerBank bank;
+  bank.Add(0, 0, 0);
+  bank.Add(0, 0, 0);
+  bank.SetFeedforward(0, motor);
+  bank.SetFeedforward(1, arm);
+  bank.SetReference(0, 3.0, 1.5, -0.5);
+  bank.SetReference(1, 0.6, -2.0, 1.0);
+
+  std::vector<double> measurements{3.0, 0.6};
+  std::vector<double> outputs(2);
+  bank.Calculate(measurements, outputs);
+  EXPECT_NEAR(motor.Calculate(1.5_mps, -0.5_mps_sq).to<double>(), outputs[0],
+              1e-9);
+  EXPECT_NEAR(arm.Calculate(0.6_rad, -2_rad_per_s,
+                            units::unit_t<frc::ArmFeedforward::Acceleration>(
+                                1.0))
+                  .to<double>(),
+              outputs[1], 1e-9);
+}
+
+TEST(PIDControllerBankTest, CosineTable) {
+  frc2::PIDControllerBank bank;
+  bank.SetCosineTableEnabled(true);
+  bank.Add(0, 0, 0);
+  bank.SetFeedforward(0, 0, 0, 0, 1);
+
+  double output = 0;
+  for (double angle = -4 * wpi::math::pi; angle < 4 * wpi::math::pi;
+       angle += 0.01) {
+    bank.SetSetpoint(0, angle);
+    bank.Calculate({angle}, output);
+    EXPECT_NEAR(std::cos(angle), output, 1e-5) << "angle " << angle;
+  }
+}
+
+TEST(PIDControllerBankTest, AtSetpoint) {
+  frc2::PIDControllerBank bank;
+  bank.Add(1, 0, 0);
+  bank.SetTolerance(0, 0.1);
+  bank.SetSetpoint(0, 1.0);
+
+  double output = 0;
+  bank.Calculate({0.5}, output);
+  EXPECT_FALSE(bank.AtSetpoint(0));
+  bank.Calculate({0.95}, output);
+  EXPECT_TRUE(bank.AtSetpoint(0));
+}
+
+TEST(PIDControllerBankTest, SizeMismatchThrows) {
+  frc2::PIDControllerBank bank;
+  bank.Add(1, 0, 0);
+  bank.Add(1, 0, 0);
+
+  std::vector<double> two(2);
+  std::vector<double> three(3);
+  double one = 0;
+  EXPECT_THROW(bank.Calculate(three, two), std::invalid_argument);
+  EXPECT_THROW(bank.Calculate(two, three), std::invalid_argument);
+  EXPECT_THROW(bank.Calculate({1.0}, one), std::invalid_argument);
+  EXPECT_NO_THROW(bank.Calculate(two, two));
+}
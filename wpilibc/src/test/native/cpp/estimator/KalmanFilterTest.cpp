@@ -0,0 +1,97 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include <cmath>
+#include <random>
+
+#include <units/acceleration.h>
+#include <units/length.h>
+#include <units/velocity.h>
+
+#include "frc/estimator/KalmanFilter.h"
+#include "frc/system/Discretization.h"
+#include "frc/system/LinearSystemId.h"
+#include "gtest/gtest.h"
+
+using namespace frc;
+
+TEST(KalmanFilterTest, DiscretizeAB) {
+  Eigen::Matrix<double, 1, 1> contA, contB, discA;
+  Eigen::Matrix<double, 1, 1> discB;
+  contA << -2.0;
+  contB << 3.0;
+  DiscretizeAB<1, 1>(contA, contB, 50_ms, &discA, &discB);
+  EXPECT_NEAR(std::exp(-0.1), discA(0, 0), 1e-12);
+  EXPECT_NEAR((1.0 - std::exp(-0.1)) / 2.0 * 3.0, discB(0, 0), 1e-12);
+}
+
+TEST(KalmanFilterTest, DiscretizeAQ) {
+  // With A = 0 the state is a random walk, so Q grows linearly with time
+  Eigen::Matrix<double, 2, 2> contA, contQ, discA, discQ;
+  contA.setZero();
+  contQ << 4.0, 0.0, 0.0, 9.0;
+  DiscretizeAQ<2>(contA, contQ, 100_ms, &discA, &discQ);
+  EXPECT_TRUE(discA.isApprox(Eigen::Matrix<double, 2, 2>::Identity()));
+  EXPECT_TRUE(discQ.isApprox(contQ * 0.1));
+}
+
+TEST(KalmanFilterTest, TracksVelocitySystem) {
+  auto plant = LinearSystemId<units::meters>::IdentifyVelocitySystem(
+      1.98_V / 1_mps, 0.2_V / 1_mps_sq);
+  KalmanFilter<1, 1, 1> observer{plant, {3.0}, {0.5}, 5_ms};
+  EXPECT_GT(observer.K(0, 0), 0.0);
+  EXPECT_LT(observer.K(0, 0), 1.0);
+
+  Eigen::Matrix<double, 1, 1> discA, discB;
+  DiscretizeAB<1, 1>(plant.A(), plant.B(), 5_ms, &discA, &discB);
+
+  std::mt19937 gen(42);
+  std::normal_distribution<double> noise(0.0, 0.5);
+
+  Eigen::Matrix<double, 1, 1> x, u, y;
+  x.setZero();
+  u << 6.0;
+  for (int i = 0; i < 1000; ++i) {
+    x = discA * x + discB * u;
+    y = plant.CalculateY(x, u);
+    y(0) += noise(gen);
+    observer.Predict(u);
+    observer.Correct(u, y);
+  }
+
+  // The steady-state velocity is u / kV
+  EXPECT_NEAR(6.0 / 1.98, x(0), 1e-6);
+  EXPECT_NEAR(x(0), observer.Xhat(0), 0.2);
+}
+
+TEST(KalmanFilterTest, TracksPositionWithoutVelocityMeasurement) {
+  auto plant = LinearSystemId<units::meters>::IdentifyPositionSystem(
+      1.98_V / 1_mps, 0.2_V / 1_mps_sq);
+  KalmanFilter<2, 1, 1> observer{plant, {0.05, 1.0}, {0.001}, 5_ms};
+
+  Eigen::Matrix<double, 2, 2> discA;
+  Eigen::Matrix<double, 2, 1> discB;
+  DiscretizeAB<2, 1>(plant.A(), plant.B(), 5_ms, &discA, &discB);
+
+  Eigen::Matrix<double, 2, 1> x;
+  x << 0.5, 0.0;
+  Eigen::Matrix<double, 1, 1> u;
+  u << 2.0;
+  for (int i = 0; i < 400; ++i) {
+    x = discA * x + discB * u;
+    observer.Predict(u);
+    observer.Correct(u, plant.CalculateY(x, u));
+  }
+
+  // The unmeasured velocity is inferred from the position measurements
+  EXPECT_NEAR(x(0), observer.Xhat(0), 1e-3);
+  EXPECT_NEAR(x(1), observer.Xhat(1), 1e-2);
+
+  observer.Reset();
+  EXPECT_DOUBLE_EQ(0.0, observer.Xhat(0));
+  EXPECT_DOUBLE_EQ(0.0, observer.Xhat(1));
+}
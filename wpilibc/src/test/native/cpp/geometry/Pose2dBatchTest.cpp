@@ -0,0 +1,115 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "frc/geometry/Pose2dBatch.h"
+#include "gtest/gtest.h"
+
+using namespace frc;
+
+static constexpr double kEpsilon = 1E-9;
+
+static std::vector<Pose2d> MakePoses() {
+  return {Pose2d{},
+          Pose2d{1_m, 2_m, Rotation2d{45_deg}},
+          Pose2d{-3_m, 0.5_m, Rotation2d{170_deg}},
+          Pose2d{4_m, -1_m, Rotation2d{-95_deg}},
+          Pose2d{0.2_m, 0.1_m, Rotation2d{1E-12_rad}}};
+}
+
+static void ExpectPoseNear(const Pose2d& expected, const Pose2d& actual) {
+  EXPECT_NEAR(expected.Translation().X().to<double>(),
+              actual.Translation().X().to<double>(), kEpsilon);
+  EXPECT_NEAR(expected.Translation().Y().to<double>(),
+              actual.Translation().Y().to<double>(), kEpsilon);
+  EXPECT_NEAR(expected.Rotation().Cos(), actual.Rotation().Cos(), kEpsilon);
+  EXPECT_NEAR(expected.Rotation().Sin(), actual.Rotation().Sin(), kEpsilon);
+}
+
+TEST(Pose2dBatchTest, TransformBy) {
+  const auto poses = MakePoses();
+  const Transform2d transform{Translation2d{1_m, -2_m}, Rotation2d{30_deg}};
+
+  Pose2dBatch batch{poses};
+  batch.TransformBy(transform);
+
+  ASSERT_EQ(poses.size(), batch.Size());
+  for (size_t i = 0; i < poses.size(); ++i) {
+    ExpectPoseNear(poses[i] + transform, batch.Get(i));
+  }
+}
+
+TEST(Pose2dBatchTest, RelativeToAndBack) {
+  const auto poses = MakePoses();
+  const Pose2d origin{2_m, 3_m, Rotation2d{-60_deg}};
+
+  Pose2dBatch batch{poses};
+  batch.RelativeTo(origin);
+  for (size_t i = 0; i < poses.size(); ++i) {
+    ExpectPoseNear(poses[i].RelativeTo(origin), batch.Get(i));
+  }
+
+  batch.FromRelative(origin);
+  for (size_t i = 0; i < poses.size(); ++i) {
+    ExpectPoseNear(poses[i], batch.Get(i));
+  }
+}
+
+TEST(Pose2dBatchTest, ExpLog) {
+  const auto poses = MakePoses();
+  const Pose2d end{1_m, 1_m, Rotation2d{90_deg}};
+  std::vector<Pose2d> ends(poses.size(), end);
+
+  Pose2dBatch batch{poses};
+  auto twists = batch.Log(Pose2dBatch{ends});
+  for (size_t i = 0; i < poses.size(); ++i) {
+    EXPECT_EQ(poses[i].Log(end), twists.Get(i));
+  }
+
+  auto exp = batch.Exp(twists);
+  for (size_t i = 0; i < poses.size(); ++i) {
+    ExpectPoseNear(poses[i].Exp(twists.Get(i)), exp.Get(i));
+    ExpectPoseNear(end, exp.Get(i));
+  }
+}
+
+TEST(Pose2dBatchTest, Interpolate) {
+  const auto poses = MakePoses();
+  const Pose2d end{1_m, 1_m, Rotation2d{90_deg}};
+  std::vector<Pose2d> ends(poses.size(), end);
+
+  auto batch =
+      Pose2dBatch::Interpolate(Pose2dBatch{poses}, Pose2dBatch{ends}, 0.25);
+  for (size_t i = 0; i < poses.size(); ++i) {
+    ExpectPoseNear(poses[i] + (end - poses[i]) * 0.25, batch.Get(i));
+  }
+}
+
+TEST(Pose2dBatchTest, RepeatedTransformStaysNormalized) {
+  Pose2dBatch batch{MakePoses()};
+  const Transform2d transform{Translation2d{0.01_m, 0_m}, Rotation2d{0.1_deg}};
+  for (int i = 0; i < 100000; ++i) batch.TransformBy(transform);
+
+  for (size_t i = 0; i < batch.Size(); ++i) {
+    EXPECT_NEAR(1.0, std::hypot(batch.Cos()[i], batch.Sin()[i]), kEpsilon);
+  }
+}
+
+TEST(Pose2dBatchTest, SizeMismatchThrows) {
+  const Pose2dBatch batch{MakePoses()};
+  const Pose2dBatch shorter{3};
+  Twist2dBatch twists;
+  twists.Resize(2);
+
+  EXPECT_THROW(batch.Exp(twists), std::invalid_argument);
+  EXPECT_THROW(batch.Log(shorter), std::invalid_argument);
+  EXPECT_THROW(Pose2dBatch::Interpolate(batch, shorter, 0.5),
+               std::invalid_argument);
+}
@@ -65,3 +65,41 @@ TEST(Rotation2dTest, Inequality) {
   const auto two = Rotation2d(43.5_deg);
   EXPECT_TRUE(one != two);
 }
+
+TEST(Rotation2dTest, ConstexprComposition) {
+  constexpr Rotation2d zero;
+  constexpr auto sum = zero + -zero;
+
+  static_assert(sum.Cos() == 1.0, "Composition of identities is identity");
+  static_assert(sum.Sin() == 0.0, "Composition of identities is identity");
+  EXPECT_NEAR(sum.Radians().to<double>(), 0.0, kEpsilon);
+}
+
+TEST(Rotation2dTest, LongCompositionStaysNormalized) {
+  const auto step = Rotation2d(0.1_deg);
+  Rotation2d rot;
+  for (int i = 0; i < 100000; ++i) {
+    rot += step;
+  }
+
+  EXPECT_NEAR(std::hypot(rot.Cos(), rot.Sin()), 1.0, kEpsilon);
+  EXPECT_NEAR(rot.Degrees().to<double>(), 10000.0 - 28 * 360.0, 1E-6);
+}
+
+TEST(Rotation2dTest, NegationKeepsUnwrappedAngle) {
+  const auto rot = -Rotation2d(units::radian_t(3 * wpi::math::pi));
+
+  EXPECT_NEAR(rot.Radians().to<double>(), -3 * wpi::math::pi, kEpsilon);
+  EXPECT_NEAR(rot.Cos(), -1.0, kEpsilon);
+}
+
+TEST(Rotation2dTest, FullTurnIsNotEqual) {
+  const auto turn = Rotation2d(units::radian_t(2 * wpi::math::pi));
+  EXPECT_FALSE(Rotation2d(0_rad) == turn);
+  EXPECT_TRUE(Rotation2d(90_deg) + Rotation2d(90_deg) == Rotation2d(180_deg));
+}
+
+TEST(Rotation2dTest, LargeComponentsDontOverflow) {
+  const auto rot = Rotation2d(1E200, 1E200);
+  EXPECT_NEAR(rot.Degrees().to<double>(), 45.0, kEpsilon);
+}
@@ -0,0 +1,65 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include <cmath>
+
+#include <units/acceleration.h>
+#include <units/length.h>
+#include <units/velocity.h>
+
+#include "frc/system/LinearSystemId.h"
+#include "frc/system/LinearSystemLoop.h"
+#include "gtest/gtest.h"
+
+using namespace frc;
+
+namespace {
+class LinearSystemLoopTest : public testing::Test {
+ protected:
+  LinearSystem<2, 1, 1> m_plant =
+      LinearSystemId<units::meters>::IdentifyPositionSystem(1.98_V / 1_mps,
+                                                            0.2_V / 1_mps_sq);
+  LinearQuadraticRegulator<2, 1> m_controller{
+      m_plant, {0.02, 0.4}, {12.0}, 5_ms};
+  KalmanFilter<2, 1, 1> m_observer{m_plant, {0.05, 1.0}, {0.0001}, 5_ms};
+  LinearSystemLoop<2, 1, 1> m_loop{m_plant, m_controller, m_observer, 12_V};
+};
+}  // namespace
+
+TEST_F(LinearSystemLoopTest, ReachesReference) {
+  Eigen::Matrix<double, 2, 2> discA;
+  Eigen::Matrix<double, 2, 1> discB;
+  DiscretizeAB<2, 1>(m_plant.A(), m_plant.B(), 5_ms, &discA, &discB);
+
+  Eigen::Matrix<double, 2, 1> x, r;
+  x.setZero();
+  r << 2.0, 0.0;
+  m_loop.SetNextR(r);
+
+  for (int i = 0; i < 1000; ++i) {
+    m_loop.Correct(m_plant.CalculateY(x, m_loop.U()));
+    m_loop.Predict();
+    EXPECT_LE(std::abs(m_loop.U(0)), 12.0);
+    x = discA * x + discB * m_loop.U();
+  }
+
+  EXPECT_NEAR(2.0, x(0), 0.01);
+  EXPECT_NEAR(2.0, m_loop.Xhat(0), 0.01);
+  EXPECT_NEAR(0.0, m_loop.Error()(0), 0.01);
+}
+
+TEST_F(LinearSystemLoopTest, ClampsInput) {
+  Eigen::Matrix<double, 2, 1> r;
+  r << 100.0, 0.0;
+  m_loop.SetNextR(r);
+  m_loop.Predict();
+  EXPECT_DOUBLE_EQ(12.0, m_loop.U(0));
+
+  m_loop.Reset();
+  EXPECT_DOUBLE_EQ(0.0, m_loop.U(0));
+  EXPECT_DOUBLE_EQ(0.0, m_loop.NextR(0));
+}
@@ -0,0 +1,132 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include <vector>
+
+#include <units/math.h>
+
+#include "frc/trajectory/TrajectoryGenerator.h"
+#include "frc/trajectory/TrajectoryReplanner.h"
+#include "gtest/gtest.h"
+
+using namespace frc;
+
+namespace {
+class TrajectoryReplannerTest : public testing::Test {
+ protected:
+  void ExpectSpliced(const Trajectory& current, const Trajectory& replanned,
+                     units::second_t t, const Pose2d& goal) {
+    // Nothing driven before the splice changes
+    for (size_t i = 0; i < current.States().size(); ++i) {
+      if (current.States()[i].t >= t) break;
+      EXPECT_EQ(current.States()[i], replanned.States()[i]);
+    }
+
+    // The new tail starts where the robot is
+    auto before = current.Sample(t);
+    auto after = replanned.Sample(t);
+    EXPECT_EQ(before.pose, after.pose);
+    EXPECT_NEAR(before.velocity.to<double>(), after.velocity.to<double>(),
+                1e-6);
+    EXPECT_NEAR(before.curvature.to<double>(), after.curvature.to<double>(),
+                1e-3);
+
+    // ... and ends at the new goal
+    EXPECT_EQ(goal, replanned.States().back().pose);
+    EXPECT_EQ(0_mps, replanned.States().back().velocity);
+
+    units::second_t prev = -1_s;
+    for (const auto& state : replanned.States()) {
+      EXPECT_GE(state.t, prev);
+      prev = state.t;
+      EXPECT_LE(units::math::abs(state.velocity), 3_mps + 0.01_mps);
+      EXPECT_LE(units::math::abs(state.acceleration), 2_mps_sq + 0.01_mps_sq);
+    }
+  }
+
+  TrajectoryConfig m_config{3_mps, 2_mps_sq};
+  Trajectory m_current = TrajectoryGenerator::GenerateTrajectory(
+      {Pose2d(0_m, 0_m, Rotation2d(0_deg)),
+       Pose2d(3_m, 1_m, Rotation2d(45_deg)),
+       Pose2d(5_m, 3_m, Rotation2d(90_deg))},
+      m_config);
+  TrajectoryReplanner m_replanner;
+};
+}  // namespace
+
+TEST_F(TrajectoryReplannerTest, SplicesFromCurrentState) {
+  std::vector<Pose2d> waypoints{Pose2d(4_m, 2_m, Rotation2d(0_deg)),
+                                Pose2d(6_m, 2_m, Rotation2d(0_deg))};
+  Trajectory replanned;
+  ASSERT_TRUE(m_replanner.Replan(m_current, 1.5_s, waypoints, m_config, 1_s,
+                                 &replanned));
+  ExpectSpliced(m_current, replanned, 1.5_s, waypoints.back());
+
+  // The new path goes through the new waypoint
+  bool passed = false;
+  for (const auto& state : replanned.States())
+    passed |= state.pose == waypoints.front();
+  EXPECT_TRUE(passed);
+}
+
+TEST_F(TrajectoryReplannerTest, ReusesSegments) {
+  std::vector<Pose2d> waypoints{Pose2d(4_m, 2_m, Rotation2d(0_deg)),
+                                Pose2d(6_m, 2_m, Rotation2d(0_deg)),
+                                Pose2d(7_m, 4_m, Rotation2d(90_deg))};
+  Trajectory replanned;
+  ASSERT_TRUE(m_replanner.Replan(m_current, 1_s, waypoints, m_config, 1_s,
+                                 &replanned));
+  EXPECT_EQ(0u, m_replanner.GetCacheHits());
+  EXPECT_EQ(3u, m_replanner.GetCacheMisses());
+
+  // Only the segment from the robot is parameterized again
+  Trajectory replanned2;
+  ASSERT_TRUE(m_replanner.Replan(replanned, 1.5_s, waypoints, m_config, 1_s,
+                                 &replanned2));
+  EXPECT_EQ(2u, m_replanner.GetCacheHits());
+  EXPECT_EQ(4u, m_replanner.GetCacheMisses());
+  ExpectSpliced(replanned, replanned2, 1.5_s, waypoints.back());
+
+  m_replanner.ClearCache();
+  ASSERT_TRUE(m_replanner.Replan(m_current, 1_s, waypoints, m_config, 1_s,
+                                 &replanned));
+  EXPECT_EQ(2u, m_replanner.GetCacheHits());
+  EXPECT_EQ(7u, m_replanner.GetCacheMisses());
+}
+
+TEST_F(TrajectoryReplannerTest, Reversed) {
+  TrajectoryConfig config{3_mps, 2_mps_sq};
+  config.SetReversed(true);
+  m_current = TrajectoryGenerator::GenerateTrajectory(
+      {Pose2d(0_m, 0_m, Rotation2d(0_deg)),
+       Pose2d(-3_m, -1_m, Rotation2d(0_deg))},
+      config);
+
+  std::vector<Pose2d> waypoints{Pose2d(-4_m, 1_m, Rotation2d(0_deg))};
+  Trajectory replanned;
+  ASSERT_TRUE(m_replanner.Replan(m_current, 1_s, waypoints, config, 1_s,
+                                 &replanned));
+  ExpectSpliced(m_current, replanned, 1_s, waypoints.back());
+  EXPECT_LT(replanned.Sample(1.5_s).velocity, 0_mps);
+}
+
+TEST_F(TrajectoryReplannerTest, OutOfTime) {
+  std::vector<Pose2d> waypoints{Pose2d(4_m, 2_m, Rotation2d(0_deg))};
+  Trajectory replanned;
+  EXPECT_FALSE(m_replanner.Replan(m_current, 1_s, waypoints, m_config, 0_s,
+                                  &replanned));
+  EXPECT_TRUE(replanned.States().empty());
+}
+
+TEST_F(TrajectoryReplannerTest, NoWaypoints) {
+  Trajectory replanned;
+  EXPECT_FALSE(
+      m_replanner.Replan(m_current, 1_s, {}, m_config, 1_s, &replanned));
+  EXPECT_FALSE(m_replanner.Replan(m_current, 1_s,
+                                  {m_current.Sample(1_s).pose}, m_config, 1_s,
+                                  &replanned));
+}
@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""Measures how long the C++ examples and templates take to compile.
+
+Each translation unit under src/main/cpp is compiled on its own against the
+in-tree headers (no linking), and the wall time per file is reported. This is
+meant for comparing header changes, such as the split of units/units.h, before
+and after; run it on both revisions with the same arguments.
+
+Usage: measure_compile_time.py [--cxx g++] [--jobs N] [--json out.json]
+                               [--filter SUBSTR] [-I DIR ...] [-D DEF ...]
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import time
+from concurrent.futures import ThreadPoolExecutor
+
+dirname = os.path.dirname(os.path.abspath(__file__))
+root = os.path.dirname(dirname)
+
+include_dirs = [
+    "wpiutil/src/main/native/include",
+    "wpiutil/src/main/native/eigeninclude",
+    "ntcore/src/main/native/include",
+    "hal/src/main/native/include",
+    "cscore/src/main/native/include",
+    "cameraserver/src/main/native/include",
+    "wpilibc/src/main/native/include",
+    "wpilibOldCommands/src/main/native/include",
+    "wpilibNewCommands/src/main/native/include",
+]
+
+
+def find_sources(filt):
+    sources = []
+    for kind in ("examples", "templates"):
+        base = os.path.join(dirname, "src/main/cpp", kind)
+        for project in sorted(os.listdir(base)):
+            project_dir = os.path.join(base, project)
+            if not os.path.isdir(project_dir):
+                continue
+            for path, _, files in os.walk(project_dir):
+                for f in sorted(files):
+                    if not f.endswith(".cpp"):
+                        continue
+                    name = os.path.relpath(os.path.join(path, f), base)
+                    if filt and filt not in name:
+                        continue
+                    sources.append((project_dir, name, os.path.join(path, f)))
+    return sources
+
+
+def compile_one(args, project_dir, source):
+    cmd = [args.cxx, "-std=c++17", "-c", "-o", os.devnull, source]
+    cmd += ["-I" + os.path.join(project_dir, "include")]
+    cmd += ["-I" + os.path.join(root, d) for d in include_dirs]
+    cmd += ["-I" + d for d in args.include]
+    cmd += ["-D" + d for d in args.define]
+    start = time.perf_counter()
+    result = subprocess.run(cmd, stdout=subprocess.DEVNULL,
+                            stderr=subprocess.PIPE)
+    return time.perf_counter() - start, result.returncode == 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--cxx", default=os.environ.get("CXX", "g++"))
+    parser.add_argument("--jobs", type=int, default=1)
+    parser.add_argument("--json", help="write per-file results to this file")
+    parser.add_argument("--filter", help="only compile paths containing this")
+    parser.add_argument("-I", dest="include", action="append", default=[])
+    parser.add_argument("-D", dest="define", action="append", default=[])
+    args = parser.parse_args()
+
+    sources = find_sources(args.filter)
+    with ThreadPoolExecutor(max_workers=args.jobs) as pool:
+        futures = [(name, pool.submit(compile_one, args, project_dir, source))
+                   for project_dir, name, source in sources]
+        results = [(name, ) + f.result() for name, f in futures]
+
+    ok = [r for r in results if r[2]]
+    failed = [r[0] for r in results if not r[2]]
+    total = sum(r[1] for r in ok)
+    for name, seconds, _ in sorted(ok, key=lambda r: -r[1])[:10]:
+        print(f"{seconds:8.2f} s  {name}")
+    print(f"{len(ok)} files compiled in {total:.1f} s "
+          f"({total / max(len(ok), 1):.2f} s/file)")
+    if failed:
+        # typically examples that need OpenCV or generated headers
+        print(f"{len(failed)} files skipped (did not compile)", file=sys.stderr)
+
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump({"total": total,
+                       "files": {r[0]: r[1] for r in ok},
+                       "failed": failed}, f, indent=2)
+
+
+if __name__ == "__main__":
+    main()
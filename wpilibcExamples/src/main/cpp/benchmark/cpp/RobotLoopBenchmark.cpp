@@ -0,0 +1,321 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include "RobotLoopBenchmark.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <new>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include <hal/HALBase.h>
+#include <mockdata/DriverStationData.h>
+#include <mockdata/MockHooks.h>
+#include <networktables/NetworkTableInstance.h>
+#include <wpi/Format.h>
+#include <wpi/Path.h>
+#include <wpi/json.h>
+#include <wpi/raw_ostream.h>
+
+using namespace frc;
+using namespace frc::bench;
+
+// Heap allocations made by each thread. Replacing the global allocation
+// functions in the executable covers the shared libraries as well on ELF and
+// Mach-O platforms; with the Windows DLL runtime only allocations made by the
+// benchmark's own code are counted.
+static thread_local uint64_t gAllocations = 0;
+
+void* operator new(std::size_t size) {
+  ++gAllocations;
+  if (void* p = malloc(size == 0 ? 1 : size)) return p;
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept { free(p); }
+
+namespace {
+
+int64_t ThreadCpuTimeNs() {
+#ifdef _WIN32
+  FILETIME creation, exit, kernel, user;
+  GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user);
+  auto ticks = [](const FILETIME& t) {
+    return (static_cast<int64_t>(t.dwHighDateTime) << 32) | t.dwLowDateTime;
+  };
+  return (ticks(kernel) + ticks(user)) * 100;
+#else
+  timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+size_t UlebSize(size_t value) {
+  size_t size = 1;
+  while (value >= 0x80) {
+    value >>= 7;
+    ++size;
+  }
+  return size;
+}
+
+size_t StringSize(wpi::StringRef str) {
+  return UlebSize(str.size()) + str.size();
+}
+
+// Encoded size of a value in the NetworkTables 3.0 protocol.
+size_t ValueSize(const nt::Value& value) {
+  switch (value.type()) {
+    case NT_BOOLEAN:
+      return 1;
+    case NT_DOUBLE:
+      return 8;
+    case NT_STRING:
+      return StringSize(value.GetString());
+    case NT_RAW:
+      return StringSize(value.GetRaw());
+    case NT_RPC:
+      return StringSize(value.GetRpc());
+    case NT_BOOLEAN_ARRAY:
+      return 1 + value.GetBooleanArray().size();
+    case NT_DOUBLE_ARRAY:
+      return 1 + 8 * value.GetDoubleArray().size();
+    case NT_STRING_ARRAY: {
+      size_t size = 1;
+      for (const auto& str : value.GetStringArray()) size += StringSize(str);
+      return size;
+    }
+    default:
+      return 0;
+  }
+}
+
+// Size of the message a server sends its clients for a local change.
+size_t MessageSize(const nt::EntryNotification& event) {
+  if (event.flags & NT_NOTIFY_DELETE) return 3;
+  if (event.flags & NT_NOTIFY_NEW) {
+    // entry assignment: type, name, value type, id, sequence number, flags
+    return 7 + StringSize(event.name) + ValueSize(*event.value);
+  }
+  if (event.flags & NT_NOTIFY_FLAGS) return 4;
+  // entry update: type, id, sequence number, value type
+  return 6 + ValueSize(*event.value);
+}
+
+struct Stats {
+  double mean = 0;
+  int64_t p50 = 0;
+  int64_t p99 = 0;
+  int64_t max = 0;
+  int64_t total = 0;
+};
+
+Stats Summarize(std::vector<int64_t> samples) {
+  Stats stats;
+  if (samples.empty()) return stats;
+  std::sort(samples.begin(), samples.end());
+  for (auto sample : samples) stats.total += sample;
+  stats.mean = static_cast<double>(stats.total) / samples.size();
+  stats.p50 = samples[samples.size() / 2];
+  stats.p99 = samples[(samples.size() * 99) / 100];
+  stats.max = samples.back();
+  return stats;
+}
+
+wpi::json ToJson(const Stats& stats) {
+  return {{"mean", stats.mean},
+          {"p50", stats.p50},
+          {"p99", stats.p99},
+          {"max", stats.max},
+          {"total", stats.total}};
+}
+
+}  // namespace
+
+RobotLoopBenchmark::RobotLoopBenchmark(int argc, char** argv) {
+  if (argc > 0) m_programName = wpi::sys::path::filename(argv[0]);
+  for (int i = 1; i < argc; ++i) {
+    wpi::StringRef arg{argv[i]};
+    if (arg == "--loops" && i + 1 < argc) {
+      m_loops = std::max(1, atoi(argv[++i]));
+    } else if (arg == "--json" && i + 1 < argc) {
+      m_jsonPath = argv[++i];
+    } else {
+      wpi::errs() << "usage: " << m_programName
+                  << " [--loops N] [--json FILE]\n";
+      m_argsValid = false;
+    }
+  }
+}
+
+int RobotLoopBenchmark::Run(std::function<void()> loopFunc,
+                            const Watchdog& watchdog,
+                            units::second_t period) {
+  if (!m_argsValid) return 1;
+
+  // Count what NetworkTables would publish: every local change to an entry
+  // is sent to each client, so this is the per-client traffic.
+  auto inst = nt::NetworkTableInstance::GetDefault();
+  NT_EntryListener listener = inst.AddEntryListener(
+      "",
+      [&](const nt::EntryNotification& event) {
+        m_ntBytes += MessageSize(event);
+      },
+      NT_NOTIFY_LOCAL | NT_NOTIFY_NEW | NT_NOTIFY_UPDATE | NT_NOTIFY_DELETE |
+          NT_NOTIFY_FLAGS);
+
+  HALSIM_PauseTiming();
+  HALSIM_SetDriverStationDsAttached(true);
+
+  int64_t periodUs = static_cast<int64_t>(period.to<double>() * 1e6);
+  struct {
+    const char* name;
+    bool enabled;
+    bool autonomous;
+  } modes[] = {{"disabled", false, false},
+               {"autonomous", true, true},
+               {"teleop", true, false}};
+  for (const auto& mode : modes) {
+    HALSIM_SetDriverStationEnabled(mode.enabled);
+    HALSIM_SetDriverStationAutonomous(mode.autonomous);
+    HALSIM_NotifyDriverStationNewData();
+
+    m_modes.emplace_back();
+    m_modes.back().name = mode.name;
+    RunMode(&m_modes.back(), loopFunc, watchdog, periodUs);
+  }
+
+  HALSIM_SetDriverStationEnabled(false);
+  HALSIM_NotifyDriverStationNewData();
+  inst.RemoveEntryListener(listener);
+
+  return Report();
+}
+
+void RobotLoopBenchmark::RunMode(ModeSamples* samples,
+                                 const std::function<void()>& loopFunc,
+                                 const Watchdog& watchdog, int64_t periodUs) {
+  auto inst = nt::NetworkTableInstance::GetDefault();
+
+  for (int i = 0; i < m_loops; ++i) {
+    // Let simulated time run with the wall clock during the loop so the
+    // watchdog's epochs measure real time.
+    HALSIM_ResumeTiming();
+    int32_t status = 0;
+    uint64_t loopStart = HAL_GetFPGATime(&status);
+    uint64_t ntBytesStart = m_ntBytes;
+    uint64_t allocationsStart = gAllocations;
+    int64_t cpuStart = ThreadCpuTimeNs();
+    auto wallStart = std::chrono::steady_clock::now();
+
+    loopFunc();
+
+    auto wallEnd = std::chrono::steady_clock::now();
+    int64_t cpuEnd = ThreadCpuTimeNs();
+    uint64_t allocationsEnd = gAllocations;
+    HALSIM_PauseTiming();
+
+    // Advance to the start of the next period, as the robot's notifier would
+    int64_t elapsedUs = HAL_GetFPGATime(&status) - loopStart;
+    if (elapsedUs < periodUs) HALSIM_StepTiming(periodUs - elapsedUs);
+
+    // Wait for the listener to see this loop's changes before sampling
+    inst.WaitForEntryListenerQueue(1.0);
+
+    samples->wallNs.push_back(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(wallEnd -
+                                                             wallStart)
+            .count());
+    samples->cpuNs.push_back(cpuEnd - cpuStart);
+    samples->allocations.push_back(allocationsEnd - allocationsStart);
+    samples->ntBytes.push_back(m_ntBytes - ntBytesStart);
+    for (const auto& epoch : watchdog.GetEpochs()) {
+      samples->phaseNs[epoch.getKey()].push_back(epoch.getValue().count());
+    }
+  }
+}
+
+int RobotLoopBenchmark::Report() const {
+  wpi::json json;
+  json["benchmark"] = m_programName;
+  json["loops_per_mode"] = m_loops;
+
+  struct Phase {
+    std::string mode;
+    std::string name;
+    Stats stats;
+  };
+  std::vector<Phase> phases;
+
+  auto& out = wpi::outs();
+  for (const auto& mode : m_modes) {
+    Stats wall = Summarize(mode.wallNs);
+    Stats cpu = Summarize(mode.cpuNs);
+    Stats allocations = Summarize(mode.allocations);
+    Stats ntBytes = Summarize(mode.ntBytes);
+
+    out << mode.name << ": "
+        << wpi::format("%.1f us/loop (p99 %.1f), %.1f us CPU, ",
+                       wall.mean / 1e3, wall.p99 / 1e3, cpu.mean / 1e3)
+        << wpi::format("%.1f allocations, %.1f NT bytes\n", allocations.mean,
+                       ntBytes.mean);
+
+    auto& modeJson = json["modes"][mode.name];
+    modeJson["wall_ns"] = ToJson(wall);
+    modeJson["cpu_ns"] = ToJson(cpu);
+    modeJson["allocations"] = ToJson(allocations);
+    modeJson["nt_bytes"] = ToJson(ntBytes);
+    for (const auto& phase : mode.phaseNs) {
+      Stats stats = Summarize(phase.getValue());
+      modeJson["phases_ns"][phase.getKey()] = ToJson(stats);
+      phases.push_back({mode.name, phase.getKey(), stats});
+    }
+  }
+
+  // Rank by total time so the one-off mode Init() calls don't crowd out the
+  // phases that run every loop
+  std::sort(phases.begin(), phases.end(), [](const auto& a, const auto& b) {
+    return a.stats.total > b.stats.total;
+  });
+  if (phases.size() > 5) phases.resize(5);
+  out << "slowest phases:\n";
+  auto& slowest = json["slowest_phases"];
+  slowest = wpi::json::array();
+  for (const auto& phase : phases) {
+    out << wpi::format("  %10.1f us total, %8.1f us mean  ",
+                       phase.stats.total / 1e3, phase.stats.mean / 1e3)
+        << phase.mode << ' ' << phase.name << '\n';
+    slowest.push_back({{"mode", phase.mode},
+                       {"phase", phase.name},
+                       {"total_ns", phase.stats.total},
+                       {"mean_ns", phase.stats.mean},
+                       {"max_ns", phase.stats.max}});
+  }
+
+  if (!m_jsonPath.empty()) {
+    std::error_code ec;
+    wpi::raw_fd_ostream os{m_jsonPath, ec};
+    if (ec) {
+      wpi::errs() << "could not open " << m_jsonPath << ": " << ec.message()
+                  << '\n';
+      return 1;
+    }
+    json.dump(os, 2);
+    os << '\n';
+  }
+  out.flush();
+  return 0;
+}
@@ -0,0 +1,15 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+// Built once per benchmarked example, against that example's include
+// directory; the example's own main() is compiled out by RUNNING_FRC_TESTS.
+#include "Robot.h"
+#include "RobotLoopBenchmark.h"
+
+int main(int argc, char** argv) {
+  return frc::bench::RunRobotLoopBenchmark<Robot>(argc, argv);
+}
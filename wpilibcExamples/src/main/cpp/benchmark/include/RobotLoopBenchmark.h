@@ -0,0 +1,115 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <frc/RobotBase.h>
+#include <frc/Watchdog.h>
+#include <units/time.h>
+#include <wpi/StringMap.h>
+
+namespace frc {
+namespace bench {
+
+/**
+ * Runs a robot program's main loop against the simulation HAL and records
+ * what each iteration costs.
+ *
+ * The robot is taken through disabled, autonomous and teleop for a fixed
+ * number of loops each. Simulated time is stepped so that it advances by
+ * exactly one period per loop (or by the time the loop took, if it overran),
+ * so timers and commands behave as they would on a robot while the loops run
+ * back to back.
+ *
+ * For every loop the wall and thread CPU time, the heap allocations made on
+ * the loop thread, the bytes NetworkTables would send for the entries that
+ * changed, and the loop watchdog's epochs (RobotPeriodic(), which runs
+ * CommandScheduler::Run() in command-based programs,
+ * SmartDashboard::UpdateValues(), LiveWindow::UpdateValues() and so on) are
+ * recorded. A summary is printed and, with --json, written as JSON for trend
+ * tracking.
+ *
+ * Command line: [--loops N] [--json FILE]
+ */
+class RobotLoopBenchmark {
+ public:
+  RobotLoopBenchmark(int argc, char** argv);
+
+  /**
+   * Runs the benchmark and reports the results.
+   *
+   * @param loopFunc Runs one iteration of the robot's main loop.
+   * @param watchdog The watchdog that times loopFunc.
+   * @param period   The robot's loop period.
+   * @return The program's exit code.
+   */
+  int Run(std::function<void()> loopFunc, const Watchdog& watchdog,
+          units::second_t period);
+
+ private:
+  struct ModeSamples {
+    std::string name;
+    std::vector<int64_t> wallNs;
+    std::vector<int64_t> cpuNs;
+    std::vector<int64_t> allocations;
+    std::vector<int64_t> ntBytes;
+    wpi::StringMap<std::vector<int64_t>> phaseNs;
+  };
+
+  void RunMode(ModeSamples* samples, const std::function<void()>& loopFunc,
+               const Watchdog& watchdog, int64_t periodUs);
+  int Report() const;
+
+  std::string m_programName;
+  std::string m_jsonPath;
+  int m_loops = 250;
+  bool m_argsValid = true;
+  std::atomic<uint64_t> m_ntBytes{0};
+  std::vector<ModeSamples> m_modes;
+};
+
+namespace detail {
+// Exposes the loop and its watchdog, which the benchmark drives in place of
+// StartCompetition().
+template <class Robot>
+class BenchmarkRobot : public Robot {
+ public:
+  using Robot::GetLoopWatchdog;
+  using Robot::LoopFunc;
+
+  units::second_t GetLoopPeriod() const { return this->m_period; }
+};
+}  // namespace detail
+
+/**
+ * Constructs a robot and runs a RobotLoopBenchmark on it. Call this from
+ * main() in place of StartRobot().
+ */
+template <class Robot>
+int RunRobotLoopBenchmark(int argc, char** argv) {
+  RobotLoopBenchmark benchmark{argc, argv};
+
+  int halInit = RunHALInitialization();
+  if (halInit != 0) {
+    return halInit;
+  }
+
+  detail::BenchmarkRobot<Robot> robot;
+  robot.RobotInit();
+  return benchmark.Run([&] { robot.LoopFunc(); }, robot.GetLoopWatchdog(),
+                       robot.GetLoopPeriod());
+}
+
+}  // namespace bench
+}  // namespace frc
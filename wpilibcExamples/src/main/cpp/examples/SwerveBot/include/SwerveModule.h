@@ -12,6 +12,8 @@
 #include <frc/controller/PIDController.h>
 #include <frc/controller/ProfiledPIDController.h>
 #include <frc/kinematics/SwerveModuleState.h>
+#include <units/angle.h>
+#include <units/angular_velocity.h>
 #include <wpi/math>
 
 class SwerveModule {
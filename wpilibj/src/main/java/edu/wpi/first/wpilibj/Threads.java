@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2008-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2008-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -40,6 +40,30 @@ public final class Threads {
     return ThreadsJNI.setCurrentThreadPriority(realTime, priority);
   }
 
+  /**
+  * Sets the CPUs the current thread may run on. Ignored in simulation.
+  *
+  * @param cpus The CPU numbers, starting from 0. None to allow all CPUs
+  *
+  * @return The success state of setting the affinity
+  */
+  public static boolean setCurrentThreadAffinity(int... cpus) {
+    return ThreadsJNI.setCurrentThreadAffinity(cpus);
+  }
+
+  /**
+  * Locks all current and future process memory into RAM, so real-time threads
+  * never wait on a page fault, and prefaults the current thread's stack.
+  * Ignored in simulation.
+  *
+  * @param stackSize Bytes of the current thread's stack to prefault
+  *
+  * @return The success state of locking memory
+  */
+  public static boolean lockMemory(int stackSize) {
+    return ThreadsJNI.lockMemory(stackSize);
+  }
+
   private Threads() {
   }
 }
@@ -0,0 +1,82 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "wpi/Format.h"
+#include "wpi/WorkerThread.h"
+#include "wpi/future.h"
+#include "wpi/raw_ostream.h"
+
+static constexpr int kOutstanding = 500;
+static constexpr int kWaiters = 8;
+static constexpr int kRuns = 20;
+
+// Runs func kRuns times and reports the mean time per run.
+template <typename F>
+static void Run(const char* name, F&& func) {
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kRuns; ++i) func();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  wpi::outs() << name << ": "
+              << wpi::format("%.1f", elapsed.count() * 1e6 / kRuns)
+              << " us/run\n";
+  wpi::outs().flush();
+}
+
+// Times kOutstanding futures completed in a random order while kWaiters
+// threads block on their share of them, futures with continuations attached,
+// and requests queued faster than a WorkerThread completes them.
+void RunFutureBenchmark() {
+  std::vector<int> order(kOutstanding);
+  for (int i = 0; i < kOutstanding; ++i) order[i] = i;
+  std::shuffle(order.begin(), order.end(), std::mt19937{42});
+
+  Run("future waiters", [&] {
+    std::vector<wpi::promise<int>> promises(kOutstanding);
+    std::vector<wpi::future<int>> futures;
+    for (auto& p : promises) futures.emplace_back(p.get_future());
+    std::vector<std::thread> waiters;
+    for (int w = 0; w < kWaiters; ++w) {
+      waiters.emplace_back([&, w] {
+        for (int i = w; i < kOutstanding; i += kWaiters) futures[i].get();
+      });
+    }
+    for (int i : order) promises[i].set_value(i);
+    for (auto& thr : waiters) thr.join();
+  });
+
+  Run("future continuations", [] {
+    std::vector<wpi::promise<int>> promises(kOutstanding);
+    std::vector<wpi::future<int>> futures;
+    for (auto& p : promises) {
+      futures.emplace_back(
+          p.get_future().then([](int v) { return v + 1; }).then([](int v) {
+            return v * 2;
+          }));
+    }
+    std::thread producer([&] {
+      for (int i = 0; i < kOutstanding; ++i) promises[i].set_value(i);
+    });
+    for (auto& f : futures) f.get();
+    producer.join();
+  });
+
+  wpi::WorkerThread<int(int)> worker;
+  Run("WorkerThread requests", [&] {
+    std::vector<wpi::future<int>> futures;
+    for (int i = 0; i < kOutstanding; ++i) {
+      futures.emplace_back(worker.QueueWork([](int v) { return v; }, i));
+    }
+    for (auto& f : futures) f.get();
+  });
+}
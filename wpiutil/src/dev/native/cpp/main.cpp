@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2017-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2017-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -11,7 +11,11 @@
 #include "wpi/StringRef.h"
 #include "wpi/hostname.h"
 
+void RunFutureBenchmark();
+
 int main() {
   wpi::StringRef v1("Hello");
   std::cout << v1.lower() << std::endl;
+
+  RunFutureBenchmark();
 }
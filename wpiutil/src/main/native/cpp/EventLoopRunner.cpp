@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2018-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2018-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -8,6 +8,7 @@
 #include "wpi/EventLoopRunner.h"
 
 #include "wpi/SmallVector.h"
+#include "wpi/ThreadHooks.h"
 #include "wpi/condition_variable.h"
 #include "wpi/mutex.h"
 #include "wpi/uv/AsyncFunction.h"
@@ -32,6 +33,7 @@ class EventLoopRunner::Thread : public SafeThread {
   }
 
   void Main() {
+    SetCurrentThreadName("EventLoop");
     if (m_loop) m_loop->Run();
   }
 
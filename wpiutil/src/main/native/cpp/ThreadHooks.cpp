@@ -0,0 +1,65 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include "wpi/ThreadHooks.h"
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <pthread.h>
+#endif
+
+#include <utility>
+
+#include "wpi/SmallString.h"
+#include "wpi/Trace.h"
+#include "wpi/mutex.h"
+
+using namespace wpi;
+
+namespace {
+struct Hooks {
+  wpi::mutex mutex;
+  ThreadStartHook start;
+};
+}  // namespace
+
+static Hooks& GetHooks() {
+  static Hooks hooks;
+  return hooks;
+}
+
+void wpi::SetThreadStartHook(ThreadStartHook hook) {
+  auto& hooks = GetHooks();
+  std::scoped_lock lock(hooks.mutex);
+  hooks.start = std::move(hook);
+}
+
+void wpi::SetCurrentThreadName(const Twine& name) {
+  SmallString<64> buf;
+  StringRef nameStr = name.toNullTerminatedStringRef(buf);
+
+#if defined(__linux__)
+  // Linux limits names to 16 bytes, including the terminator
+  SmallString<16> osName{nameStr.take_front(15)};
+  pthread_setname_np(pthread_self(), osName.c_str());
+#elif defined(__APPLE__)
+  pthread_setname_np(nameStr.data());
+#endif
+
+  // This doesn't allocate a trace buffer, so threads that are created over
+  // and over (such as network connection threads) don't accumulate them
+  // while tracing is off
+  trace::SetThreadName(nameStr);
+
+  // Call a copy so the hook may itself set the hook
+  ThreadStartHook hook;
+  {
+    auto& hooks = GetHooks();
+    std::scoped_lock lock(hooks.mutex);
+    hook = hooks.start;
+  }
+  if (hook) hook(nameStr);
+}
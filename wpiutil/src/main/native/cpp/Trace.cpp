@@ -0,0 +1,237 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include "wpi/Trace.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "wpi/mutex.h"
+#include "wpi/raw_ostream.h"
+#include "wpi/timestamp.h"
+
+using namespace wpi;
+
+namespace {
+
+// The top bit of the timestamp marks an end event.
+constexpr uint64_t kEndFlag = uint64_t{1} << 63;
+
+// Marks a slot that is being written or has never been written.
+constexpr uint64_t kNoSequence = ~uint64_t{0};
+
+// One recorded event. The slot is guarded by a sequence lock: the writer
+// marks it with kNoSequence while filling it in and then stores the event's
+// index, so a reader that sees the same index before and after copying the
+// fields knows the copy wasn't overwritten part way through.
+struct Event {
+  std::atomic<uint64_t> sequence{kNoSequence};
+  std::atomic<const char*> name{nullptr};
+  std::atomic<uint64_t> time{0};
+};
+
+// Events recorded by one thread. Only the owning thread writes events; the
+// count is published with release ordering so an exporter that loads it with
+// acquire ordering sees every event before it.
+class ThreadBuffer {
+ public:
+  static constexpr size_t kSize = 8192;  // must be a power of two
+
+  explicit ThreadBuffer(int id) : id{id} {}
+
+  void Record(const char* name, uint64_t time) {
+    if (!events) events = std::make_unique<Event[]>(kSize);
+    uint64_t n = count.load(std::memory_order_relaxed);
+    Event& event = events[n & (kSize - 1)];
+    event.sequence.store(kNoSequence, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    event.name.store(name, std::memory_order_relaxed);
+    event.time.store(time, std::memory_order_relaxed);
+    event.sequence.store(n, std::memory_order_release);
+    count.store(n + 1, std::memory_order_release);
+  }
+
+  // Copies event i; returns false if it has been (or is being) overwritten.
+  bool Read(uint64_t i, const char** name, uint64_t* time) const {
+    const Event& event = events[i & (kSize - 1)];
+    if (event.sequence.load(std::memory_order_acquire) != i) return false;
+    *name = event.name.load(std::memory_order_relaxed);
+    *time = event.time.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return event.sequence.load(std::memory_order_relaxed) == i;
+  }
+
+  const int id;
+  std::unique_ptr<Event[]> events;
+  std::atomic<uint64_t> count{0};
+  std::atomic<uint64_t> start{0};  // events before this were cleared
+  std::atomic<bool> exited{false};
+  wpi::mutex nameMutex;
+  std::string name;
+};
+
+struct Registry {
+  // Buffers of exited threads kept for export; older ones are discarded as
+  // new threads start recording, so threads that come and go (such as
+  // network connection threads) don't grow the registry without bound.
+  static constexpr size_t kMaxExited = 16;
+
+  wpi::mutex mutex;
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+  int nextId = 1;
+};
+
+std::atomic<bool> gEnabled{false};
+
+Registry& GetRegistry() {
+  static Registry registry;
+  return registry;
+}
+
+// Keeps the calling thread's buffer; the registry holds it past thread exit so
+// its events can still be exported.
+struct ThreadBufferHolder {
+  ~ThreadBufferHolder() {
+    if (buffer) buffer->exited = true;
+  }
+
+  std::shared_ptr<ThreadBuffer> buffer;
+  std::string name;  // set before the buffer is created
+};
+
+thread_local ThreadBufferHolder tBuffer;
+
+ThreadBuffer& GetThreadBuffer() {
+  if (!tBuffer.buffer) {
+    auto& registry = GetRegistry();
+    std::scoped_lock lock(registry.mutex);
+    auto& buffers = registry.buffers;
+    size_t exited =
+        std::count_if(buffers.begin(), buffers.end(),
+                      [](const auto& buffer) { return buffer->exited.load(); });
+    for (auto it = buffers.begin();
+         exited >= Registry::kMaxExited && it != buffers.end();) {
+      if ((*it)->exited) {
+        it = buffers.erase(it);
+        --exited;
+      } else {
+        ++it;
+      }
+    }
+    tBuffer.buffer = std::make_shared<ThreadBuffer>(registry.nextId++);
+    tBuffer.buffer->name = std::move(tBuffer.name);
+    buffers.emplace_back(tBuffer.buffer);
+  }
+  return *tBuffer.buffer;
+}
+
+void WriteString(raw_ostream& os, StringRef str) {
+  os << '"';
+  for (char ch : str) {
+    if (ch == '"' || ch == '\\') {
+      os << '\\' << ch;
+    } else if (static_cast<unsigned char>(ch) < 0x20) {
+      os << ' ';
+    } else {
+      os << ch;
+    }
+  }
+  os << '"';
+}
+
+}  // namespace
+
+void trace::SetEnabled(bool enabled) { gEnabled = enabled; }
+
+bool trace::IsEnabled() { return gEnabled.load(std::memory_order_relaxed); }
+
+void trace::Begin(const char* name) {
+  if (!gEnabled.load(std::memory_order_relaxed)) return;
+  GetThreadBuffer().Record(name, Now());
+}
+
+void trace::End(const char* name) {
+  if (!tBuffer.buffer) return;
+  tBuffer.buffer->Record(name, Now() | kEndFlag);
+}
+
+void trace::SetThreadName(const Twine& name) {
+  // Threads that never record don't get a buffer; the name is applied if one
+  // is created later
+  if (!tBuffer.buffer) {
+    tBuffer.name = name.str();
+    return;
+  }
+  std::scoped_lock lock(tBuffer.buffer->nameMutex);
+  tBuffer.buffer->name = name.str();
+}
+
+void trace::Clear() {
+  auto& registry = GetRegistry();
+  std::scoped_lock lock(registry.mutex);
+  auto& buffers = registry.buffers;
+  buffers.erase(std::remove_if(buffers.begin(), buffers.end(),
+                               [](const auto& buffer) {
+                                 return buffer->exited.load();
+                               }),
+                buffers.end());
+  for (auto& buffer : buffers) {
+    buffer->start = buffer->count.load(std::memory_order_acquire);
+  }
+}
+
+void trace::WriteChromeTrace(raw_ostream& os) {
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+  {
+    auto& registry = GetRegistry();
+    std::scoped_lock lock(registry.mutex);
+    buffers = registry.buffers;
+  }
+
+  os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  bool first = true;
+  auto separator = [&] {
+    os << (first ? "\n" : ",\n");
+    first = false;
+  };
+
+  for (const auto& buffer : buffers) {
+    {
+      std::scoped_lock lock(buffer->nameMutex);
+      if (!buffer->name.empty()) {
+        separator();
+        os << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+           << buffer->id << ",\"args\":{\"name\":";
+        WriteString(os, buffer->name);
+        os << "}}";
+      }
+    }
+
+    uint64_t end = buffer->count.load(std::memory_order_acquire);
+    uint64_t begin = buffer->start.load();
+    if (end - begin > ThreadBuffer::kSize) begin = end - ThreadBuffer::kSize;
+    for (uint64_t i = begin; i < end; ++i) {
+      const char* name;
+      uint64_t time;
+      if (!buffer->Read(i, &name, &time)) continue;
+      separator();
+      os << "{\"name\":";
+      WriteString(os, name);
+      os << ",\"ph\":\"" << ((time & kEndFlag) ? 'E' : 'B')
+         << "\",\"ts\":" << (time & ~kEndFlag)
+         << ",\"pid\":1,\"tid\":" << buffer->id << '}';
+    }
+  }
+
+  os << "\n]}\n";
+}
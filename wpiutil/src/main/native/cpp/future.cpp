@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2018-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2018-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -10,105 +10,116 @@
 namespace wpi {
 namespace detail {
 
-PromiseFactoryBase::~PromiseFactoryBase() {
-  m_active = false;
-  m_resultCv.notify_all();  // wake up any waiters
+FutureStateBase::~FutureStateBase() { delete m_waiter.load(); }
+
+void FutureStateBase::Wait() {
+  if (IsReady()) return;
+  Waiter& waiter = GetWaiter();
+  std::unique_lock lock(waiter.mutex);
+  waiter.cv.wait(lock, [&] { return IsReady(); });
 }
 
-void PromiseFactoryBase::IgnoreResult(uint64_t request) {
-  std::unique_lock lock(m_resultMutex);
-  EraseRequest(request);
+bool FutureStateBase::MarkReady() {
+  // Both this and the exchange in GetWaiter() are sequentially consistent, so
+  // either we see the waiter or the waiter sees the ready flag.
+  uint8_t prev = m_flags.fetch_or(kReady);
+  if (Waiter* waiter = m_waiter.load()) {
+    // taking the lock orders the notify after a waiter's predicate check
+    { std::scoped_lock lock(waiter->mutex); }
+    waiter->cv.notify_all();
+  }
+  return (prev & kThen) != 0;
 }
 
-uint64_t PromiseFactoryBase::CreateRequest() {
-  std::unique_lock lock(m_resultMutex);
-  uint64_t req = ++m_uid;
-  m_requests.push_back(req);
-  return req;
+bool FutureStateBase::MarkThen() {
+  uint8_t expected = 0;
+  return m_flags.compare_exchange_strong(expected, kThen);
 }
 
-bool PromiseFactoryBase::EraseRequest(uint64_t request) {
-  if (request == 0) return false;
-  auto it = std::find_if(m_requests.begin(), m_requests.end(),
-                         [=](auto r) { return r == request; });
-  if (it == m_requests.end()) return false;  // no waiters
-  m_requests.erase(it);
-  return true;
+FutureStateBase::Waiter& FutureStateBase::GetWaiter() {
+  Waiter* waiter = m_waiter.load();
+  if (waiter) return *waiter;
+  auto created = new Waiter;
+  if (m_waiter.compare_exchange_strong(waiter, created)) return *created;
+  delete created;  // another thread won the race
+  return *waiter;
 }
 
 }  // namespace detail
 
+PromiseFactory<void>::~PromiseFactory() {
+  // wake up any waiters; a claimed promise completes its own future
+  for (auto& request : m_requests) {
+    if (!request.second.promise) request.second.state->SetValue();
+  }
+}
+
+uint64_t PromiseFactory<void>::CreateRequest() {
+  std::scoped_lock lock(m_mutex);
+  uint64_t req = CreateRequestId();
+  m_requests.try_emplace(
+      req, Request{std::make_shared<detail::FutureState<void>>()});
+  return req;
+}
+
+detail::FutureStatePtr<void> PromiseFactory<void>::Find(uint64_t request,
+                                                        Claim claim) {
+  std::scoped_lock lock(m_mutex);
+  auto it = m_requests.find(request);
+  if (it == m_requests.end()) return nullptr;
+  Request& req = it->second;
+  if (claim == kFuture) {
+    req.future = true;
+  } else if (claim == kPromise) {
+    // only one promise may set the value
+    if (req.promise) return nullptr;
+    req.promise = true;
+  }
+  auto state = req.state;
+  if (req.future && req.promise) m_requests.erase(it);
+  return state;
+}
+
 future<void> PromiseFactory<void>::MakeReadyFuture() {
-  std::unique_lock lock(GetResultMutex());
-  uint64_t req = CreateErasedRequest();
-  m_results.emplace_back(req);
-  return future<void>{this, req};
+  return make_ready_future();
 }
 
 void PromiseFactory<void>::SetValue(uint64_t request) {
-  std::unique_lock lock(GetResultMutex());
-  if (!EraseRequest(request)) return;
-  auto it = std::find_if(m_thens.begin(), m_thens.end(),
-                         [=](const auto& x) { return x.request == request; });
-  if (it != m_thens.end()) {
-    uint64_t outRequest = it->outRequest;
-    ThenFunction func = std::move(it->func);
-    m_thens.erase(it);
-    lock.unlock();
-    return func(outRequest);
-  }
-  m_results.emplace_back(request);
-  Notify();
+  if (auto state = Find(request, kPromise)) state->SetValue();
 }
 
 void PromiseFactory<void>::SetThen(uint64_t request, uint64_t outRequest,
                                    ThenFunction func) {
-  std::unique_lock lock(GetResultMutex());
-  auto it = std::find_if(m_results.begin(), m_results.end(),
-                         [=](const auto& r) { return r == request; });
-  if (it != m_results.end()) {
-    m_results.erase(it);
-    lock.unlock();
-    return func(outRequest);
+  if (auto state = Find(request, kFuture)) {
+    state->SetThen(
+        [outRequest, func = std::move(func)] { func(outRequest); });
   }
-  m_thens.emplace_back(request, outRequest, func);
 }
 
 bool PromiseFactory<void>::IsReady(uint64_t request) noexcept {
-  std::unique_lock lock(GetResultMutex());
-  auto it = std::find_if(m_results.begin(), m_results.end(),
-                         [=](const auto& r) { return r == request; });
-  return it != m_results.end();
+  auto state = Find(request, kPeek);
+  return state && state->IsReady();
 }
 
 void PromiseFactory<void>::GetResult(uint64_t request) {
-  // wait for response
-  std::unique_lock lock(GetResultMutex());
-  while (IsActive()) {
-    // Did we get a response to *our* request?
-    auto it = std::find_if(m_results.begin(), m_results.end(),
-                           [=](const auto& r) { return r == request; });
-    if (it != m_results.end()) {
-      // Yes, remove it from the vector and we're done.
-      m_results.erase(it);
-      return;
-    }
-    // No, keep waiting for a response
-    Wait(lock);
-  }
+  if (auto state = Find(request, kFuture)) state->GetValue();
 }
 
 void PromiseFactory<void>::WaitResult(uint64_t request) {
-  // wait for response
-  std::unique_lock lock(GetResultMutex());
-  while (IsActive()) {
-    // Did we get a response to *our* request?
-    auto it = std::find_if(m_results.begin(), m_results.end(),
-                           [=](const auto& r) { return r == request; });
-    if (it != m_results.end()) return;
-    // No, keep waiting for a response
-    Wait(lock);
-  }
+  if (auto state = Find(request, kPeek)) state->Wait();
+}
+
+bool PromiseFactory<void>::EraseRequest(uint64_t request) {
+  std::scoped_lock lock(m_mutex);
+  auto it = m_requests.find(request);
+  if (it == m_requests.end()) return false;
+  bool pending = !it->second.state->IsReady();
+  m_requests.erase(it);
+  return pending;
+}
+
+void PromiseFactory<void>::IgnoreResult(uint64_t request) {
+  Find(request, kFuture);
 }
 
 PromiseFactory<void>& PromiseFactory<void>::GetInstance() {
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -47,7 +47,7 @@ uint64_t ReadUleb128(const char* addr, uint64_t* ret) {
     addr++;
     count++;
 
-    result |= (byte & 0x7f) << shift;
+    result |= static_cast<uint64_t>(byte & 0x7f) << shift;
     shift += 7;
 
     if (!(byte & 0x80)) break;
@@ -67,7 +67,7 @@ bool ReadUleb128(raw_istream& is, uint64_t* ret) {
     is.read(reinterpret_cast<char*>(&byte), 1);
     if (is.has_error()) return false;
 
-    result |= (byte & 0x7f) << shift;
+    result |= static_cast<uint64_t>(byte & 0x7f) << shift;
     shift += 7;
 
     if (!(byte & 0x80)) break;
@@ -0,0 +1,12 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+// Emits the unit_t instantiations declared extern by UNIT_ADD_EXTERN_TEMPLATE
+// in the per-dimension headers, so robot code only compiles them once.
+#define UNIT_LIB_INSTANTIATE_TEMPLATES
+
+#include "units/units.h"
@@ -0,0 +1,48 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#ifndef WPIUTIL_WPI_THREADHOOKS_H_
+#define WPIUTIL_WPI_THREADHOOKS_H_
+
+#include <functional>
+
+#include "wpi/StringRef.h"
+#include "wpi/Twine.h"
+
+namespace wpi {
+
+/**
+ * Called on each named library thread as it starts, before it does any other
+ * work, with the thread's name.  Typically used to apply a CPU affinity and
+ * scheduling policy so control loops can be kept apart from telemetry and
+ * vision threads.
+ */
+using ThreadStartHook = std::function<void(StringRef name)>;
+
+/**
+ * Sets the hook called as named library threads start.  Threads that have
+ * already started are not affected, so this should be set before starting
+ * NetworkTables or cameras.
+ *
+ * @param hook The hook, or nullptr for none.
+ */
+void SetThreadStartHook(ThreadStartHook hook);
+
+/**
+ * Names the calling thread and runs the thread start hook for it.  Library
+ * threads call this first thing.
+ *
+ * The name is given to the operating system (Linux truncates it to 15
+ * characters) so it shows up in tools such as top, and to trace::.
+ *
+ * @param name The thread name.
+ */
+void SetCurrentThreadName(const Twine& name);
+
+}  // namespace wpi
+
+#endif  // WPIUTIL_WPI_THREADHOOKS_H_
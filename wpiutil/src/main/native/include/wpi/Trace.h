@@ -0,0 +1,112 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#ifndef WPIUTIL_WPI_TRACE_H_
+#define WPIUTIL_WPI_TRACE_H_
+
+#include "wpi/Twine.h"
+
+namespace wpi {
+
+class raw_ostream;
+
+/**
+ * Low-overhead timeline tracing.
+ *
+ * While tracing is enabled, Begin() and End() append a timestamped event to a
+ * fixed-size buffer owned by the calling thread; recording takes no locks and
+ * costs a few tens of nanoseconds. Each buffer keeps the most recent events
+ * and overwrites the oldest. When disabled, each call is a single atomic
+ * load.
+ *
+ * Timestamps come from wpi::Now(), the same timebase as NetworkTables and
+ * camera frame times. WriteChromeTrace() exports the events of all threads in
+ * the Chrome trace event format, which chrome://tracing and Perfetto open.
+ */
+namespace trace {
+
+/**
+ * Enables or disables recording of events. Tracing is disabled by default.
+ */
+void SetEnabled(bool enabled);
+
+/**
+ * Returns true if events are being recorded.
+ */
+bool IsEnabled();
+
+/**
+ * Records the start of a span on the calling thread, if tracing is enabled.
+ *
+ * @param name The name of the span. Only the pointer is stored, so this must
+ *             be a string literal or otherwise outlive the trace.
+ */
+void Begin(const char* name);
+
+/**
+ * Records the end of the span most recently begun on the calling thread. This
+ * is recorded even if tracing was disabled since, so spans stay balanced.
+ *
+ * @param name The name passed to Begin().
+ */
+void End(const char* name);
+
+/**
+ * Names the calling thread in exported traces. Nothing is allocated for a
+ * thread until it records an event.
+ *
+ * @param name The thread name.
+ */
+void SetThreadName(const Twine& name);
+
+/**
+ * Discards all recorded events.
+ */
+void Clear();
+
+/**
+ * Writes the recorded events of all threads as Chrome trace event JSON.
+ *
+ * Events overwritten while the export runs are left out; disable tracing
+ * first for a consistent snapshot.
+ *
+ * @param os The stream to write to.
+ */
+void WriteChromeTrace(raw_ostream& os);
+
+}  // namespace trace
+
+/**
+ * Records a trace span covering the lifetime of the object, if tracing was
+ * enabled when it was constructed.
+ */
+class TraceScope {
+ public:
+  /**
+   * Begins a span.
+   *
+   * @param name The name of the span; see trace::Begin().
+   */
+  explicit TraceScope(const char* name)
+      : m_name(trace::IsEnabled() ? name : nullptr) {
+    if (m_name) trace::Begin(m_name);
+  }
+
+  ~TraceScope() {
+    if (m_name) trace::End(m_name);
+  }
+
+  TraceScope(const TraceScope&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+
+ private:
+  const char* m_name;
+};
+
+}  // namespace wpi
+
+#endif  // WPIUTIL_WPI_TRACE_H_
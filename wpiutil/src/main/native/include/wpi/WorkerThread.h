@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2018-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2018-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -73,19 +73,18 @@ struct WorkerThreadRequest {
   using AfterWorkFunction = typename WorkerThreadAsync<R>::AfterWorkFunction;
 
   WorkerThreadRequest() = default;
-  WorkerThreadRequest(uint64_t promiseId_, WorkFunction work_,
+  WorkerThreadRequest(promise<R> promise_, WorkFunction work_,
                       std::tuple<T...> params_)
-      : promiseId(promiseId_),
+      : result(std::move(promise_)),
         work(std::move(work_)),
         params(std::move(params_)) {}
   WorkerThreadRequest(WorkFunction work_, AfterWorkFunction afterWork_,
                       std::tuple<T...> params_)
-      : promiseId(0),
-        work(std::move(work_)),
+      : work(std::move(work_)),
         afterWork(std::move(afterWork_)),
         params(std::move(params_)) {}
 
-  uint64_t promiseId;
+  promise<R> result;
   WorkFunction work;
   AfterWorkFunction afterWork;
   std::tuple<T...> params;
@@ -99,7 +98,6 @@ class WorkerThreadThread : public SafeThread {
   void Main() override;
 
   std::vector<Request> m_requests;
-  PromiseFactory<R> m_promises;
   detail::WorkerThreadAsync<R> m_async;
 };
 
@@ -111,7 +109,7 @@ void RunWorkerThreadRequest(WorkerThreadThread<R, T...>& thr,
     if (auto async = thr.m_async.m_async.lock())
       async->Send(std::move(req.afterWork), std::move(result));
   } else {
-    thr.m_promises.SetValue(req.promiseId, std::move(result));
+    req.result.set_value(std::move(result));
   }
 }
 
@@ -123,7 +121,7 @@ void RunWorkerThreadRequest(WorkerThreadThread<void, T...>& thr,
     if (auto async = thr.m_async.m_async.lock())
       async->Send(std::move(req.afterWork));
   } else {
-    thr.m_promises.SetValue(req.promiseId);
+    req.result.set_value();
   }
 }
 
@@ -144,7 +142,6 @@ void WorkerThreadThread<R, T...>::Main() {
       RunWorkerThreadRequest(*this, req);
     }
     requests.clear();
-    m_promises.Notify();
   }
 }
 
@@ -222,17 +219,19 @@ class WorkerThread<R(T...)> final {
   future<R> QueueWork(WorkFunction work, U&&... u) {
     if (auto thr = m_owner.GetThread()) {
       // create the future
-      uint64_t req = thr->m_promises.CreateRequest();
+      promise<R> p;
+      auto f = p.get_future();
 
       // add the parameters to the input queue
       thr->m_requests.emplace_back(
-          req, std::move(work), std::forward_as_tuple(std::forward<U>(u)...));
+          std::move(p), std::move(work),
+          std::forward_as_tuple(std::forward<U>(u)...));
 
       // signal the thread
       thr->m_cond.notify_one();
 
       // return future
-      return thr->m_promises.CreateFuture(req);
+      return f;
     }
 
     // XXX: is this the right thing to do?
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2018-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2018-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -10,15 +10,16 @@
 
 #include <stdint.h>
 
-#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <functional>
+#include <memory>
 #include <type_traits>
 #include <utility>
-#include <vector>
 
+#include "wpi/DenseMap.h"
 #include "wpi/condition_variable.h"
+#include "wpi/deprecated.h"
 #include "wpi/mutex.h"
 
 namespace wpi {
@@ -36,99 +37,222 @@ class promise<void>;
 
 namespace detail {
 
-class PromiseFactoryBase {
+/**
+ * Completion tracking shared by a promise and its future.
+ *
+ * Completion is a single atomic flag, so setting a value nobody is blocked on
+ * and checking a ready future take no locks. A mutex and condition variable
+ * are only allocated once a thread actually blocks, and only that state's
+ * waiters are woken.
+ */
+class FutureStateBase {
+ public:
+  FutureStateBase() = default;
+  ~FutureStateBase();
+
+  FutureStateBase(const FutureStateBase&) = delete;
+  FutureStateBase& operator=(const FutureStateBase&) = delete;
+
+  bool IsReady() const noexcept { return (m_flags.load() & kReady) != 0; }
+
+  void Wait();
+
+  // returns false if timeout reached
+  template <class Clock, class Duration>
+  bool WaitUntil(const std::chrono::time_point<Clock, Duration>& timeout_time);
+
+ protected:
+  // Marks the value as set. Returns true if a continuation was attached,
+  // which the caller must then run.
+  bool MarkReady();
+
+  // Marks a continuation as attached. Returns false if the value was already
+  // set, in which case the caller must run the continuation itself.
+  bool MarkThen();
+
+ private:
+  static constexpr uint8_t kReady = 1;
+  static constexpr uint8_t kThen = 2;
+
+  struct Waiter {
+    wpi::mutex mutex;
+    wpi::condition_variable cv;
+  };
+
+  Waiter& GetWaiter();
+
+  std::atomic<uint8_t> m_flags{0};
+  std::atomic<Waiter*> m_waiter{nullptr};
+};
+
+/**
+ * The value and continuation of a promise/future pair.
+ *
+ * The value is set exactly once, by the promise. A continuation attached with
+ * SetThen() runs on whichever thread completes the handshake last: the one
+ * setting the value, or the one attaching the continuation to a ready state.
+ */
+template <typename T>
+class FutureState final : public FutureStateBase {
+ public:
+  template <typename U>
+  void SetValue(U&& value) {
+    m_value = std::forward<U>(value);
+    if (MarkReady()) m_then(std::move(m_value));
+  }
+
+  void SetThen(std::function<void(T)> func) {
+    m_then = std::move(func);
+    if (!MarkThen()) m_then(std::move(m_value));
+  }
+
+  T GetValue() {
+    Wait();
+    return std::move(m_value);
+  }
+
+ private:
+  T m_value{};
+  std::function<void(T)> m_then;
+};
+
+template <>
+class FutureState<void> final : public FutureStateBase {
  public:
-  ~PromiseFactoryBase();
+  void SetValue() {
+    if (MarkReady()) m_then();
+  }
+
+  void SetThen(std::function<void()> func) {
+    m_then = std::move(func);
+    if (!MarkThen()) m_then();
+  }
+
+  void GetValue() { Wait(); }
+
+ private:
+  std::function<void()> m_then;
+};
+
+template <typename T>
+using FutureStatePtr = std::shared_ptr<FutureState<T>>;
 
-  bool IsActive() const { return m_active; }
+class PromiseFactoryBase {
+ public:
+  WPI_DEPRECATED("the factory is active until it is destroyed")
+  bool IsActive() const { return true; }
 
+  WPI_DEPRECATED("use future::wait() or PromiseFactory::WaitResult()")
   wpi::mutex& GetResultMutex() { return m_resultMutex; }
 
+  /**
+   * Wakes threads blocked in Wait() or WaitUntil().
+   */
+  WPI_DEPRECATED("futures are woken when their value is set")
   void Notify() { m_resultCv.notify_all(); }
 
-  // must be called with locked lock == ResultMutex
-  void Wait(std::unique_lock<wpi::mutex>& lock) { m_resultCv.wait(lock); }
+  /**
+   * Waits for Notify(), or for at most a millisecond.  Setting a value no
+   * longer wakes the factory, so callers must recheck their condition in a
+   * loop.  Must be called with lock holding GetResultMutex().
+   */
+  WPI_DEPRECATED("use future::wait() or PromiseFactory::WaitResult()")
+  void Wait(std::unique_lock<wpi::mutex>& lock) {
+    m_resultCv.wait_for(lock, std::chrono::milliseconds(1));
+  }
 
-  // returns false if timeout reached
+  /**
+   * Like Wait(), but returns false if the timeout is reached.
+   */
   template <class Clock, class Duration>
+  WPI_DEPRECATED(
+      "use future::wait_until() or PromiseFactory::WaitResultUntil()")
   bool WaitUntil(std::unique_lock<wpi::mutex>& lock,
                  const std::chrono::time_point<Clock, Duration>& timeout_time) {
-    return m_resultCv.wait_until(lock, timeout_time) ==
-           std::cv_status::no_timeout;
+    if (timeout_time - Clock::now() > std::chrono::milliseconds(1)) {
+      m_resultCv.wait_for(lock, std::chrono::milliseconds(1));
+    } else {
+      m_resultCv.wait_until(lock, timeout_time);
+    }
+    return Clock::now() < timeout_time;
   }
 
-  void IgnoreResult(uint64_t request);
+  WPI_DEPRECATED("use CreateRequest()")
+  uint64_t CreateErasedRequest() { return CreateRequestId(); }
 
-  uint64_t CreateRequest();
+ protected:
+  // Which side of a request a lookup claims
+  enum Claim { kPeek, kFuture, kPromise };
 
-  // returns true if request was pending
-  // must be called with ResultMutex held
-  bool EraseRequest(uint64_t request);
+  uint64_t CreateRequestId() { return ++m_uid; }
 
-  // same as doing CreateRequest() followed by EraseRequest()
-  // must be called with ResultMutex held
-  uint64_t CreateErasedRequest() { return ++m_uid; }
+  wpi::mutex m_mutex;
 
  private:
+  std::atomic<uint64_t> m_uid{0};
   wpi::mutex m_resultMutex;
-  std::atomic_bool m_active{true};
   wpi::condition_variable m_resultCv;
-
-  uint64_t m_uid = 0;
-  std::vector<uint64_t> m_requests;
 };
 
 template <typename To, typename From>
 struct FutureThen {
   template <typename F>
-  static future<To> Create(PromiseFactory<From>& fromFactory, uint64_t request,
-                           PromiseFactory<To>& factory, F&& func);
+  static future<To> Create(FutureState<From>& from, F&& func);
 };
 
 template <typename From>
 struct FutureThen<void, From> {
   template <typename F>
-  static future<void> Create(PromiseFactory<From>& fromFactory,
-                             uint64_t request, PromiseFactory<void>& factory,
-                             F&& func);
+  static future<void> Create(FutureState<From>& from, F&& func);
 };
 
 template <typename To>
 struct FutureThen<To, void> {
   template <typename F>
-  static future<To> Create(PromiseFactory<void>& fromFactory, uint64_t request,
-                           PromiseFactory<To>& factory, F&& func);
+  static future<To> Create(FutureState<void>& from, F&& func);
 };
 
 template <>
 struct FutureThen<void, void> {
   template <typename F>
-  static future<void> Create(PromiseFactory<void>& fromFactory,
-                             uint64_t request, PromiseFactory<void>& factory,
-                             F&& func);
+  static future<void> Create(FutureState<void>& from, F&& func);
 };
 
 }  // namespace detail
 
 /**
- * A promise factory for lightweight futures.
+ * A promise factory for lightweight futures identified by request id.
  *
- * The lifetime of the factory must be ensured to be longer than any futures
- * it creates.
+ * This is for code that hands out request ids and completes them later.
+ * Constructing a promise directly and calling promise::get_future() is
+ * simpler and avoids the factory's request table.
  *
  * Use CreateRequest() to create the future request id, and then CreateFuture()
- * and CreatePromise() to create future and promise objects.  A promise should
- * only be created once for any given request id.
+ * and CreatePromise() to create future and promise objects, in either order.
+ * A promise should only be created once for any given request id.  The factory
+ * keeps a request until both its future side (CreateFuture(), GetResult(),
+ * IgnoreResult() or SetThen()) and its promise side (CreatePromise() or
+ * SetValue()) have been claimed.  Destroying the factory completes any
+ * requests whose promise side hasn't been claimed with a default-constructed
+ * value.
  *
  * @tparam T the "return" type of the promise/future
  */
 template <typename T>
 class PromiseFactory final : public detail::PromiseFactoryBase {
-  friend class future<T>;
-
  public:
-  using detail::PromiseFactoryBase::Notify;
-  using ThenFunction = std::function<void(uint64_t, T)>;
+  PromiseFactory() = default;
+  ~PromiseFactory();
+
+  PromiseFactory(const PromiseFactory&) = delete;
+  PromiseFactory& operator=(const PromiseFactory&) = delete;
+
+  /**
+   * Creates a request id.
+   *
+   * @return the request id
+   */
+  uint64_t CreateRequest();
 
   /**
    * Creates a future.
@@ -171,29 +295,84 @@ class PromiseFactory final : public detail::PromiseFactoryBase {
    */
   void SetValue(uint64_t request, T&& value);
 
+  using ThenFunction = std::function<void(uint64_t, T)>;
+
+  /**
+   * Calls func with outRequest and the value once the value is set.  Claims
+   * the future side of the request.
+   *
+   * @param request request id, as returned by CreateRequest()
+   * @param outRequest passed to func
+   * @param func called on the thread that sets the value, or immediately if
+   *             it is already set
+   */
   void SetThen(uint64_t request, uint64_t outRequest, ThenFunction func);
 
+  /**
+   * Checks if the value of a request is set.  Always false once both sides of
+   * the request have been claimed; use future::is_ready() then.
+   *
+   * @param request request id, as returned by CreateRequest()
+   */
   bool IsReady(uint64_t request) noexcept;
+
+  /**
+   * Waits for and gets the value of a request.  Claims the future side of the
+   * request.
+   *
+   * @param request request id, as returned by CreateRequest()
+   * @return the value, or a default-constructed value if the request is
+   *         unknown
+   */
   T GetResult(uint64_t request);
+
+  /**
+   * Waits for the value of a request to be set.
+   *
+   * @param request request id, as returned by CreateRequest()
+   */
   void WaitResult(uint64_t request);
+
+  /**
+   * Waits for the value of a request to be set, or the timeout.
+   *
+   * @param request request id, as returned by CreateRequest()
+   * @param timeout_time maximum time to wait
+   * @return false if the timeout was reached or the request is unknown
+   */
   template <class Clock, class Duration>
   bool WaitResultUntil(
       uint64_t request,
       const std::chrono::time_point<Clock, Duration>& timeout_time);
 
+  /**
+   * Forgets a request.  Futures already created for it stay valid, but any
+   * later promise for it does nothing.
+   *
+   * @param request request id, as returned by CreateRequest()
+   * @return true if the request's value had not been set
+   */
+  bool EraseRequest(uint64_t request);
+
+  /**
+   * Claims the future side of a request without retrieving its value.
+   *
+   * @param request request id, as returned by CreateRequest()
+   */
+  void IgnoreResult(uint64_t request);
+
   static PromiseFactory& GetInstance();
 
  private:
-  struct Then {
-    Then(uint64_t request_, uint64_t outRequest_, ThenFunction func_)
-        : request(request_), outRequest(outRequest_), func(std::move(func_)) {}
-    uint64_t request;
-    uint64_t outRequest;
-    ThenFunction func;
+  struct Request {
+    detail::FutureStatePtr<T> state;
+    bool future = false;
+    bool promise = false;
   };
 
-  std::vector<Then> m_thens;
-  std::vector<std::pair<uint64_t, T>> m_results;
+  detail::FutureStatePtr<T> Find(uint64_t request, Claim claim);
+
+  wpi::DenseMap<uint64_t, Request> m_requests;
 };
 
 /**
@@ -201,17 +380,25 @@ class PromiseFactory final : public detail::PromiseFactoryBase {
  */
 template <>
 class PromiseFactory<void> final : public detail::PromiseFactoryBase {
-  friend class future<void>;
-
  public:
-  using detail::PromiseFactoryBase::Notify;
-  using ThenFunction = std::function<void(uint64_t)>;
+  PromiseFactory() = default;
+  ~PromiseFactory();
+
+  PromiseFactory(const PromiseFactory&) = delete;
+  PromiseFactory& operator=(const PromiseFactory&) = delete;
+
+  /**
+   * Creates a request id.
+   *
+   * @return the request id
+   */
+  uint64_t CreateRequest();
 
   /**
    * Creates a future.
    *
    * @param request the request id returned by CreateRequest()
-   * @return std::pair of the future and the request id
+   * @return the future
    */
   future<void> CreateFuture(uint64_t request);
 
@@ -238,35 +425,88 @@ class PromiseFactory<void> final : public detail::PromiseFactoryBase {
    */
   void SetValue(uint64_t request);
 
+  using ThenFunction = std::function<void(uint64_t)>;
+
+  /**
+   * Calls func with outRequest once the value is set.  Claims
+   * the future side of the request.
+   *
+   * @param request request id, as returned by CreateRequest()
+   * @param outRequest passed to func
+   * @param func called on the thread that sets the value, or immediately if
+   *             it is already set
+   */
   void SetThen(uint64_t request, uint64_t outRequest, ThenFunction func);
 
+  /**
+   * Checks if the value of a request is set.  Always false once both sides of
+   * the request have been claimed; use future::is_ready() then.
+   *
+   * @param request request id, as returned by CreateRequest()
+   */
   bool IsReady(uint64_t request) noexcept;
+
+  /**
+   * Waits for the value of a request to be set.  Claims the future side of the
+   * request.
+   *
+   * @param request request id, as returned by CreateRequest()
+   */
   void GetResult(uint64_t request);
+
+  /**
+   * Waits for the value of a request to be set.
+   *
+   * @param request request id, as returned by CreateRequest()
+   */
   void WaitResult(uint64_t request);
+
+  /**
+   * Waits for the value of a request to be set, or the timeout.
+   *
+   * @param request request id, as returned by CreateRequest()
+   * @param timeout_time maximum time to wait
+   * @return false if the timeout was reached or the request is unknown
+   */
   template <class Clock, class Duration>
   bool WaitResultUntil(
       uint64_t request,
       const std::chrono::time_point<Clock, Duration>& timeout_time);
 
+  /**
+   * Forgets a request.  Futures already created for it stay valid, but any
+   * later promise for it does nothing.
+   *
+   * @param request request id, as returned by CreateRequest()
+   * @return true if the request's value had not been set
+   */
+  bool EraseRequest(uint64_t request);
+
+  /**
+   * Claims the future side of a request without retrieving its value.
+   *
+   * @param request request id, as returned by CreateRequest()
+   */
+  void IgnoreResult(uint64_t request);
+
   static PromiseFactory& GetInstance();
 
  private:
-  struct Then {
-    Then(uint64_t request_, uint64_t outRequest_, ThenFunction func_)
-        : request(request_), outRequest(outRequest_), func(std::move(func_)) {}
-    uint64_t request;
-    uint64_t outRequest;
-    ThenFunction func;
+  struct Request {
+    detail::FutureStatePtr<void> state;
+    bool future = false;
+    bool promise = false;
   };
 
-  std::vector<Then> m_thens;
-  std::vector<uint64_t> m_results;
+  detail::FutureStatePtr<void> Find(uint64_t request, Claim claim);
+
+  wpi::DenseMap<uint64_t, Request> m_requests;
 };
 
 /**
  * A lightweight version of std::future.
  *
- * Use either promise::get_future() or PromiseFactory::CreateFuture() to create.
+ * Use promise::get_future() to create.
  *
  * @tparam T the "return" type
  */
@@ -274,6 +514,8 @@ template <typename T>
 class future final {
   friend class PromiseFactory<T>;
   friend class promise<T>;
+  template <typename To, typename From>
+  friend struct detail::FutureThen;
 
  public:
   /**
@@ -281,32 +523,14 @@ class future final {
    */
   future() noexcept = default;
 
-  future(future&& oth) noexcept {
-    this->m_request = oth.m_request;
-    this->m_promises = oth.m_promises;
-    oth.m_request = 0;
-    oth.m_promises = nullptr;
-  }
+  future(future&& oth) noexcept = default;
   future(const future&) = delete;
 
   template <typename R>
   future(future<R>&& oth) noexcept
       : future(oth.then([](R&& val) -> T { return val; })) {}
 
-  /**
-   * Ignores the result of the future if it has not been retrieved.
-   */
-  ~future() {
-    if (m_promises) m_promises->IgnoreResult(m_request);
-  }
-
-  future& operator=(future&& oth) noexcept {
-    this->m_request = oth.m_request;
-    this->m_promises = oth.m_promises;
-    oth.m_request = 0;
-    oth.m_promises = nullptr;
-    return *this;
-  }
+  future& operator=(future&& oth) noexcept = default;
   future& operator=(const future&) = delete;
 
   /**
@@ -316,40 +540,46 @@ class future final {
    * @return The value provided by the corresponding promise.set_value().
    */
   T get() {
-    if (m_promises)
-      return m_promises->GetResult(m_request);
+    if (auto state = std::move(m_state))
+      return state->GetValue();
     else
       return T();
   }
 
-  template <typename R, typename F>
-  future<R> then(PromiseFactory<R>& factory, F&& func) {
-    if (m_promises) {
-      auto promises = m_promises;
-      m_promises = nullptr;
-      return detail::FutureThen<R, T>::Create(*promises, m_request, factory,
-                                              func);
-    } else {
-      return future<R>();
-    }
-  }
-
+  /**
+   * Attaches a continuation, which is called with the value on the thread
+   * that provides it (or immediately, if the value is already available).
+   * The future is marked invalid.
+   *
+   * @param func Function called with the value
+   * @return A future for the result of func
+   */
   template <typename F, typename R = typename std::result_of<F && (T &&)>::type>
   future<R> then(F&& func) {
-    return then(PromiseFactory<R>::GetInstance(), std::forward<F>(func));
+    if (auto state = std::move(m_state))
+      return detail::FutureThen<R, T>::Create(*state, std::forward<F>(func));
+    else
+      return future<R>();
   }
 
-  bool is_ready() const noexcept {
-    return m_promises && m_promises->IsReady(m_request);
+  /**
+   * Attaches a continuation. The factory is not used; continuations complete
+   * the returned future directly.
+   */
+  template <typename R, typename F>
+  future<R> then(PromiseFactory<R>& factory, F&& func) {
+    return then(std::forward<F>(func));
   }
 
+  bool is_ready() const noexcept { return m_state && m_state->IsReady(); }
+
   /**
    * Checks if the future is valid.
    * A default-constructed future or one where get() has been called is invalid.
    *
    * @return True if valid
    */
-  bool valid() const noexcept { return m_promises; }
+  bool valid() const noexcept { return m_state != nullptr; }
 
   /**
    * Waits for the promise to provide a value.
@@ -358,7 +588,7 @@ class future final {
    * If the value has already been provided, returns immediately.
    */
   void wait() const {
-    if (m_promises) m_promises->WaitResult(m_request);
+    if (m_state) m_state->Wait();
   }
 
   /**
@@ -370,7 +600,7 @@ class future final {
   template <class Clock, class Duration>
   bool wait_until(
       const std::chrono::time_point<Clock, Duration>& timeout_time) const {
-    return m_promises && m_promises->WaitResultUntil(m_request, timeout_time);
+    return m_state && m_state->WaitUntil(timeout_time);
   }
 
   /**
@@ -386,11 +616,10 @@ class future final {
   }
 
  private:
-  future(PromiseFactory<T>* promises, uint64_t request) noexcept
-      : m_request(request), m_promises(promises) {}
+  explicit future(detail::FutureStatePtr<T> state) noexcept
+      : m_state(std::move(state)) {}
 
-  uint64_t m_request = 0;
-  PromiseFactory<T>* m_promises = nullptr;
+  detail::FutureStatePtr<T> m_state;
 };
 
 /**
@@ -400,6 +629,8 @@ template <>
 class future<void> final {
   friend class PromiseFactory<void>;
   friend class promise<void>;
+  template <typename To, typename From>
+  friend struct detail::FutureThen;
 
  public:
   /**
@@ -407,28 +638,10 @@ class future<void> final {
    */
   future() noexcept = default;
 
-  future(future&& oth) noexcept {
-    m_request = oth.m_request;
-    m_promises = oth.m_promises;
-    oth.m_request = 0;
-    oth.m_promises = nullptr;
-  }
+  future(future&& oth) noexcept = default;
   future(const future&) = delete;
 
-  /**
-   * Ignores the result of the future if it has not been retrieved.
-   */
-  ~future() {
-    if (m_promises) m_promises->IgnoreResult(m_request);
-  }
-
-  future& operator=(future&& oth) noexcept {
-    m_request = oth.m_request;
-    m_promises = oth.m_promises;
-    oth.m_request = 0;
-    oth.m_promises = nullptr;
-    return *this;
-  }
+  future& operator=(future&& oth) noexcept = default;
   future& operator=(const future&) = delete;
 
   /**
@@ -436,37 +649,43 @@ class future<void> final {
    * Can only be called once.  The future will be marked invalid after the call.
    */
   void get() {
-    if (m_promises) m_promises->GetResult(m_request);
-  }
-
-  template <typename R, typename F>
-  future<R> then(PromiseFactory<R>& factory, F&& func) {
-    if (m_promises) {
-      auto promises = m_promises;
-      m_promises = nullptr;
-      return detail::FutureThen<R, void>::Create(*promises, m_request, factory,
-                                                 func);
-    } else {
-      return future<R>();
-    }
+    if (auto state = std::move(m_state)) state->GetValue();
   }
 
+  /**
+   * Attaches a continuation, which is called on the thread that sets the
+   * value (or immediately, if the value is already set).
+   * The future is marked invalid.
+   *
+   * @param func Function to call
+   * @return A future for the result of func
+   */
   template <typename F, typename R = typename std::result_of<F && ()>::type>
   future<R> then(F&& func) {
-    return then(PromiseFactory<R>::GetInstance(), std::forward<F>(func));
+    if (auto state = std::move(m_state))
+      return detail::FutureThen<R, void>::Create(*state, std::forward<F>(func));
+    else
+      return future<R>();
   }
 
-  bool is_ready() const noexcept {
-    return m_promises && m_promises->IsReady(m_request);
+  /**
+   * Attaches a continuation. The factory is not used; continuations complete
+   * the returned future directly.
+   */
+  template <typename R, typename F>
+  future<R> then(PromiseFactory<R>& factory, F&& func) {
+    return then(std::forward<F>(func));
   }
 
+  bool is_ready() const noexcept { return m_state && m_state->IsReady(); }
+
   /**
    * Checks if the future is valid.
    * A default-constructed future or one where get() has been called is invalid.
    *
    * @return True if valid
    */
-  bool valid() const noexcept { return m_promises; }
+  bool valid() const noexcept { return m_state != nullptr; }
 
   /**
    * Waits for the promise to provide a value.
@@ -474,7 +693,7 @@ class future<void> final {
    * If the value has already been provided, returns immediately.
    */
   void wait() const {
-    if (m_promises) m_promises->WaitResult(m_request);
+    if (m_state) m_state->Wait();
   }
 
   /**
@@ -486,7 +705,7 @@ class future<void> final {
   template <class Clock, class Duration>
   bool wait_until(
       const std::chrono::time_point<Clock, Duration>& timeout_time) const {
-    return m_promises && m_promises->WaitResultUntil(m_request, timeout_time);
+    return m_state && m_state->WaitUntil(timeout_time);
   }
 
   /**
@@ -502,17 +721,17 @@ class future<void> final {
   }
 
  private:
-  future(PromiseFactory<void>* promises, uint64_t request) noexcept
-      : m_request(request), m_promises(promises) {}
+  explicit future(detail::FutureStatePtr<void> state) noexcept
+      : m_state(std::move(state)) {}
 
-  uint64_t m_request = 0;
-  PromiseFactory<void>* m_promises = nullptr;
+  detail::FutureStatePtr<void> m_state;
 };
 
 /**
  * A lightweight version of std::promise.
  *
- * Use PromiseFactory::CreatePromise() to create.
+ * Each promise owns the state it shares with its future, so completing one
+ * only wakes the threads waiting on that future.
  *
  * @tparam T the "return" type
  */
@@ -524,15 +743,9 @@ class promise final {
   /**
    * Constructs an empty promise.
    */
-  promise() : m_promises(&PromiseFactory<T>::GetInstance()) {
-    m_request = m_promises->CreateRequest();
-  }
+  promise() : m_state(std::make_shared<detail::FutureState<T>>()) {}
 
-  promise(promise&& oth) noexcept
-      : m_request(oth.m_request), m_promises(oth.m_promises) {
-    oth.m_request = 0;
-    oth.m_promises = nullptr;
-  }
+  promise(promise&& oth) noexcept = default;
 
   promise(const promise&) = delete;
 
@@ -540,14 +753,11 @@ class promise final {
    * Sets the promised value to a default-constructed T if not already set.
    */
   ~promise() {
-    if (m_promises) m_promises->SetValue(m_request, T());
+    if (m_state) m_state->SetValue(T());
   }
 
   promise& operator=(promise&& oth) noexcept {
-    m_request = oth.m_request;
-    m_promises = oth.m_promises;
-    oth.m_request = 0;
-    oth.m_promises = nullptr;
+    promise(std::move(oth)).swap(*this);
     return *this;
   }
 
@@ -556,17 +766,14 @@ class promise final {
   /**
    * Swaps this promise with another one.
    */
-  void swap(promise& oth) noexcept {
-    std::swap(m_request, oth.m_request);
-    std::swap(m_promises, oth.m_promises);
-  }
+  void swap(promise& oth) noexcept { std::swap(m_state, oth.m_state); }
 
   /**
    * Gets a future for this promise.
    *
    * @return The future
    */
-  future<T> get_future() noexcept { return future<T>(m_promises, m_request); }
+  future<T> get_future() noexcept { return future<T>(m_state); }
 
   /**
    * Sets the promised value.
@@ -575,8 +782,7 @@ class promise final {
    * @param value The value to provide to the waiting future
    */
   void set_value(const T& value) {
-    if (m_promises) m_promises->SetValue(m_request, value);
-    m_promises = nullptr;
+    if (auto state = std::move(m_state)) state->SetValue(value);
   }
 
   /**
@@ -586,16 +792,14 @@ class promise final {
    * @param value The value to provide to the waiting future
    */
   void set_value(T&& value) {
-    if (m_promises) m_promises->SetValue(m_request, std::move(value));
-    m_promises = nullptr;
+    if (auto state = std::move(m_state)) state->SetValue(std::move(value));
   }
 
  private:
-  promise(PromiseFactory<T>* promises, uint64_t request) noexcept
-      : m_request(request), m_promises(promises) {}
+  explicit promise(detail::FutureStatePtr<T> state) noexcept
+      : m_state(std::move(state)) {}
 
-  uint64_t m_request = 0;
-  PromiseFactory<T>* m_promises = nullptr;
+  detail::FutureStatePtr<T> m_state;
 };
 
 /**
@@ -609,15 +813,9 @@ class promise<void> final {
   /**
    * Constructs an empty promise.
    */
-  promise() : m_promises(&PromiseFactory<void>::GetInstance()) {
-    m_request = m_promises->CreateRequest();
-  }
+  promise() : m_state(std::make_shared<detail::FutureState<void>>()) {}
 
-  promise(promise&& oth) noexcept
-      : m_request(oth.m_request), m_promises(oth.m_promises) {
-    oth.m_request = 0;
-    oth.m_promises = nullptr;
-  }
+  promise(promise&& oth) noexcept = default;
 
   promise(const promise&) = delete;
 
@@ -625,14 +823,11 @@ class promise<void> final {
    * Sets the promised value if not already set.
    */
   ~promise() {
-    if (m_promises) m_promises->SetValue(m_request);
+    if (m_state) m_state->SetValue();
   }
 
   promise& operator=(promise&& oth) noexcept {
-    m_request = oth.m_request;
-    m_promises = oth.m_promises;
-    oth.m_request = 0;
-    oth.m_promises = nullptr;
+    promise(std::move(oth)).swap(*this);
     return *this;
   }
 
@@ -641,35 +836,28 @@ class promise<void> final {
   /**
    * Swaps this promise with another one.
    */
-  void swap(promise& oth) noexcept {
-    std::swap(m_request, oth.m_request);
-    std::swap(m_promises, oth.m_promises);
-  }
+  void swap(promise& oth) noexcept { std::swap(m_state, oth.m_state); }
 
   /**
    * Gets a future for this promise.
    *
    * @return The future
    */
-  future<void> get_future() noexcept {
-    return future<void>(m_promises, m_request);
-  }
+  future<void> get_future() noexcept { return future<void>(m_state); }
 
   /**
    * Sets the promised value.
    * Only effective once (subsequent calls will be ignored).
    */
   void set_value() {
-    if (m_promises) m_promises->SetValue(m_request);
-    m_promises = nullptr;
+    if (auto state = std::move(m_state)) state->SetValue();
   }
 
  private:
-  promise(PromiseFactory<void>* promises, uint64_t request) noexcept
-      : m_request(request), m_promises(promises) {}
+  explicit promise(detail::FutureStatePtr<void> state) noexcept
+      : m_state(std::move(state)) {}
 
-  uint64_t m_request = 0;
-  PromiseFactory<void>* m_promises = nullptr;
+  detail::FutureStatePtr<void> m_state;
 };
 
 /**
@@ -677,129 +865,117 @@ class promise<void> final {
  */
 template <typename T>
 inline future<T> make_ready_future(T&& value) {
-  return PromiseFactory<T>::GetInstance().MakeReadyFuture(
-      std::forward<T>(value));
+  promise<T> p;
+  auto f = p.get_future();
+  p.set_value(std::forward<T>(value));
+  return f;
 }
 
 /**
  * Constructs a valid future with the value set.
  */
 inline future<void> make_ready_future() {
-  return PromiseFactory<void>::GetInstance().MakeReadyFuture();
+  promise<void> p;
+  auto f = p.get_future();
+  p.set_value();
+  return f;
+}
+
+template <class Clock, class Duration>
+bool detail::FutureStateBase::WaitUntil(
+    const std::chrono::time_point<Clock, Duration>& timeout_time) {
+  if (IsReady()) return true;
+  Waiter& waiter = GetWaiter();
+  std::unique_lock lock(waiter.mutex);
+  return waiter.cv.wait_until(lock, timeout_time, [&] { return IsReady(); });
+}
+
+template <typename T>
+PromiseFactory<T>::~PromiseFactory() {
+  // wake up any waiters; a claimed promise completes its own future
+  for (auto& request : m_requests) {
+    if (!request.second.promise) request.second.state->SetValue(T());
+  }
+}
+
+template <typename T>
+uint64_t PromiseFactory<T>::CreateRequest() {
+  std::scoped_lock lock(m_mutex);
+  uint64_t req = CreateRequestId();
+  m_requests.try_emplace(
+      req, Request{std::make_shared<detail::FutureState<T>>()});
+  return req;
+}
+
+template <typename T>
+detail::FutureStatePtr<T> PromiseFactory<T>::Find(uint64_t request,
+                                                  Claim claim) {
+  std::scoped_lock lock(m_mutex);
+  auto it = m_requests.find(request);
+  if (it == m_requests.end()) return nullptr;
+  Request& req = it->second;
+  if (claim == kFuture) {
+    req.future = true;
+  } else if (claim == kPromise) {
+    // only one promise may set the value
+    if (req.promise) return nullptr;
+    req.promise = true;
+  }
+  auto state = req.state;
+  if (req.future && req.promise) m_requests.erase(it);
+  return state;
 }
 
 template <typename T>
 inline future<T> PromiseFactory<T>::CreateFuture(uint64_t request) {
-  return future<T>{this, request};
+  return future<T>{Find(request, kFuture)};
 }
 
 template <typename T>
 future<T> PromiseFactory<T>::MakeReadyFuture(T&& value) {
-  std::unique_lock lock(GetResultMutex());
-  uint64_t req = CreateErasedRequest();
-  m_results.emplace_back(std::piecewise_construct, std::forward_as_tuple(req),
-                         std::forward_as_tuple(std::move(value)));
-  return future<T>{this, req};
+  return make_ready_future(std::move(value));
 }
 
 template <typename T>
 inline promise<T> PromiseFactory<T>::CreatePromise(uint64_t request) {
-  return promise<T>{this, request};
+  return promise<T>{Find(request, kPromise)};
 }
 
 template <typename T>
 void PromiseFactory<T>::SetValue(uint64_t request, const T& value) {
-  std::unique_lock lock(GetResultMutex());
-  if (!EraseRequest(request)) return;
-  auto it = std::find_if(m_thens.begin(), m_thens.end(),
-                         [=](const auto& x) { return x.request == request; });
-  if (it != m_thens.end()) {
-    uint64_t outRequest = it->outRequest;
-    ThenFunction func = std::move(it->func);
-    m_thens.erase(it);
-    lock.unlock();
-    return func(outRequest, value);
-  }
-  m_results.emplace_back(std::piecewise_construct,
-                         std::forward_as_tuple(request),
-                         std::forward_as_tuple(value));
-  Notify();
+  if (auto state = Find(request, kPromise)) state->SetValue(value);
 }
 
 template <typename T>
 void PromiseFactory<T>::SetValue(uint64_t request, T&& value) {
-  std::unique_lock lock(GetResultMutex());
-  if (!EraseRequest(request)) return;
-  auto it = std::find_if(m_thens.begin(), m_thens.end(),
-                         [=](const auto& x) { return x.request == request; });
-  if (it != m_thens.end()) {
-    uint64_t outRequest = it->outRequest;
-    ThenFunction func = std::move(it->func);
-    m_thens.erase(it);
-    lock.unlock();
-    return func(outRequest, std::move(value));
-  }
-  m_results.emplace_back(std::piecewise_construct,
-                         std::forward_as_tuple(request),
-                         std::forward_as_tuple(std::move(value)));
-  Notify();
+  if (auto state = Find(request, kPromise)) state->SetValue(std::move(value));
 }
 
 template <typename T>
 void PromiseFactory<T>::SetThen(uint64_t request, uint64_t outRequest,
                                 ThenFunction func) {
-  std::unique_lock lock(GetResultMutex());
-  auto it = std::find_if(m_results.begin(), m_results.end(),
-                         [=](const auto& r) { return r.first == request; });
-  if (it != m_results.end()) {
-    auto val = std::move(it->second);
-    m_results.erase(it);
-    lock.unlock();
-    return func(outRequest, std::move(val));
+  if (auto state = Find(request, kFuture)) {
+    state->SetThen([outRequest, func = std::move(func)](T value) {
+      func(outRequest, std::move(value));
+    });
   }
-  m_thens.emplace_back(request, outRequest, func);
 }
 
 template <typename T>
 bool PromiseFactory<T>::IsReady(uint64_t request) noexcept {
-  std::unique_lock lock(GetResultMutex());
-  auto it = std::find_if(m_results.begin(), m_results.end(),
-                         [=](const auto& r) { return r.first == request; });
-  return it != m_results.end();
+  auto state = Find(request, kPeek);
+  return state && state->IsReady();
 }
 
 template <typename T>
 T PromiseFactory<T>::GetResult(uint64_t request) {
-  // wait for response
-  std::unique_lock lock(GetResultMutex());
-  while (IsActive()) {
-    // Did we get a response to *our* request?
-    auto it = std::find_if(m_results.begin(), m_results.end(),
-                           [=](const auto& r) { return r.first == request; });
-    if (it != m_results.end()) {
-      // Yes, remove it from the vector and we're done.
-      auto rv = std::move(it->second);
-      m_results.erase(it);
-      return rv;
-    }
-    // No, keep waiting for a response
-    Wait(lock);
-  }
+  if (auto state = Find(request, kFuture)) return state->GetValue();
   return T();
 }
 
 template <typename T>
 void PromiseFactory<T>::WaitResult(uint64_t request) {
-  // wait for response
-  std::unique_lock lock(GetResultMutex());
-  while (IsActive()) {
-    // Did we get a response to *our* request?
-    auto it = std::find_if(m_results.begin(), m_results.end(),
-                           [=](const auto& r) { return r.first == request; });
-    if (it != m_results.end()) return;
-    // No, keep waiting for a response
-    Wait(lock);
-  }
+  if (auto state = Find(request, kPeek)) state->Wait();
 }
 
 template <typename T>
@@ -807,18 +983,23 @@ template <class Clock, class Duration>
 bool PromiseFactory<T>::WaitResultUntil(
     uint64_t request,
     const std::chrono::time_point<Clock, Duration>& timeout_time) {
-  std::unique_lock lock(GetResultMutex());
-  bool timeout = false;
-  while (IsActive()) {
-    // Did we get a response to *our* request?
-    auto it = std::find_if(m_results.begin(), m_results.end(),
-                           [=](const auto& r) { return r.first == request; });
-    if (it != m_results.end()) return true;
-    if (timeout) break;
-    // No, keep waiting for a response
-    if (!WaitUntil(lock, timeout_time)) timeout = true;
-  }
-  return false;
+  auto state = Find(request, kPeek);
+  return state && state->WaitUntil(timeout_time);
+}
+
+template <typename T>
+bool PromiseFactory<T>::EraseRequest(uint64_t request) {
+  std::scoped_lock lock(m_mutex);
+  auto it = m_requests.find(request);
+  if (it == m_requests.end()) return false;
+  bool pending = !it->second.state->IsReady();
+  m_requests.erase(it);
+  return pending;
+}
+
+template <typename T>
+void PromiseFactory<T>::IgnoreResult(uint64_t request) {
+  Find(request, kFuture);
 }
 
 template <typename T>
@@ -828,78 +1009,64 @@ PromiseFactory<T>& PromiseFactory<T>::GetInstance() {
 }
 
 inline future<void> PromiseFactory<void>::CreateFuture(uint64_t request) {
-  return future<void>{this, request};
+  return future<void>{Find(request, kFuture)};
 }
 
 inline promise<void> PromiseFactory<void>::CreatePromise(uint64_t request) {
-  return promise<void>{this, request};
+  return promise<void>{Find(request, kPromise)};
 }
 
 template <class Clock, class Duration>
 bool PromiseFactory<void>::WaitResultUntil(
     uint64_t request,
     const std::chrono::time_point<Clock, Duration>& timeout_time) {
-  std::unique_lock lock(GetResultMutex());
-  bool timeout = false;
-  while (IsActive()) {
-    // Did we get a response to *our* request?
-    auto it = std::find_if(m_results.begin(), m_results.end(),
-                           [=](const auto& r) { return r == request; });
-    if (it != m_results.end()) return true;
-    if (timeout) break;
-    // No, keep waiting for a response
-    if (!WaitUntil(lock, timeout_time)) timeout = true;
-  }
-  return false;
+  auto state = Find(request, kPeek);
+  return state && state->WaitUntil(timeout_time);
 }
 
 template <typename To, typename From>
 template <typename F>
-future<To> detail::FutureThen<To, From>::Create(
-    PromiseFactory<From>& fromFactory, uint64_t request,
-    PromiseFactory<To>& factory, F&& func) {
-  uint64_t req = factory.CreateRequest();
-  fromFactory.SetThen(request, req, [&factory, func](uint64_t r, From value) {
-    factory.SetValue(r, func(std::move(value)));
+future<To> detail::FutureThen<To, From>::Create(FutureState<From>& from,
+                                                F&& func) {
+  auto out = std::make_shared<FutureState<To>>();
+  from.SetThen([out, func = std::forward<F>(func)](From value) mutable {
+    out->SetValue(func(std::move(value)));
   });
-  return factory.CreateFuture(req);
+  return future<To>{std::move(out)};
 }
 
 template <typename From>
 template <typename F>
-future<void> detail::FutureThen<void, From>::Create(
-    PromiseFactory<From>& fromFactory, uint64_t request,
-    PromiseFactory<void>& factory, F&& func) {
-  uint64_t req = factory.CreateRequest();
-  fromFactory.SetThen(request, req, [&factory, func](uint64_t r, From value) {
+future<void> detail::FutureThen<void, From>::Create(FutureState<From>& from,
+                                                    F&& func) {
+  auto out = std::make_shared<FutureState<void>>();
+  from.SetThen([out, func = std::forward<F>(func)](From value) mutable {
     func(std::move(value));
-    factory.SetValue(r);
+    out->SetValue();
   });
-  return factory.CreateFuture(req);
+  return future<void>{std::move(out)};
 }
 
 template <typename To>
 template <typename F>
-future<To> detail::FutureThen<To, void>::Create(
-    PromiseFactory<void>& fromFactory, uint64_t request,
-    PromiseFactory<To>& factory, F&& func) {
-  uint64_t req = factory.CreateRequest();
-  fromFactory.SetThen(request, req, [&factory, func](uint64_t r) {
-    factory.SetValue(r, func());
+future<To> detail::FutureThen<To, void>::Create(FutureState<void>& from,
+                                                F&& func) {
+  auto out = std::make_shared<FutureState<To>>();
+  from.SetThen([out, func = std::forward<F>(func)]() mutable {
+    out->SetValue(func());
   });
-  return factory.CreateFuture(req);
+  return future<To>{std::move(out)};
 }
 
 template <typename F>
-future<void> detail::FutureThen<void, void>::Create(
-    PromiseFactory<void>& fromFactory, uint64_t request,
-    PromiseFactory<void>& factory, F&& func) {
-  uint64_t req = factory.CreateRequest();
-  fromFactory.SetThen(request, req, [&factory, func](uint64_t r) {
+future<void> detail::FutureThen<void, void>::Create(FutureState<void>& from,
+                                                    F&& func) {
+  auto out = std::make_shared<FutureState<void>>();
+  from.SetThen([out, func = std::forward<F>(func)]() mutable {
     func();
-    factory.SetValue(r);
+    out->SetValue();
   });
-  return factory.CreateFuture(req);
+  return future<void>{std::move(out)};
 }
 
 }  // namespace wpi
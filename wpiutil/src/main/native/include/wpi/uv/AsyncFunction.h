@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2018-2019 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2018-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -81,23 +81,20 @@ class AsyncFunction<R(T...)> final
     int err =
         uv_async_init(loop->GetRaw(), h->GetRaw(), [](uv_async_t* handle) {
           auto& h = *static_cast<AsyncFunction*>(handle->data);
-          std::unique_lock lock(h.m_mutex);
-
-          if (!h.m_params.empty()) {
-            // for each set of parameters in the input queue, call the wakeup
-            // function and put the result in the output queue if the caller is
-            // waiting for it
-            for (auto&& v : h.m_params) {
-              auto p = h.m_promises.CreatePromise(v.first);
-              if (h.wakeup)
-                std::apply(h.wakeup,
-                           std::tuple_cat(std::make_tuple(std::move(p)),
-                                          std::move(v.second)));
-            }
-            h.m_params.clear();
-            // wake up any threads that might be waiting for the result
-            lock.unlock();
-            h.m_promises.Notify();
+          std::vector<std::pair<promise<R>, std::tuple<T...>>> params;
+          {
+            std::scoped_lock lock(h.m_mutex);
+            params.swap(h.m_params);
+          }
+
+          // for each set of parameters in the input queue, call the wakeup
+          // function; setting the promise wakes up any thread waiting for the
+          // result (promises left unset provide a default value)
+          for (auto&& v : params) {
+            if (h.wakeup)
+              std::apply(h.wakeup,
+                         std::tuple_cat(std::make_tuple(std::move(v.first)),
+                                        std::move(v.second)));
           }
         });
     if (err < 0) {
@@ -121,20 +118,21 @@ class AsyncFunction<R(T...)> final
   template <typename... U>
   future<R> Call(U&&... u) {
     // create the future
-    uint64_t req = m_promises.CreateRequest();
+    promise<R> p;
+    auto f = p.get_future();
 
     auto loop = m_loop.lock();
     if (loop && loop->GetThreadId() == std::this_thread::get_id()) {
       // called from within the loop, just call the function directly
-      wakeup(m_promises.CreatePromise(req), std::forward<U>(u)...);
-      return m_promises.CreateFuture(req);
+      wakeup(std::move(p), std::forward<U>(u)...);
+      return f;
     }
 
     // add the parameters to the input queue
     {
       std::scoped_lock lock(m_mutex);
       m_params.emplace_back(std::piecewise_construct,
-                            std::forward_as_tuple(req),
+                            std::forward_as_tuple(std::move(p)),
                             std::forward_as_tuple(std::forward<U>(u)...));
     }
 
@@ -142,7 +140,7 @@ class AsyncFunction<R(T...)> final
     if (loop) this->Invoke(&uv_async_send, this->GetRaw());
 
     // return future
-    return m_promises.CreateFuture(req);
+    return f;
   }
 
   template <typename... U>
@@ -157,8 +155,7 @@ class AsyncFunction<R(T...)> final
 
  private:
   wpi::mutex m_mutex;
-  std::vector<std::pair<uint64_t, std::tuple<T...>>> m_params;
-  PromiseFactory<R> m_promises;
+  std::vector<std::pair<promise<R>, std::tuple<T...>>> m_params;
   std::weak_ptr<Loop> m_loop;
 };
 
@@ -0,0 +1,52 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include "wpi/ThreadHooks.h"  // NOLINT(build/include_order)
+
+#include "gtest/gtest.h"  // NOLINT(build/include_order)
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "wpi/mutex.h"
+
+namespace wpi {
+
+TEST(ThreadHooksTest, StartHook) {
+  wpi::mutex mutex;
+  std::vector<std::string> names;
+  SetThreadStartHook([&](StringRef name) {
+    std::scoped_lock lock(mutex);
+    names.emplace_back(name);
+  });
+
+  std::string osName;
+  std::thread thr([&] {
+    SetCurrentThreadName("NTConnection 127.0.0.1");
+#ifdef __linux__
+    char buf[16];
+    if (pthread_getname_np(pthread_self(), buf, sizeof(buf)) == 0)
+      osName = buf;
+#endif
+  });
+  thr.join();
+  SetThreadStartHook(nullptr);
+  std::thread([] { SetCurrentThreadName("unhooked"); }).join();
+
+  ASSERT_EQ(1u, names.size());
+  EXPECT_EQ("NTConnection 127.0.0.1", names[0]);
+#ifdef __linux__
+  EXPECT_EQ("NTConnection 12", osName);
+#endif
+}
+
+}  // namespace wpi
@@ -0,0 +1,169 @@
+/*----------------------------------------------------------------------------*/
+/* Copyright (c) 2020 FIRST. All Rights Reserved.                             */
+/* Open Source Software - may be modified and shared by FRC teams. The code   */
+/* must be accompanied by the FIRST BSD license file in the root directory of */
+/* the project.                                                               */
+/*----------------------------------------------------------------------------*/
+
+#include "wpi/Trace.h"  // NOLINT(build/include_order)
+
+#include "gtest/gtest.h"  // NOLINT(build/include_order)
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include "wpi/SmallString.h"
+#include "wpi/json.h"
+#include "wpi/raw_ostream.h"
+
+namespace wpi {
+
+static json ExportTrace() {
+  SmallString<256> buf;
+  raw_svector_ostream os{buf};
+  trace::WriteChromeTrace(os);
+  return json::parse(os.str());
+}
+
+class TraceTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    trace::Clear();
+    trace::SetEnabled(true);
+  }
+
+  void TearDown() override {
+    trace::SetEnabled(false);
+    trace::Clear();
+  }
+};
+
+TEST_F(TraceTest, NestedScopes) {
+  {
+    TraceScope outer{"outer"};
+    TraceScope inner{"inner"};
+  }
+  trace::SetEnabled(false);
+
+  auto events = ExportTrace()["traceEvents"];
+  ASSERT_EQ(events.size(), 4u);
+  EXPECT_EQ(events[0]["name"], "outer");
+  EXPECT_EQ(events[0]["ph"], "B");
+  EXPECT_EQ(events[1]["name"], "inner");
+  EXPECT_EQ(events[1]["ph"], "B");
+  EXPECT_EQ(events[2]["name"], "inner");
+  EXPECT_EQ(events[2]["ph"], "E");
+  EXPECT_EQ(events[3]["name"], "outer");
+  EXPECT_EQ(events[3]["ph"], "E");
+  EXPECT_LE(events[0]["ts"].get<uint64_t>(), events[3]["ts"].get<uint64_t>());
+}
+
+TEST_F(TraceTest, Disabled) {
+  trace::SetEnabled(false);
+  { TraceScope scope{"ignored"}; }
+  EXPECT_TRUE(ExportTrace()["traceEvents"].empty());
+}
+
+TEST_F(TraceTest, DisabledDuringScope) {
+  {
+    TraceScope scope{"span"};
+    trace::SetEnabled(false);
+  }
+  EXPECT_EQ(ExportTrace()["traceEvents"].size(), 2u);
+}
+
+TEST_F(TraceTest, Threads) {
+  std::thread thr([] {
+    trace::SetThreadName("worker");
+    TraceScope scope{"work"};
+  });
+  thr.join();
+  { TraceScope scope{"main"}; }
+  trace::SetEnabled(false);
+
+  int workerTid = -1;
+  int workEvents = 0;
+  int mainEvents = 0;
+  int mainTid = -1;
+  auto trace = ExportTrace();
+  for (auto& event : trace["traceEvents"]) {
+    std::string name = event["name"];
+    if (name == "thread_name") {
+      EXPECT_EQ(event["args"]["name"], "worker");
+      workerTid = event["tid"];
+    } else if (name == "work") {
+      EXPECT_EQ(event["tid"].get<int>(), workerTid);
+      ++workEvents;
+    } else if (name == "main") {
+      mainTid = event["tid"];
+      ++mainEvents;
+    }
+  }
+  EXPECT_EQ(workEvents, 2);
+  EXPECT_EQ(mainEvents, 2);
+  EXPECT_NE(mainTid, workerTid);
+}
+
+TEST_F(TraceTest, Clear) {
+  { TraceScope scope{"before"}; }
+  trace::Clear();
+  { TraceScope scope{"after"}; }
+  trace::SetEnabled(false);
+
+  auto events = ExportTrace()["traceEvents"];
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_EQ(events[0]["name"], "after");
+}
+
+TEST_F(TraceTest, Wraparound) {
+  for (int i = 0; i < 10000; ++i) {
+    TraceScope scope{"loop"};
+  }
+  trace::SetEnabled(false);
+
+  auto events = ExportTrace()["traceEvents"];
+  EXPECT_EQ(events.size(), 8192u);
+  EXPECT_EQ(events.back()["ph"], "E");
+}
+
+TEST_F(TraceTest, NameWithoutEvents) {
+  trace::SetEnabled(false);
+  std::thread([] { trace::SetThreadName("idle"); }).join();
+  EXPECT_TRUE(ExportTrace()["traceEvents"].empty());
+
+  // The name is kept until the thread records
+  std::thread([] {
+    trace::SetThreadName("late");
+    trace::SetEnabled(true);
+    TraceScope scope{"work"};
+  }).join();
+  trace::SetEnabled(false);
+  auto events = ExportTrace()["traceEvents"];
+  ASSERT_EQ(events.size(), 3u);
+  EXPECT_EQ(events[0]["args"]["name"], "late");
+}
+
+TEST_F(TraceTest, ExitedThreadsAreBounded) {
+  for (int i = 0; i < 100; ++i)
+    std::thread([] { TraceScope scope{"short"}; }).join();
+  trace::SetEnabled(false);
+  EXPECT_LE(ExportTrace()["traceEvents"].size(), 2u * 17);
+}
+
+TEST_F(TraceTest, ExportWhileRecording) {
+  std::atomic<bool> done{false};
+  std::thread thr([&] {
+    while (!done) TraceScope scope{"busy"};
+  });
+  for (int i = 0; i < 20; ++i) {
+    auto trace = ExportTrace();
+    for (auto& event : trace["traceEvents"]) {
+      EXPECT_EQ(event["name"], "busy");
+    }
+  }
+  done = true;
+  thr.join();
+}
+
+}  // namespace wpi
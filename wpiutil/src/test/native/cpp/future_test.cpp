@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2018 FIRST. All Rights Reserved.                             */
+/* Copyright (c) 2018-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -9,7 +9,13 @@
 
 #include "gtest/gtest.h"  // NOLINT(build/include_order)
 
+#include <algorithm>
+#include <chrono>
+#include <random>
 #include <thread>
+#include <vector>
+
+#include "wpi/WorkerThread.h"
 
 namespace wpi {
 
@@ -81,4 +87,182 @@ TEST(Future, MoveVoid) {
   ASSERT_TRUE(outFuture.is_ready());
 }
 
+TEST(Future, ThenAfterReady) {
+  promise<int> inPromise;
+  future<int> inFuture = inPromise.get_future();
+  inPromise.set_value(2);
+
+  future<int> outFuture = inFuture.then([](int v) { return v * 3; });
+  ASSERT_TRUE(outFuture.is_ready());
+  ASSERT_EQ(outFuture.get(), 6);
+}
+
+TEST(Future, ThenOtherThread) {
+  promise<int> inPromise;
+  future<int> outFuture =
+      inPromise.get_future().then([](int v) { return v + 1; });
+
+  std::thread thr([&] { inPromise.set_value(4); });
+  ASSERT_EQ(outFuture.get(), 5);
+  thr.join();
+}
+
+TEST(Future, WaitForTimeout) {
+  promise<int> inPromise;
+  future<int> outFuture = inPromise.get_future();
+
+  ASSERT_FALSE(outFuture.wait_for(std::chrono::milliseconds(10)));
+  inPromise.set_value(1);
+  ASSERT_TRUE(outFuture.wait_for(std::chrono::milliseconds(10)));
+}
+
+TEST(Future, PromiseDestroyed) {
+  future<int> outFuture;
+  {
+    promise<int> inPromise;
+    outFuture = inPromise.get_future();
+  }
+  ASSERT_EQ(outFuture.get(), 0);
+}
+
+TEST(Future, ManyWaiters) {
+  constexpr int kOutstanding = 500;
+  constexpr int kWaiters = 8;
+  std::vector<promise<int>> promises(kOutstanding);
+  std::vector<future<int>> futures;
+  for (auto& p : promises) futures.emplace_back(p.get_future());
+
+  std::vector<int> order(kOutstanding);
+  for (int i = 0; i < kOutstanding; ++i) order[i] = i;
+  std::shuffle(order.begin(), order.end(), std::mt19937{42});
+
+  std::vector<std::thread> waiters;
+  std::vector<int> sums(kWaiters);
+  for (int w = 0; w < kWaiters; ++w) {
+    waiters.emplace_back([&, w] {
+      for (int i = w; i < kOutstanding; i += kWaiters) {
+        sums[w] += futures[i].get();
+      }
+    });
+  }
+  for (int i : order) promises[i].set_value(i);
+  for (auto& thr : waiters) thr.join();
+
+  int sum = 0;
+  for (int s : sums) sum += s;
+  ASSERT_EQ(sum, kOutstanding * (kOutstanding - 1) / 2);
+}
+
+TEST(Future, ManyThenOtherThread) {
+  constexpr int kOutstanding = 500;
+  std::vector<promise<int>> promises(kOutstanding);
+  std::vector<future<int>> futures;
+  for (auto& p : promises) {
+    futures.emplace_back(
+        p.get_future().then([](int v) { return v + 1; }).then([](int v) {
+          return v * 2;
+        }));
+  }
+  std::thread producer([&] {
+    for (int i = 0; i < kOutstanding; ++i) promises[i].set_value(i);
+  });
+  int sum = 0;
+  for (auto& f : futures) sum += f.get();
+  producer.join();
+  ASSERT_EQ(sum, kOutstanding * (kOutstanding + 1));
+}
+
+TEST(Future, WorkerThreadBacklog) {
+  constexpr int kOutstanding = 500;
+  WorkerThread<int(int)> worker;
+  std::vector<future<int>> futures;
+  for (int i = 0; i < kOutstanding; ++i) {
+    futures.emplace_back(worker.QueueWork([](int v) { return v; }, i));
+  }
+  int sum = 0;
+  for (auto& f : futures) sum += f.get();
+  ASSERT_EQ(sum, kOutstanding * (kOutstanding - 1) / 2);
+}
+
+TEST(Future, FactorySetValueBeforeCreateFuture) {
+  PromiseFactory<int> factory;
+  uint64_t req = factory.CreateRequest();
+  factory.SetValue(req, 5);
+  future<int> f = factory.CreateFuture(req);
+  ASSERT_TRUE(f.valid());
+  ASSERT_EQ(f.get(), 5);
+}
+
+TEST(Future, FactoryPromiseBeforeCreateFuture) {
+  PromiseFactory<int> factory;
+  uint64_t req = factory.CreateRequest();
+  factory.CreatePromise(req).set_value(5);
+  future<int> f = factory.CreateFuture(req);
+  ASSERT_TRUE(f.valid());
+  ASSERT_EQ(f.get(), 5);
+}
+
+TEST(Future, FactoryVoidSetValueBeforeCreateFuture) {
+  PromiseFactory<void> factory;
+  uint64_t req = factory.CreateRequest();
+  factory.CreatePromise(req).set_value();
+  future<void> f = factory.CreateFuture(req);
+  ASSERT_TRUE(f.valid());
+  ASSERT_TRUE(f.is_ready());
+}
+
+TEST(Future, FactorySinglePromise) {
+  PromiseFactory<int> factory;
+  uint64_t req = factory.CreateRequest();
+  future<int> f = factory.CreateFuture(req);
+  factory.SetValue(req, 5);
+  factory.SetValue(req, 6);
+  ASSERT_EQ(f.get(), 5);
+}
+
+TEST(Future, FactoryGetResult) {
+  PromiseFactory<int> factory;
+  uint64_t req = factory.CreateRequest();
+  ASSERT_FALSE(factory.IsReady(req));
+  factory.SetValue(req, 5);
+  ASSERT_TRUE(factory.IsReady(req));
+  ASSERT_EQ(factory.GetResult(req), 5);
+  // both sides claimed
+  ASSERT_FALSE(factory.CreateFuture(req).valid());
+}
+
+TEST(Future, FactoryEraseRequest) {
+  PromiseFactory<int> factory;
+  uint64_t req = factory.CreateRequest();
+  future<int> f = factory.CreateFuture(req);
+  ASSERT_TRUE(factory.EraseRequest(req));
+  ASSERT_FALSE(factory.EraseRequest(req));
+  factory.SetValue(req, 5);
+  ASSERT_FALSE(f.is_ready());
+
+  uint64_t req2 = factory.CreateRequest();
+  factory.SetValue(req2, 5);
+  ASSERT_FALSE(factory.EraseRequest(req2));
+}
+
+TEST(Future, FactoryVoidSetThen) {
+  PromiseFactory<void> factory;
+  uint64_t req = factory.CreateRequest();
+  uint64_t outReq = 0;
+  factory.SetThen(req, 7, [&](uint64_t r) { outReq = r; });
+  ASSERT_EQ(outReq, 0u);
+  factory.SetValue(req);
+  ASSERT_EQ(outReq, 7u);
+}
+
+TEST(Future, FactoryWaitResultUntil) {
+  PromiseFactory<int> factory;
+  uint64_t req = factory.CreateRequest();
+  ASSERT_FALSE(factory.WaitResultUntil(
+      req, std::chrono::steady_clock::now() + std::chrono::milliseconds(1)));
+  factory.SetValue(req, 5);
+  ASSERT_TRUE(factory.WaitResultUntil(
+      req, std::chrono::steady_clock::now() + std::chrono::milliseconds(1)));
+}
+
 }  // namespace wpi
@@ -1,5 +1,5 @@
 /*----------------------------------------------------------------------------*/
-/* Copyright (c) 2015-2018 FIRST. All Rights Reserved.                        */
+/* Copyright (c) 2015-2020 FIRST. All Rights Reserved.                        */
 /* Open Source Software - may be modified and shared by FRC teams. The code   */
 /* must be accompanied by the FIRST BSD license file in the root directory of */
 /* the project.                                                               */
@@ -48,6 +48,7 @@ TEST(LEB128Test, WriteUleb128) {
   EXPECT_ULEB128_EQ("\xff\x01", 0xff, 0);
   EXPECT_ULEB128_EQ("\x80\x02", 0x100, 0);
   EXPECT_ULEB128_EQ("\x81\x02", 0x101, 0);
+  EXPECT_ULEB128_EQ("\xc5\xbb\x9b\xf6\xb1\xaf\x97\x03", 0x65d7b1ec6ddc5u, 0);
 
 #undef EXPECT_ULEB128_EQ
 }
@@ -73,7 +74,8 @@ TEST(LEB128Test, ReadUleb128) {
   EXPECT_READ_ULEB128_EQ(0xffu, "\xff\x01");
   EXPECT_READ_ULEB128_EQ(0x100u, "\x80\x02");
   EXPECT_READ_ULEB128_EQ(0x101u, "\x81\x02");
-  EXPECT_READ_ULEB128_EQ(8320u, "\x80\xc1\x80\x80\x10");
+  EXPECT_READ_ULEB128_EQ(0x100002080u, "\x80\xc1\x80\x80\x10");
+  EXPECT_READ_ULEB128_EQ(0x65d7b1ec6ddc5u, "\xc5\xbb\x9b\xf6\xb1\xaf\x97\x03");
 
 #undef EXPECT_READ_ULEB128_EQ
 }